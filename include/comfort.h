@@ -0,0 +1,32 @@
+// =================================================================================
+// File:         include/comfort.h
+// Description:  Комфортный режим (снижение уставки по расписанию).
+//               Расписание разбирается из JSON один раз при загрузке/сохранении,
+//               часы RTC читаются раз в минуту, и результат для обоих контуров
+//               считается тогда же - остальной код только берёт готовое.
+// =================================================================================
+
+#ifndef COMFORT_H
+#define COMFORT_H
+
+#include "config.h"
+
+// Разбор JSON {enabled, intervals:[{start:"HH:MM", end:"HH:MM", reduct}], days:[0..6]}
+void comfortCompile(const String& json, ComfortSchedule& out);
+
+// Раз в минуту читает RTC и пересчитывает состояние; возвращает мс до следующего чтения
+uint32_t comfortTick();
+
+// Пересчитать на ближайшем comfortTick() (после сохранения расписания или времени)
+void comfortInvalidate();
+
+// Активен ли комфортный режим контура (1 или 2) и величина снижения
+bool comfortActive(uint8_t cont, float& reduction);
+
+// Текущее время по последнему чтению RTC (false - RTC недоступны)
+bool comfortClock(uint8_t& hour, uint8_t& minute, uint8_t& dayOfWeek);
+
+// Время UNIX: последнее чтение RTC плюс прошедшее с него (false - часы не установлены)
+bool comfortUnixTime(uint32_t& unixTime);
+
+#endif // COMFORT_H
@@ -21,10 +21,16 @@
 #include <U8g2lib.h>
 #include <ArduinoJson.h>
 #include <esp_task_wdt.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 #include <RTClib.h>
 
 // --- Секция 1.1: Структуры данных ---
 
+#define OW_VAR_COUNT 11 // Жестко задаем количество, чтобы использовать как константу
+#define CONTOUR_COUNT 2 // Контуров (СО/ГВП) на контроллере; их входы, реле и ключи - CONTOURS ниже
+
 // Описание "Плитки" (режима работы)
 struct TileDef {
   const char* id;
@@ -36,6 +42,29 @@ struct TileDef {
   float       defaultValue;
 };
 
+// Дискретные входы (логические номера); вывод платы - INPUT_MAP
+enum InputId : uint8_t {
+  IN_C1_MODE = 0, IN_C1_DRY_RUN, IN_PUMP1_FB, IN_PUMP2_FB,
+  IN_C2_MODE, IN_C2_DRY_RUN, IN_PUMP3_FB, IN_PUMP4_FB,
+  INPUT_COUNT
+};
+
+// Описание контура: входы, реле, биты маски насосов и ключи NVS.
+// Датчики подачи/обратки контура задаёт его профиль (TileDef).
+// Контур 1..CONTOUR_COUNT - строка CONTOURS[cont - 1].
+struct ContourDef {
+  InputId modeInput;          // 1 - автоматический режим
+  InputId dryRunInput;        // 0 - сухой ход
+  InputId pumpFeedback[2];    // Обратная связь насосов P1/P2
+  uint8_t pumpRelay[2];
+  uint8_t pumpEnableBit[2];   // Биты globalPumpEnableMask
+  uint8_t valveOpenRelay;     // Импульс "+" клапана
+  uint8_t valveCloseRelay;    // Импульс "-" клапана
+  const char* piKeys[3];      // NVS "general": Kp, Ki, Ti (и имена полей /api/settings)
+  const char* profileKey;     // NVS "profiles"
+  const char* comfortKey;     // NVS "general" (и блок /api/settings/save)
+};
+
 // Индексы для удобного доступа к плиткам
 enum TileIndex : uint8_t {
   TILE_CO_1 = 0, TILE_GVP_1, TILE_CO_2, TILE_GVP_2, TILE_CUSTOM_5, TILE_CUSTOM_6
@@ -78,6 +107,66 @@ struct ContourPumpLogic {
     bool summer_mode_active = false;
     unsigned long dryRunAlarmStartTime = 0;
     bool dryRunAlarmPending = false;
+    bool dryRunAlarmActive = false; // Сухой ход подтверждён (насосы остановлены)
+};
+
+// Коэффициенты ПИ-регулятора одного контура
+struct PiParams {
+    float Kp = 0.1f;
+    float Ki = 0.01f;
+    float Ti = 10.0f;
+};
+
+// Отопительный график, подготовленный к расчёту (см. heating_curve.h).
+// Точки отсортированы по Tн, для каждого отрезка заранее посчитан наклон,
+// а segByDegree[] сразу даёт номер отрезка для целого градуса Tн.
+#define CURVE_MAX_POINTS 12
+#define CURVE_LUT_MIN_T (-64)
+#define CURVE_LUT_SIZE 128
+struct HeatingCurve {
+    uint8_t count = 0;                 // 0 - график не задан или некорректен
+    float x[CURVE_MAX_POINTS];         // Tн, по возрастанию
+    float y[CURVE_MAX_POINTS];         // Tпод
+    float slope[CURVE_MAX_POINTS];     // (y[i+1]-y[i])/(x[i+1]-x[i])
+    uint8_t segByDegree[CURVE_LUT_SIZE];
+};
+
+// Расписание комфортного режима, подготовленное к расчёту (см. comfort.h).
+// Время - минуты от полуночи, интервал [startMin, endMin).
+#define COMFORT_MAX_INTERVALS 8
+struct ComfortInterval {
+    uint16_t startMin;
+    uint16_t endMin;
+    float reduct;
+};
+struct ComfortSchedule {
+    bool enabled = false;
+    uint8_t dayMask = 0;               // Бит d - день недели d (0 = воскресенье)
+    uint8_t count = 0;
+    ComfortInterval iv[COMFORT_MAX_INTERVALS];
+};
+
+// Копия настроек из NVS в оперативной памяти (см. settings.h).
+// Читается один раз при старте, дальше обновляется только при сохранении.
+struct AppSettings {
+    uint8_t profileIdx[CONTOUR_COUNT];  // Плитка контура (до загрузки - CUSTOM_6)
+    float tzad[6] = { 0 };              // Значение TZAD для каждой плитки
+    PiParams pi[CONTOUR_COUNT];
+    float summerCutoff = 20.0f;
+    float gvpPidDz = 2.0f;
+    float gvpPidKf = 0.5f;
+    float gvpPidMax = 5.0f;
+    bool timeWasSet = false;
+    String ctrlIndex;
+    String curvePoints;                 // JSON [{x,y},...]
+    HeatingCurve curve;                 // curvePoints в готовом к расчёту виде
+    String comfort[CONTOUR_COUNT];      // JSON {enabled,intervals,days}
+    ComfortSchedule comfortSched[CONTOUR_COUNT]; // comfort[] в готовом к расчёту виде
+    String owRom[OW_VAR_COUNT];     // Привязка переменная -> ROM ("" если нет)
+
+    AppSettings() {
+        for (uint8_t c = 0; c < CONTOUR_COUNT; c++) profileIdx[c] = TILE_CUSTOM_6;
+    }
 };
 
 
@@ -88,19 +177,161 @@ struct ContourPumpLogic {
 // --- Секция 2.1: Константные данные ---
 extern const TileDef TILES[6];
 
-#define OW_VAR_COUNT 11 // Жестко задаем количество, чтобы использовать как константу
 extern const char* OW_VARS[OW_VAR_COUNT]; // Используем константу для задания размера
 
+// Разрешение и период опроса для каждой переменной OW_VARS
+struct OwVarTiming {
+  uint8_t resolution;  // 9..12 бит
+  uint16_t periodMs;   // Период измерений
+};
+extern const OwVarTiming OW_VAR_TIMING[OW_VAR_COUNT];
+
+// Расширители портов I2C (драйверы - io_expanders.h). Логика работает с
+// логическими номерами реле (0..RELAY_COUNT-1) и входов (InputId), вывод
+// платы для каждого задают RELAY_MAP и INPUT_MAP. Вывод 16-битной платы:
+// P00..P07 / GPA0..7 - биты 0..7, P10..P17 / GPB0..7 - биты 8..15.
+enum IoBoardType : uint8_t {
+  IOX_PCF8574,    // 8 выводов, квазидвунаправленные, до 100 кГц
+  IOX_PCF8575,    // 16 выводов, квазидвунаправленные
+  IOX_MCP23017    // 16 выводов, направление и подтяжки - регистрами
+};
+struct IoBoardDef {
+  IoBoardType type;
+  uint8_t addr;
+  const char* name;     // Для /api/system/status (i2c.devices)
+  uint16_t outputs;     // Выводы-выходы, остальные - входы
+  uint16_t activeLow;   // Выходы, включаемые уровнем 0
+};
+struct IoPin {
+  uint8_t board;        // Индекс в IO_BOARDS
+  uint8_t bit;
+};
+// Окно фильтра дребезга - число одинаковых выборок подряд (1..7, выборка
+// раз в INPUT_SAMPLE_MS)
+struct InputDef {
+  IoPin pin;
+  uint8_t debounceSamples;
+  bool initial;         // Состояние до первого чтения
+};
+
+#define IO_BOARD_COUNT 2
+#define RELAY_COUNT 8
+#define INPUT_SAMPLE_MS 10
+
+// Плата KC868-A8: реле на PCF8574 0x24 (включаются нулём), входы - на 0x22
+constexpr IoBoardDef IO_BOARDS[] = {
+  { IOX_PCF8574, 0x22, "inputs", 0x0000, 0x0000 },
+  { IOX_PCF8574, 0x24, "relays", 0x00FF, 0x00FF },
+};
+constexpr IoPin RELAY_MAP[] = {
+  { 1, 0 }, { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 6 }, { 1, 7 }
+};
+// Переключатель режима дребезжит дольше, поэтому окно шире
+constexpr InputDef INPUT_MAP[] = {
+  { { 0, 0 }, 6, false }, { { 0, 1 }, 4, true }, { { 0, 2 }, 4, false }, { { 0, 3 }, 4, false },
+  { { 0, 4 }, 6, false }, { { 0, 5 }, 4, true }, { { 0, 6 }, 4, false }, { { 0, 7 }, 4, false }
+};
+
+// Проверки таблиц при сборке (C++11: constexpr-функции из одного return)
+constexpr uint8_t bitCount32(uint32_t v) {
+  return v ? (uint8_t)((v & 1) + bitCount32(v >> 1)) : 0;
+}
+constexpr uint32_t ioBoardMask(uint8_t b) {
+  return IO_BOARDS[b].type == IOX_PCF8574 ? 0x00FF : 0xFFFF;
+}
+// Выводы платы b, занятые реле (входами) с номерами меньше n, и их число
+constexpr uint32_t relayPinBits(uint8_t b, uint8_t n) {
+  return n == 0 ? 0 : relayPinBits(b, n - 1) | (RELAY_MAP[n - 1].board == b ? 1UL << RELAY_MAP[n - 1].bit : 0);
+}
+constexpr uint8_t relayPinCount(uint8_t b, uint8_t n) {
+  return n == 0 ? 0 : (uint8_t)(relayPinCount(b, n - 1) + (RELAY_MAP[n - 1].board == b ? 1 : 0));
+}
+constexpr uint32_t inputPinBits(uint8_t b, uint8_t n) {
+  return n == 0 ? 0 : inputPinBits(b, n - 1) | (INPUT_MAP[n - 1].pin.board == b ? 1UL << INPUT_MAP[n - 1].pin.bit : 0);
+}
+constexpr uint8_t inputPinCount(uint8_t b, uint8_t n) {
+  return n == 0 ? 0 : (uint8_t)(inputPinCount(b, n - 1) + (INPUT_MAP[n - 1].pin.board == b ? 1 : 0));
+}
+// Платы 0..n-1: выводы не делятся, реле - на выходах, входы - на входах,
+// всё в пределах ширины платы
+constexpr bool ioBoardsValid(uint8_t n) {
+  return n == 0 || (ioBoardsValid(n - 1) &&
+         bitCount32(relayPinBits(n - 1, RELAY_COUNT)) == relayPinCount(n - 1, RELAY_COUNT) &&
+         bitCount32(inputPinBits(n - 1, INPUT_COUNT)) == inputPinCount(n - 1, INPUT_COUNT) &&
+         (relayPinBits(n - 1, RELAY_COUNT) & ~(uint32_t)IO_BOARDS[n - 1].outputs) == 0 &&
+         (inputPinBits(n - 1, INPUT_COUNT) & IO_BOARDS[n - 1].outputs) == 0 &&
+         ((IO_BOARDS[n - 1].outputs | IO_BOARDS[n - 1].activeLow) & ~ioBoardMask(n - 1)) == 0 &&
+         ((relayPinBits(n - 1, RELAY_COUNT) | inputPinBits(n - 1, INPUT_COUNT)) & ~ioBoardMask(n - 1)) == 0);
+}
+// Реле и входов на платах 0..n-1 (меньше общего числа - ссылка на несуществующую плату)
+constexpr uint16_t ioPinsMapped(uint8_t n) {
+  return n == 0 ? 0 : (uint16_t)(ioPinsMapped(n - 1) + relayPinCount(n - 1, RELAY_COUNT) + inputPinCount(n - 1, INPUT_COUNT));
+}
+static_assert(sizeof(IO_BOARDS) / sizeof(IO_BOARDS[0]) == IO_BOARD_COUNT, "IO_BOARDS must have IO_BOARD_COUNT rows");
+static_assert(sizeof(RELAY_MAP) / sizeof(RELAY_MAP[0]) == RELAY_COUNT, "RELAY_MAP must have RELAY_COUNT rows");
+static_assert(sizeof(INPUT_MAP) / sizeof(INPUT_MAP[0]) == INPUT_COUNT, "INPUT_MAP must have INPUT_COUNT rows");
+static_assert(RELAY_COUNT <= 32 && INPUT_COUNT <= 32, "Relay and input images are 32-bit");
+static_assert(ioBoardsValid(IO_BOARD_COUNT), "RELAY_MAP/INPUT_MAP: pin shared, wrong direction or out of range");
+static_assert(ioPinsMapped(IO_BOARD_COUNT) == RELAY_COUNT + INPUT_COUNT, "RELAY_MAP/INPUT_MAP: board out of range");
+
+// Контуры. Вся логика (насосы, ПИ, комфорт, дисплей, история, API) идёт
+// по этой таблице; новый контур - строка здесь, его входы в InputId /
+// INPUT_MAP и CONTOUR_COUNT, реле - в RELAY_MAP.
+constexpr ContourDef CONTOURS[] = {
+  { IN_C1_MODE, IN_C1_DRY_RUN, { IN_PUMP1_FB, IN_PUMP2_FB }, { 3, 4 }, { 0, 1 }, 2, 1,
+    { "pi1_Kp", "pi1_Ki", "pi1_Ti" }, "c1.profile", "comfort1" },
+  { IN_C2_MODE, IN_C2_DRY_RUN, { IN_PUMP3_FB, IN_PUMP4_FB }, { 7, 0 }, { 2, 3 }, 6, 5,
+    { "pi2_Kp", "pi2_Ki", "pi2_Ti" }, "c2.profile", "comfort2" },
+};
+
+// Все насосы разрешены (2 бита маски на контур)
+#define PUMP_ENABLE_ALL ((uint8_t)((1u << (2 * CONTOUR_COUNT)) - 1))
+
+static inline constexpr bool isContour(int cont) {
+  return cont >= 1 && cont <= CONTOUR_COUNT;
+}
+
+// Проверки CONTOURS при сборке
+constexpr uint32_t contourRelayBits(uint8_t n) {
+  return n == 0 ? 0 : contourRelayBits(n - 1) | (1UL << CONTOURS[n - 1].pumpRelay[0]) |
+         (1UL << CONTOURS[n - 1].pumpRelay[1]) | (1UL << CONTOURS[n - 1].valveOpenRelay) |
+         (1UL << CONTOURS[n - 1].valveCloseRelay);
+}
+constexpr uint32_t contourEnableBits(uint8_t n) {
+  return n == 0 ? 0 : contourEnableBits(n - 1) | (1UL << CONTOURS[n - 1].pumpEnableBit[0]) |
+         (1UL << CONTOURS[n - 1].pumpEnableBit[1]);
+}
+constexpr uint32_t contourInputBits(uint8_t n) {
+  return n == 0 ? 0 : contourInputBits(n - 1) | (1UL << CONTOURS[n - 1].modeInput) |
+         (1UL << CONTOURS[n - 1].dryRunInput) | (1UL << CONTOURS[n - 1].pumpFeedback[0]) |
+         (1UL << CONTOURS[n - 1].pumpFeedback[1]);
+}
+static_assert(sizeof(CONTOURS) / sizeof(CONTOURS[0]) == CONTOUR_COUNT, "CONTOURS must have CONTOUR_COUNT rows");
+static_assert(CONTOUR_COUNT >= 1 && CONTOUR_COUNT <= 4, "globalPumpEnableMask holds 4 contours");
+static_assert(contourRelayBits(CONTOUR_COUNT) < (1ULL << RELAY_COUNT) &&
+              bitCount32(contourRelayBits(CONTOUR_COUNT)) == 4 * CONTOUR_COUNT, "CONTOURS: relay out of range or shared");
+static_assert(contourEnableBits(CONTOUR_COUNT) == PUMP_ENABLE_ALL, "CONTOURS: pump enable bits must be 0..2*CONTOUR_COUNT-1");
+static_assert(contourInputBits(CONTOUR_COUNT) < (1ULL << INPUT_COUNT) &&
+              bitCount32(contourInputBits(CONTOUR_COUNT)) == 4 * CONTOUR_COUNT, "CONTOURS: input out of range or shared");
+
 // --- Секция 2.2: Конфигурация аппаратной части (пины, адреса) ---
-#define RELAY_I2C_ADDR 0x24
 #define I2C_SDA_PIN 4
 #define I2C_SCL_PIN 5
-#define PCF8574_INPUTS_ADDR 0x22
+#define I2C_BUS_CLOCK_HZ 400000 // Предел шины (проводка, подтяжки); устройство - не быстрее своей частоты (i2c_bus.h)
+#define IO_INT_PIN 35 // INT плат входов (открытый сток, общая линия, внешняя подтяжка к 3.3 В)
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
 #define OLED_ADDR 0x3C
+#define RTC_I2C_ADDR 0x68 // DS3231
 #define BUTTON_PIN 34
 #define OW_PIN 14 // Пин для 1-Wire
+#define OW_ADDRESSED_POLLING 1 // 1 - опрос привязанных датчиков по адресу, 0 - полный поиск каждый цикл
+#ifndef WWT_NATIVE
+#define USE_RTOS_TASKS 1 // 1 - задачи FreeRTOS на двух ядрах (tasks.h), 0 - кооперативно из loop()
+#else
+#define USE_RTOS_TASKS 0 // Симулятор однопоточный
+#endif
+#define USE_ASYNC_HTTP 1 // 1 - неблокирующий сервер на AsyncTCP (http_server.h), 0 - синхронный WebServer
 
 // --- Секция 2.3: Глобальные объекты ---
 extern Preferences prefs;
@@ -108,19 +339,25 @@ extern Preferences prefsParams;
 extern Preferences prefsProfiles;
 extern Preferences prefsGeneral;
 
-extern RTC_DS3231 rtc;
-
 extern U8G2_SSD1309_128X64_NONAME0_F_HW_I2C u8g2;
-extern PIDController pidController1;
-extern PIDController pidController2;
+extern PIDController pidControllers[CONTOUR_COUNT];  // Контур cont - [cont - 1]
+extern ContourPumpLogic pumpLogic[CONTOUR_COUNT];
 
-extern ContourPumpLogic pumpLogic1;
-extern ContourPumpLogic pumpLogic2;
+#if USE_ASYNC_HTTP
+#include "http_server.h"
+extern HttpServer server;
+#else
+extern WebServer server;
+#endif
 
-extern WebServer server; // <-- ДОБАВИТЬ
+// Мьютексы общих данных между задачами (создаются в setup(), см. tasks.h)
+extern SemaphoreHandle_t ioMutex;       // relayStates, pulseEndTimes, запись в реле
+extern SemaphoreHandle_t settingsMutex; // Запись/чтение appSettings из разных задач
+extern SemaphoreHandle_t owMutex;       // Шина 1-Wire и индекс привязок
 
 // --- Секция 2.4: Глобальные переменные состояния ---
 extern uint8_t globalPumpEnableMask;
+extern AppSettings appSettings; // Только чтение; запись через settings.h
 
 // UI and Mode State // <-- ДОБАВИТЬ ЭТОТ БЛОК
 extern bool displayOn;
@@ -136,22 +373,8 @@ extern bool isInputExpanderAvailable;
 extern bool isRtcAvailable;
 
 // Состояние реле и таймеры импульсов
-extern uint8_t relayStates;
-extern unsigned long pulseEndTimes[8];
-
-// Стабильные (отфильтрованные) состояния входов
-extern int contour1_mode_stable, contour1_mode_last, contour1_mode_count;
-extern int dry_run_state_stable, dry_run_state_last, dry_run_state_count;
-extern int pump1_state_stable, pump1_state_last, pump1_state_count;
-extern int pump2_state_stable, pump2_state_last, pump2_state_count;
-extern int contour2_mode_stable, contour2_mode_last, contour2_mode_count;
-extern int dry_run_state_2_stable, dry_run_state_2_last, dry_run_state_2_count;
-extern int pump3_state_stable, pump3_state_last, pump3_state_count;
-extern int pump4_state_stable, pump4_state_last, pump4_state_count;
-
-// Переменные для отслеживания предыдущего состояния режима
-extern bool wasInAutoModeContour1;
-extern bool wasInAutoModeContour2;
+extern uint32_t relayStates;                    // Бит i - реле i включено
+extern unsigned long pulseEndTimes[RELAY_COUNT];
 
 // --- Секция 2.5: Константы --- // <-- ДОБАВИТЬ ЭТОТ БЛОК
 extern const unsigned long displayTimeout;
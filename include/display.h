@@ -0,0 +1,43 @@
+// =================================================================================
+// File:         include/display.h
+// Description:  OLED-экраны, описанные таблицами. Раз за кадр состояние системы
+//               собирается в снимок (DisplaySnapshot), экран - список строк,
+//               каждая из которых форматирует свои поля снимка в char-буфер.
+//               Экран контура строится по одному описанию для каждого контура.
+// =================================================================================
+
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include "config.h"
+
+// Экран режима точки доступа (вне листания кнопкой)
+#define SCREEN_WIFI_AP (-1)
+
+// Снимок всего, что может показать дисплей
+struct DisplayContourSnapshot {
+    char profileId[6];
+    float tsup, tret, tset, comfortReduction;
+    bool tsupAlarm, tretAlarm;
+    bool comfort, summer, pumpsAlarm, dryRunOk;
+    PumpStatus pump[2];
+};
+
+struct DisplaySnapshot {
+    bool relayBoardOk, inputBoardOk;
+    bool clockValid;
+    uint8_t hh, mm, dow;
+    float tn, t1, t2;
+    bool tnAlarm, t1Alarm, t2Alarm;
+    bool anyDryRun;
+    int apClients;
+    DisplayContourSnapshot contour[CONTOUR_COUNT];
+};
+
+void displayInit();             // До i2cBusInit() и u8g2.begin(): регистрация OLED, транспорт через i2c_bus.h
+bool displayLinkOnline();       // OLED отвечает (менеджер шины)
+void updateDisplay();           // Кадр передаётся только если видимое содержимое изменилось
+void displayInvalidate();       // Передать следующий кадр безусловно
+int displayPageCount();         // Страниц для листания кнопкой: контуры + общие
+
+#endif // DISPLAY_H
@@ -0,0 +1,75 @@
+// =================================================================================
+// File:         include/event_log.h
+// Description:  Журнал событий: переходы автомата насосов, аварии насосов,
+//               сухой ход, пропадание/возврат устройств I2C, освобождение
+//               залипшей шины I2C, импульсы клапанов.
+//               Запись фиксированная (время, код, контур, arg, value), без
+//               форматирования строк: eventLog() кладёт её в кольцо в ОЗУ без
+//               блокировок (единицы мкс, из любой задачи), задание "evlog"
+//               задачи ui раз в секунду переносит кольцо в журнал во flash
+//               (flash_log.h), где записи копятся страницами.
+//
+//               Импульсы клапанов идут каждые несколько секунд и заняли бы
+//               весь раздел за дни, поэтому во flash уходит их сводка по
+//               контуру за EVT_VALVE_WINDOW_S (подробно импульсы - в
+//               historian.h). Аварии записываются во flash сразу, но не
+//               чаще раза в EVT_SYNC_MIN_S. Запись во flash ограничена
+//               бюджетом (EVT_FLASH_BURST подряд, затем одно событие в
+//               EVT_FLASH_REFILL_S): "дребезг" автомата при неисправности не
+//               вытесняет недели истории; число пропущенных событий
+//               записывается вместе со сводкой клапанов (suppressed).
+//
+//               Выгрузка - GET /api/events (JSON, постранично):
+//                 from, to  - время UNIX (без часов записи в интервал не попадают)
+//                 code      - коды через запятую (pump_state,pump_alarm,...)
+//                 contour   - номер контура
+//                 limit     - событий в ответе (по умолчанию 50, не больше 200)
+//                 cursor    - "next" из прошлого ответа; без него - с начала журнала
+//               Ответ: {ok, events:[{t, up, boot, code, contour, arg, value}],
+//                       next, more}; more=false - дочитано до конца журнала.
+// =================================================================================
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include "config.h"
+
+#define EVT_RING_SIZE 64              // Степень двойки
+#define EVT_VALVE_WINDOW_S 600       // Период сводок (клапаны, suppressed)
+#define EVT_FLASH_BURST 60
+#define EVT_FLASH_REFILL_S 30         // 120 событий в час после исчерпания запаса
+#define EVT_SYNC_MIN_S 300
+
+enum EventCode : uint8_t {
+    EVT_PUMP_STATE = 1,               // arg - новое состояние автомата, value - прежнее
+    EVT_PUMP_ALARM,                   // arg - насос 1/2, value - 0 нет ОС при пуске, 1 потеря ОС
+    EVT_DRY_RUN,                      // arg - 1 подтверждён, 0 снят
+    EVT_I2C_OFFLINE,                  // arg - адрес, value - счётчик ошибок
+    EVT_I2C_ONLINE,                   // arg - адрес
+    EVT_VALVE_PULSE,                  // Только в кольце: arg - 1 открыть, 0 закрыть, value - мс
+    EVT_VALVE_SUMMARY,                // Во flash: arg - открытий << 8 | закрытий,
+                                      // value - мс открытия / 100 << 16 | мс закрытия / 100
+    EVT_SUPPRESSED,                   // value - событий не записано сверх бюджета
+    EVT_I2C_RECOVERY,                 // Залипшая шина: arg - тактов SCL, value - 1 SDA освободилась
+    EVT_CODE_COUNT
+};
+
+// Записать событие (любая задача; ISR - нет). contour 0 - не относится к контуру.
+void eventLog(EventCode code, uint8_t contour, uint16_t arg, uint32_t value);
+
+// Перенос кольца во flash (задача ui, задание "evlog")
+void eventLogDrain();
+
+// Обработчик GET /api/events (задача web)
+void handleEvents();
+
+// Для /api/system/status
+struct EventLogInfo {
+    uint32_t logged;            // Принято в кольцо с включения
+    uint32_t dropped;           // Кольцо было полно
+    uint32_t stored;            // Записано в журнал во flash
+    uint32_t suppressed;        // Не записано сверх бюджета flash
+};
+EventLogInfo eventLogInfo();
+
+#endif // EVENT_LOG_H
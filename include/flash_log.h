@@ -0,0 +1,88 @@
+// =================================================================================
+// File:         include/flash_log.h
+// Description:  Журнал во flash на недели работы: раз в FLOG_PERIOD_S снимок
+//               температур OW_VARS, уставок и состояния насосной логики
+//               контуров. Журнал живёт в неиспользуемом разделе данных
+//               "spiffs" таблицы default.csv (1.4 МБ) без файловой системы.
+//
+//               Устройство:
+//                 сегмент  = сектор 4 КБ = FLOG_SEG_PAGES страниц по 256 байт;
+//                            сегменты пишутся по кругу и стираются перед
+//                            повторным использованием - износ равномерный
+//                 страница = заголовок (магия, номер загрузки, номер
+//                            сегмента, CRC) + записи [len][type][данные][CRC16];
+//                            len 0xFF - конец записей страницы
+//               Записи копятся в странице в ОЗУ, во flash уходят только целые
+//               страницы, каждая ровно один раз. При отключении питания
+//               теряется только недописанная страница (до ~10 мин); после
+//               включения хвост находится по заголовкам: старший номер
+//               сегмента и первая чистая страница в нём.
+//
+//               Выгрузка - GET /api/flashlog (поток, см. stream_export.h), CSV:
+//                 unix,uptime,boot,<OW_VARS>,c<N>.tzavd,c<N>.state,c<N>.active,
+//                 c<N>.summer,c<N>.p1,c<N>.p2
+//               from, to - время UNIX (записи без установленных часов при
+//               заданном интервале пропускаются).
+// =================================================================================
+
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+#include "config.h"
+
+#define FLOG_PERIOD_S 120             // Снимок раз в 2 мин: 368 секторов - ~40 суток
+#define FLOG_PAGE_BYTES 256
+#define FLOG_SEG_PAGES 16             // Страниц в секторе 4 КБ
+
+enum FlashLogRecType : uint8_t { FLOG_REC_SNAPSHOT = 1, FLOG_REC_EVENT = 2 };
+
+// Найти раздел и хвост журнала (setup(), до startTasks())
+void flashLogInit();
+
+// Снимок в журнал (задача ui, задание "flog" раз в FLOG_PERIOD_S)
+void flashLogTick();
+
+// Дописать запись (только из задачи ui - единственный писатель журнала)
+bool flashLogAppend(uint8_t type, const uint8_t* data, uint8_t len);
+
+// Записать неполную страницу сейчас (важные события; остаток страницы
+// пропадает, поэтому не для частых записей). Задача ui.
+void flashLogSync();
+
+// Курсор чтения журнала по порядку записи. Позиция (seq, page, pos)
+// переживает запросы: курсор можно сохранить и продолжить позже.
+struct FlashLogCursor {
+    uint32_t seq;               // Сегмент и страница следующей записи
+    uint8_t page;
+    uint16_t pos;               // Смещение в странице (0 - с начала)
+    uint16_t boot;              // Номер загрузки текущей страницы
+    bool loaded;
+    bool fromRam;               // Страница - копия недописанной из ОЗУ
+    uint16_t pagesRead;         // Прочитано страниц flash (ограничение работы)
+    uint8_t buf[FLOG_PAGE_BYTES];
+};
+
+// На самую старую запись журнала
+void flashLogRewind(FlashLogCursor& c);
+
+// Следующая запись (data указывает в c.buf); false - записей пока больше нет
+bool flashLogNext(FlashLogCursor& c, uint8_t& type, const uint8_t*& data, uint8_t& len);
+
+// Обработчик GET /api/flashlog (задача web, выгрузка - stream_export)
+void handleFlashLog();
+
+// Для /api/system/status
+struct FlashLogInfo {
+    bool available;
+    uint16_t bootId;
+    uint32_t segments;          // Сегментов в разделе
+    uint32_t headSeq;           // Номер текущего сегмента
+    uint32_t records;           // Записано с включения
+    uint32_t pagesWritten;
+    uint32_t erases;
+    uint32_t errors;            // Ошибки записи/стирания
+    uint32_t crcErrors;         // Битые записи, найденные при выгрузках
+};
+FlashLogInfo flashLogInfo();
+
+#endif // FLASH_LOG_H
@@ -12,11 +12,12 @@ void manageI2CDevices();
 void handleButton();
 void handleWifiAndServer();
 void checkDisplayTimeout();
-void checkRelayPulses();
-void updateDisplay();
-void updateRelays();
+uint32_t checkRelayPulses(); // Мс до окончания ближайшего импульса (SCHED_NEVER - импульсов нет)
+bool commitRelays(); // Записать relayStates в платы реле, изменившиеся с прошлой записи; false - запись не подтверждена
 void triggerRelayPulse(int relayIndex, unsigned long duration);
 void setRelay(int relayIndex, bool on);
+bool rtcRead(DateTime& dt);          // Время DS3231; false - часы не ответили
+bool rtcAdjust(const DateTime& dt);  // Установить время и снять флаг OSF
 
 
 #endif // HARDWARE_H
@@ -0,0 +1,20 @@
+// =================================================================================
+// File:         include/heating_curve.h
+// Description:  Отопительный график: разбор JSON-точек один раз при загрузке
+//               или сохранении и быстрый расчёт Tпод по Tн без JSON и сортировки.
+// =================================================================================
+
+#ifndef HEATING_CURVE_H
+#define HEATING_CURVE_H
+
+#include "config.h"
+
+// Разбирает JSON [{x,y},...] (2..CURVE_MAX_POINTS точек, Tн без повторов,
+// в пределах таблицы segByDegree). При ошибке out.count = 0 и возвращает false.
+bool curveCompile(const String& json, HeatingCurve& out);
+
+// Линейная интерполяция по графику; за краями - крайние значения.
+// NAN, если график не задан.
+float curveEvaluate(const HeatingCurve& curve, float tn);
+
+#endif // HEATING_CURVE_H
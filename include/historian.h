@@ -0,0 +1,69 @@
+// =================================================================================
+// File:         include/historian.h
+// Description:  Журнал истории в ОЗУ: температуры OW_VARS, уставки контуров
+//               (раз в HIST_SAMPLE_MS), импульсы клапанов и смены состояния
+//               насосов. Память фиксированная - кольцо из HIST_BLOCK_COUNT
+//               блоков по HIST_BLOCK_BYTES; при заполнении затирается самый
+//               старый блок. Время - секунды от включения (история в ОЗУ
+//               живёт до перезагрузки).
+//
+//               Сжатие: значения в 1/16 °C, каждый канал пишется разницей с
+//               прошлым отсчётом в шагах своего датчика (разрешение из
+//               OW_VAR_TIMING): без изменений / ±1 / ±2 / ±3..18 шагов /
+//               значение целиком (и "нет данных"). Импульсы клапанов
+//               копятся до отсчёта и пишутся в него: по контуру - не было,
+//               один импульс прошлой длительности или счётчики и суммы.
+//               Всё это кодирует двоичный арифметический кодер с адаптивными
+//               вероятностями (контекст канала - знак прошлой разницы), так
+//               что частые случаи стоят долей бита. 13 каналов и 2 клапана
+//               ПИ - ~2,4 байта на отсчёт, 64 КБ - ~3 суток (эмулятор).
+//               Блок начинается с опорных значений и исходных вероятностей
+//               и декодируется сам по себе.
+//
+//               Выгрузка - GET /api/history (поток, см. stream_export.h):
+//                 from, to  - секунды от включения (или last - секунд назад)
+//                 step      - усреднение по интервалам, с (0 - все отсчёты)
+//                 ch        - каналы через запятую (T11,c1.tzavd; по умолчанию все)
+//                 fmt=csv   - "t,<каналы>", пустое поле - нет данных
+//                 fmt=bin   - строки uint32 t + int16 на канал (1/16 °C,
+//                             -32768 - нет данных), little-endian;
+//                             порядок каналов - в заголовке X-Hist-Channels
+//                 kind=events - события CSV: t,contour,event,dir,n,ms,state,p1,p2,active;
+//                             клапан - строка на направление за период отсчёта
+//                             (n импульсов, ms суммарно), t - время отсчёта
+// =================================================================================
+
+#ifndef HISTORIAN_H
+#define HISTORIAN_H
+
+#include "config.h"
+
+#define HIST_SAMPLE_MS 10000
+#define HIST_BLOCK_BYTES 2048
+#define HIST_BLOCK_COUNT 32           // 64 КБ в .bss
+#define HIST_CHANNELS (OW_VAR_COUNT + CONTOUR_COUNT)
+
+// Отсчёт всех каналов (задача control, задание "hist")
+void histRecordSample();
+
+// Импульс клапана контура (1..CONTOUR_COUNT): dir 1 - открыть, -1 - закрыть
+void histValvePulse(uint8_t contour, int8_t dir, uint32_t durationMs);
+
+// Состояние насосов контуров изменилось с прошлой записи - в журнал (задача control)
+void histRecordPumps();
+
+// Обработчик GET /api/history (задача web, выгрузка - stream_export)
+void handleHistory();
+
+// Для /api/system/status
+struct HistInfo {
+    uint32_t now;            // Секунды от включения
+    uint32_t from;           // Самая старая запись
+    uint32_t samples;        // Отсчётов в памяти
+    uint32_t events;
+    uint32_t usedBytes;
+    uint32_t capacityBytes;
+};
+HistInfo histInfo();
+
+#endif // HISTORIAN_H
@@ -0,0 +1,201 @@
+// =================================================================================
+// File:         include/http_server.h
+// Description:  Неблокирующий HTTP-сервер поверх AsyncTCP (USE_ASYNC_HTTP).
+//               Приём соединений и сборка запроса идут в задаче AsyncTCP и
+//               только копируют байты в буфер слота; обработчики маршрутов
+//               вызываются из задачи web (handleClient), не больше одного
+//               запроса за проход. Ответ уходит порциями по свободному окну
+//               TCP (по подтверждениям), поэтому медленный или зависший
+//               клиент не держит ни задачу web, ни loop() в кооперативном
+//               режиме. Интерфейс обработчиков - как у WebServer: маршруты
+//               из initializeWebInterface() не меняются.
+//
+//               Ограничения: HTTP_MAX_CONNS соединений (лишние закрываются
+//               сразу), запрос с заголовками и телом - до HTTP_RX_BYTES,
+//               от первого байта запроса до конца ответа - не дольше
+//               HTTP_REQUEST_TIMEOUT_MS, keep-alive - HTTP_KEEPALIVE_MS
+//               простоя и HTTP_KEEPALIVE_MAX запросов на соединение.
+// =================================================================================
+
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <WebServer.h> // HTTPMethod
+#include <AsyncTCP.h>
+#include <functional>
+
+#define HTTP_MAX_CONNS 5
+#define HTTP_MAX_ROUTES 32           // Сейчас занято 20 (web_interface.cpp); переполнение - abort()
+#define HTTP_MAX_ARGS 8
+#define HTTP_MAX_HEADERS 4            // Заголовки из collectHeaders()
+#define HTTP_RX_BYTES 3072
+#define HTTP_REQUEST_TIMEOUT_MS 3000
+#define HTTP_KEEPALIVE_MS 5000
+#define HTTP_KEEPALIVE_MAX 32
+#define HTTP_PASS_BUDGET_US 20000     // Отправка ответов за один проход handleClient()
+#define HTTP_CHUNK_BYTES 512          // Буфер потокового ответа (beginChunked)
+
+class HttpServer;
+
+// Соединение, отданное обработчиком под поток (SSE): запросы по нему больше
+// не принимаются, таймауты сервера не действуют. Ведёт себя как WiFiClient
+// с неблокирующей записью: write() пишет кадр целиком или ничего.
+class HttpStream {
+public:
+    HttpStream() {}
+    uint8_t connected() const;
+    size_t write(const uint8_t* buf, size_t n);
+    void stop();
+    void setNoDelay(bool nodelay) { (void)nodelay; }
+
+private:
+    friend class HttpServer;
+    HttpStream(HttpServer* owner, uint8_t slot, uint8_t gen) : srv(owner), slot(slot), gen(gen) {}
+    HttpServer* srv = nullptr;
+    uint8_t slot = 0;
+    uint8_t gen = 0;
+};
+
+// Тело ответа chunked (см. HttpServer::beginChunked): куски по HTTP_CHUNK_BYTES
+// пишутся прямо в окно TCP. Окно к началу ответа пустое, поэтому ответ
+// меньше окна (~5,7 КБ) не копируется ни в String, ни в кучу.
+class HttpChunkWriter : public Print {
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t n) override;
+    using Print::write;
+
+private:
+    friend class HttpServer;
+    void flushChunk();
+    HttpServer* srv = nullptr;          // nullptr - ответа нет, запись отбрасывается
+    uint16_t len = 0;
+    char buf[6 + HTTP_CHUNK_BYTES + 2]; // Место под размер куска и CRLF
+};
+
+// Счётчики для /api/system/status
+struct HttpServerStats {
+    uint32_t accepted;
+    uint32_t rejected;      // Пул занят
+    uint32_t requests;
+    uint32_t timeouts;      // Закрыты по бюджету запроса
+    uint32_t oversized;     // Запрос не влез в HTTP_RX_BYTES
+    uint32_t spilled;       // Потоковый ответ не влез в окно TCP - остаток в куче
+    uint32_t maxPassUs;     // Самый долгий проход handleClient()
+};
+
+class HttpServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit HttpServer(uint16_t port);
+
+    void begin();
+    void stop();              // Закрывает и все открытые соединения
+    void handleClient();      // Из задачи web
+
+    void on(const String& uri, HTTPMethod method, THandlerFunction fn);
+    void on(const String& uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void onNotFound(THandlerFunction fn) { notFound = fn; }
+    void collectHeaders(const char* headerKeys[], size_t headerKeysCount);
+
+    // --- Текущий запрос (только внутри обработчика) ---
+    String uri() const { return reqUri; }
+    HTTPMethod method() const { return reqMethod; }
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    String header(const String& name) const;
+    HttpStream client();      // Забрать соединение под поток
+
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void send(int code, const char* content_type = NULL, const String& content = String());
+    void send(int code, const String& content_type, const String& content) { send(code, content_type.c_str(), content); }
+    void send(int code, const char* content_type, const char* content) { send(code, content_type, String(content)); }
+    void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+    // Потоковый ответ (Transfer-Encoding: chunked): заголовок уходит сразу, тело
+    // пишется в возвращённый Print; завершает endChunked() или конец обработчика
+    Print& beginChunked(int code, const char* content_type);
+    void endChunked();
+
+    uint8_t activeConnections() const;
+    const HttpServerStats& stats() const { return counters; }
+
+private:
+    friend class HttpStream;
+    friend class HttpChunkWriter;
+
+    enum ConnState : uint8_t { CONN_FREE, CONN_READING, CONN_READY, CONN_SENDING, CONN_STREAM, CONN_CLOSING, CONN_CLOSED };
+
+    struct Conn {
+        AsyncClient* tcp;
+        volatile ConnState state;
+        uint8_t gen;            // Меняется при каждом новом соединении в слоте
+        uint8_t served;         // Запросов по этому соединению (keep-alive)
+        bool keepAlive;
+        bool oversized;         // Запрос не влез в буфер - ответ 413 и закрытие
+        uint16_t rxLen;
+        uint16_t reqLen;        // Длина собранного запроса (заголовки + тело)
+        uint32_t startMs;       // Первый байт запроса
+        uint32_t lastMs;        // Последняя активность
+        char rx[HTTP_RX_BYTES];
+        // Ответ: заголовок и тело (своя строка или массив во flash)
+        String head;
+        String body;
+        const char* bodyPtr;
+        size_t bodyLen;
+        size_t sent;            // Передано в AsyncTCP байт из head + body
+        size_t acked;           // Из них подтверждено клиентом (вместе с direct)
+        size_t direct;          // Записано сразу в окно TCP (потоковый ответ)
+        bool bodyInFlash;
+    };
+
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction fn;
+    };
+
+    // Колбэки AsyncTCP (задача async_tcp)
+    static void onConnect(void* arg, AsyncClient* tcp);
+    static void onData(void* arg, AsyncClient* tcp, void* data, size_t len);
+    static void onAck(void* arg, AsyncClient* tcp, size_t len, uint32_t time);
+    static void onDisconnect(void* arg, AsyncClient* tcp);
+    int8_t slotOf(AsyncClient* tcp) const;
+    static uint16_t requestLength(const char* buf, uint16_t len);
+
+    // Задача web
+    void dispatch(uint8_t i);
+    bool parseRequest(Conn& c);
+    void queueResponse(int code, const char* content_type, size_t contentLength);
+    bool pump(Conn& c);
+    void finish(uint8_t i);
+    void closeConn(Conn& c);
+    void emit(Conn& c, const char* data, size_t len);
+
+    uint16_t port;
+    AsyncServer* listener = nullptr;
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    Conn conns[HTTP_MAX_CONNS];
+    Route routes[HTTP_MAX_ROUTES];
+    uint8_t routeCount = 0;
+    THandlerFunction notFound;
+    const char* headerKeys[HTTP_MAX_HEADERS];
+    uint8_t headerKeyCount = 0;
+    HttpServerStats counters = {};
+
+    // Текущий запрос
+    int8_t cur = -1;
+    bool responded = false;
+    HTTPMethod reqMethod = HTTP_ANY;
+    String reqUri;
+    String argNames[HTTP_MAX_ARGS];
+    String argValues[HTTP_MAX_ARGS];
+    uint8_t argCount = 0;
+    String headerValues[HTTP_MAX_HEADERS];
+    String pendingHeaders;
+    HttpChunkWriter chunkWriter;
+    bool chunkedOpen = false;
+};
+
+#endif // HTTP_SERVER_H
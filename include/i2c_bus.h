@@ -0,0 +1,96 @@
+// =================================================================================
+// File:         include/i2c_bus.h
+// Description:  Менеджер шины I2C - единственный владелец Wire. Модули
+//               регистрируют свои устройства (адрес, предельная частота,
+//               таймаут) и обмениваются с ними транзакциями: запись, чтение
+//               или запись + чтение с повторным START.
+//
+//               Транзакции разных задач выстраиваются в очередь на мьютексе
+//               шины (FreeRTOS пропускает ожидающих по приоритету, задача
+//               control - первой); ожидание ограничено I2C_QUEUE_WAIT_MS.
+//               Перед транзакцией шина переключается на частоту и таймаут
+//               устройства, поэтому зависшее устройство стоит свой короткий
+//               таймаут, а не таймаут Wire по умолчанию (50 мс).
+//
+//               После I2C_OFFLINE_ERRORS ошибок подряд устройство переходит в
+//               offline: транзакции с ним сразу возвращают I2C_OFFLINE, не
+//               занимая шину, а задание "i2c" задачи ui пробует его адрес с
+//               экспоненциальной паузой (I2C_BACKOFF_MIN_MS ... MAX_MS).
+//
+//               Залипшая шина (ведомый, сброшенный посреди чтения, держит SDA
+//               в 0) освобождается тактами SCL вручную и STOP - при старте и
+//               после таймаута, если SDA осталась в 0.
+// =================================================================================
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include "config.h"
+
+#define I2C_MAX_DEVICES 8
+#define I2C_QUEUE_WAIT_MS 50
+#define I2C_OFFLINE_ERRORS 3
+#define I2C_BACKOFF_MIN_MS 1000
+#define I2C_BACKOFF_MAX_MS 60000
+#define I2C_RATE_WINDOW_MS 60000      // Окно для доли ошибок
+
+enum I2CResult : uint8_t {
+    I2C_OK = 0,
+    I2C_NACK,                         // Нет ACK на адрес или данные
+    I2C_TIMEOUT,                      // Истёк таймаут устройства (растяжка SCL, залипание)
+    I2C_BUS_ERROR,                    // Прочие ошибки контроллера
+    I2C_OFFLINE,                      // Устройство в offline - шина не трогалась
+    I2C_BUSY                          // Шина занята дольше I2C_QUEUE_WAIT_MS
+};
+
+// Регистрация устройства (до i2cBusInit или до запуска задач).
+// maxClockHz - предельная частота устройства (шина - не выше I2C_BUS_CLOCK_HZ).
+// -1 - таблица заполнена.
+int8_t i2cRegister(uint8_t addr, const char* name, uint32_t maxClockHz, uint16_t timeoutMs);
+
+// Wire.begin, освобождение залипшей шины, опрос всех зарегистрированных
+// устройств (печатает ONLINE/OFFLINE)
+void i2cBusInit();
+
+// Транзакция: txLen байт записи, затем rxLen байт чтения (повторный START).
+// Любая из частей может быть пустой.
+I2CResult i2cTransfer(int8_t dev, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen);
+
+static inline I2CResult i2cWrite(int8_t dev, const uint8_t* data, uint8_t len) {
+    return i2cTransfer(dev, data, len, nullptr, 0);
+}
+
+static inline I2CResult i2cRead(int8_t dev, uint8_t* data, uint8_t len) {
+    return i2cTransfer(dev, nullptr, 0, data, len);
+}
+
+bool i2cOnline(int8_t dev);
+
+// Пробы устройств в offline по сроку паузы, окно доли ошибок (задача ui)
+void i2cBusTick();
+
+// Для /api/system/status
+struct I2CDeviceInfo {
+    const char* name;
+    uint8_t addr;
+    bool online;
+    uint32_t transactions;      // Выполнено на шине (с пробами)
+    uint32_t errors;
+    uint32_t nacks;
+    uint32_t timeouts;
+    uint32_t skipped;           // Отклонено без шины (offline)
+    uint16_t errorRatePm;       // Ошибок на 1000 транзакций за прошлое окно
+    uint32_t backoffMs;         // Пауза до следующей пробы (offline)
+    uint32_t maxUs;             // Самая долгая транзакция
+};
+struct I2CBusInfo {
+    uint32_t clockHz;           // Предел шины
+    uint32_t recoveries;        // Освобождений залипшей шины
+    uint32_t busy;              // Транзакций, не дождавшихся шины
+};
+
+uint8_t i2cDeviceCount();
+I2CDeviceInfo i2cDeviceInfo(uint8_t i);
+I2CBusInfo i2cBusInfo();
+
+#endif // I2C_BUS_H
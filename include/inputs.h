@@ -0,0 +1,35 @@
+// =================================================================================
+// File:         include/inputs.h
+// Description:  Логический образ дискретных входов (бит id - вход InputId)
+//               и фильтр дребезга на вертикальных счётчиках. Каждая плата с
+//               входами читается одной транзакцией, все её выводы (до 16)
+//               фильтруются одновременно несколькими побитовыми операциями.
+//               У каждого входа свой счётчик (3 бита, хранятся "по
+//               вертикали" в трёх словах) и своё окно стабильности из
+//               INPUT_MAP.
+// =================================================================================
+
+#ifndef INPUTS_H
+#define INPUTS_H
+
+#include "config.h"
+
+// Начальный образ и окна фильтра из INPUT_MAP (платы регистрирует
+// ioBoardsInit())
+void inputsInit();
+
+// Выборка со всех плат с входами. true - изменился хотя бы один стабильный вход;
+// recheckMs - через сколько мс нужна следующая выборка, пока фильтр
+// не устоялся (SCHED_NEVER - все входы устоялись).
+bool inputsSample(uint32_t& recheckMs);
+
+// Стабильное состояние входа
+bool inputGet(InputId id);
+
+// Логический образ целиком (бит id - вход id)
+uint32_t inputsImage();
+
+// Все платы с входами отвечают (менеджер шины)
+bool inputsOnline();
+
+#endif // INPUTS_H
@@ -0,0 +1,41 @@
+// =================================================================================
+// File:         include/io_expanders.h
+// Description:  Драйверы расширителей портов I2C из IO_BOARDS: PCF8574,
+//               PCF8575, MCP23017. Плата читается и пишется целиком, одной
+//               транзакцией за такт: все выводы - одним словом (бит i -
+//               вывод i, см. IoPin). Какие выводы чьи - решают inputs.h и
+//               реле (hardware.h) по INPUT_MAP / RELAY_MAP.
+//
+//               PCF857x квазидвунаправленные: на выводы-входы всегда пишется
+//               1, запись подтверждается обратным чтением в той же транзакции.
+//
+//               MCP23017 настраивается при первом обращении и после любой
+//               ошибки обмена (в том числе после offline): сначала OLAT
+//               (выходы сразу в заданном состоянии), затем одной записью
+//               с 0x00 - IODIR, GPINTEN и GPPU для входов, IOCON: MIRROR
+//               и ODR - INT открытый сток на общей линии IO_INT_PIN.
+//               Запись идёт в GPIO с повторным START и чтением OLAT и IODIR
+//               (после 0x15 указатель регистров переходит на 0x00), чтение -
+//               GPIO, OLAT, IODIR. IODIR, не совпавший с настройкой, значит
+//               сброс микросхемы по питанию - плата настраивается заново.
+// =================================================================================
+
+#ifndef IO_EXPANDERS_H
+#define IO_EXPANDERS_H
+
+#include "config.h"
+
+// Регистрация плат в менеджере шины (до i2cBusInit)
+void ioBoardsInit();
+
+// Уровни всех выводов платы; false - плата не ответила или сброшена
+bool ioBoardRead(uint8_t board, uint16_t& pins);
+
+// Уровни выходов платы (биты outputs, остальные игнорируются);
+// false - запись не подтверждена
+bool ioBoardWrite(uint8_t board, uint16_t levels);
+
+// Плата отвечает (менеджер шины)
+bool ioBoardOnline(uint8_t board);
+
+#endif // IO_EXPANDERS_H
@@ -0,0 +1,67 @@
+// =================================================================================
+// File:         include/json_writer.h
+// Description:  Потоковая запись JSON без документа ArduinoJson и без String:
+//               значения сразу уходят в Print (ответ HTTP кусками chunked).
+//               Запятые и вложенность писатель расставляет сам; ключ
+//               nullptr - элемент массива. Порядок полей - порядок вызовов.
+//
+//                 JsonResponse w;              // 200, application/json
+//                 w.beginObject();
+//                 w.field("ok", true);
+//                 w.beginArray("vars");
+//                 w.beginObject().field("name", "T11").field("t", 21.5f).endObject();
+//                 w.endArray();
+//                 w.endObject();               // Ответ завершит деструктор
+// =================================================================================
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include "config.h"
+
+#define JSON_WRITER_MAX_DEPTH 16
+
+class JsonWriter {
+public:
+    explicit JsonWriter(Print& out) : out(out) {}
+
+    JsonWriter& beginObject(const char* key = nullptr);
+    JsonWriter& endObject();
+    JsonWriter& beginArray(const char* key = nullptr);
+    JsonWriter& endArray();
+
+    JsonWriter& field(const char* key, const char* value);   // nullptr -> null
+    JsonWriter& field(const char* key, const String& value) { return field(key, value.c_str()); }
+    JsonWriter& field(const char* key, bool value);
+    JsonWriter& field(const char* key, int value) { return field(key, (long)value); }
+    JsonWriter& field(const char* key, unsigned value) { return field(key, (unsigned long)value); }
+    JsonWriter& field(const char* key, long value);
+    JsonWriter& field(const char* key, unsigned long value);
+    JsonWriter& field(const char* key, float value);        // NaN/inf -> null
+    JsonWriter& fieldNull(const char* key);
+    // Готовый JSON (например, строка из NVS, сохранённая serializeJson); пустая - null
+    JsonWriter& fieldRaw(const char* key, const char* json);
+
+protected:
+    Print& out;
+
+private:
+    void prefix(const char* key);
+    void writeString(const char* s);
+
+    uint8_t depth = 0;
+    uint16_t hasItems = 0; // Бит уровня: в контейнере уже есть элементы
+};
+
+// Ответ JSON на текущий запрос сервера: заголовок уходит сразу, тело -
+// кусками через небольшой буфер сервера (Transfer-Encoding: chunked).
+// Ответ завершается в деструкторе.
+class JsonResponse : public JsonWriter {
+public:
+    explicit JsonResponse(int code = 200);
+    ~JsonResponse();
+    JsonResponse(const JsonResponse&) = delete;
+    JsonResponse& operator=(const JsonResponse&) = delete;
+};
+
+#endif // JSON_WRITER_H
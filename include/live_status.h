@@ -0,0 +1,29 @@
+// =================================================================================
+// File:         include/live_status.h
+// Description:  Живой канал состояния для веб-интерфейса (Server-Sent Events,
+//               GET /api/live). Вместо пяти опросов страница держит одно
+//               соединение: при подключении получает полный снимок полей
+//               (event: full), затем - только изменившиеся поля (event: delta).
+//               Каждое событие несёт номер версии; пропуск версии на стороне
+//               браузера - повод переподключиться за новым снимком.
+//               Поля плоские, ключи повторяют JSON старых эндпоинтов:
+//               "c1.tzavd", "rtc.time", "vars.T11" и т. д.
+// =================================================================================
+
+#ifndef LIVE_STATUS_H
+#define LIVE_STATUS_H
+
+#include "config.h"
+
+#define LIVE_MAX_CLIENTS 3
+
+// Обработчик GET /api/live (задача web)
+void handleLiveSubscribe();
+
+// Сравнить поля с последним кадром и разослать дельту подписчикам (задача web).
+// Возвращает мс до следующего служебного пинга (SCHED_NEVER - подписчиков нет).
+uint32_t livePublish();
+
+uint8_t liveClientCount();
+
+#endif // LIVE_STATUS_H
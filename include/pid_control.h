@@ -13,6 +13,9 @@
 // Запуск итерации ПИ-регулятора для указанного контура (1 или 2)
 void runPIDLogic(int contourNum);
 
+// Сбросить интеграл контура из любой задачи (выполнит runPIDLogic)
+void pidRequestReset(uint8_t contourNum);
+
 // Рассчитывает целевую температуру (уставку) для контура
 float calculateSetpoint(int contourNum, bool& isComfortActive, float& comfortReduction);
 
@@ -0,0 +1,73 @@
+// =================================================================================
+// File:         include/profiler.h
+// Description:  Профилировщик этапов работы: время каждого задания
+//               планировщика (кнопка, сервер, I2C, 1-Wire, входы, ПИ, насосы,
+//               дисплей, реле...), проход планировщика задачи целиком и
+//               опоздание заданий относительно срока (джиттер).
+//
+//               Время - по счётчику тактов CPU (ESP.getCycleCount()),
+//               длинные интервалы (счётчик переполняется за ~17 с при
+//               240 МГц) - по micros(). По каждому этапу: число, мин., сред.,
+//               макс. и гистограмма по степеням двойки микросекунд:
+//                 корзина 0 - меньше 1 мкс, корзина i - [2^(i-1), 2^i) мкс,
+//                 последняя - от 2^(PERF_BUCKETS-2) мкс (~4 с) и больше.
+//               Запись - несколько десятков тактов, без блокировок: этап
+//               пишет только его задача. Сброс - поколением: задача обнулит
+//               свой этап при следующей записи, читатели видят нули сразу.
+//
+//               Доступ: GET /api/perf, POST /api/perf/reset; в Serial -
+//               команды "perf" и "perf reset".
+// =================================================================================
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "config.h"
+
+#define PERF_MAX_STAGES 32
+#define PERF_BUCKETS 24
+
+struct PerfStat {
+    const char* group;          // Задача
+    const char* name;           // Этап
+    uint32_t gen;               // Поколение сброса, к которому относятся данные
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxUs;
+    uint64_t sumCycles;
+    uint32_t hist[PERF_BUCKETS];
+};
+
+// Начало измерения
+struct PerfMark {
+    uint32_t cycles;
+    uint32_t us;
+};
+
+static inline PerfMark perfStart() {
+    PerfMark m;
+    m.cycles = ESP.getCycleCount();
+    m.us = (uint32_t)micros();
+    return m;
+}
+
+// Регистрация этапа (до запуска задач); -1 - таблица заполнена
+int8_t perfRegister(const char* group, const char* name);
+
+// Конец измерения этапа id (только из задачи-владельца этапа)
+void perfStop(int8_t id, const PerfMark& m);
+
+// Записать готовую длительность в мкс (опоздание задания и т.п.)
+void perfRecordUs(int8_t id, uint32_t us);
+
+// Сбросить все этапы (из любой задачи)
+void perfReset();
+
+// Обработчики GET /api/perf и POST /api/perf/reset
+void handlePerf();
+void handlePerfReset();
+
+// Команды из Serial (задача ui, задание "console")
+void perfSerialPoll();
+
+#endif // PROFILER_H
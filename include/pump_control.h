@@ -13,6 +13,10 @@
 // Главная функция, запускающая логику для одного из контуров
 void runPumpLogic(int contourNum);
 
+// Перевести автомат контура в S_IDLE из любой задачи: pumpLogic меняет
+// только задача control, запрос она выполнит в начале runPumpLogic
+void pumpLogicRequestIdle(uint8_t contourNum);
+
 // Вспомогательная функция для получения статуса насоса в виде строки
 const char* getPumpStatusString(PumpStatus status);
 
@@ -0,0 +1,59 @@
+// =================================================================================
+// File:         include/scheduler.h
+// Description:  Планировщик заданий по срокам (deadline) для задач FreeRTOS.
+//               Модуль регистрирует периодические и однократные задания;
+//               задача выполняет те, срок которых наступил, и спит до
+//               ближайшего следующего срока. Периодические задания идут по
+//               точной сетке периода, без собственных проверок millis().
+// =================================================================================
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "config.h"
+
+#define SCHED_MAX_JOBS 10          // На задачу; сейчас больше всех у ui - 6
+#define SCHED_NEVER 0xFFFFFFFFUL // Нет запланированных заданий / импульсов
+
+typedef void (*SchedJobFn)();
+
+struct SchedJob {
+    const char* name;
+    SchedJobFn fn;
+    uint32_t periodUs;      // 0 - однократное (взводится schedArm)
+    uint32_t dueUs;         // Срок по micros()
+    bool armed;
+    uint32_t runs;
+    uint32_t skipped;       // Пропущенные периоды (задание опоздало больше чем на период)
+    uint32_t maxLateUs;     // Самое большое опоздание относительно срока
+    int8_t perfId;          // Этап профилировщика (profiler.h)
+};
+
+struct Scheduler {
+    const char* name = nullptr;     // Имя задачи (группа этапов профилировщика)
+    int8_t latePerf = -1;           // Этап "опоздание заданий" профилировщика
+    SchedJob jobs[SCHED_MAX_JOBS];
+    uint8_t count = 0;
+    TaskHandle_t owner = nullptr;   // Задача, которую будит schedArm из другой задачи
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    volatile uint32_t isrPending = 0; // Бит id - задание взведено из прерывания
+};
+
+// Регистрация (до запуска задач). Возвращают номер задания; если задание
+// не встало (нет места, нет функции, период 0) - сообщение в Serial и
+// abort(), а не задание, которое молча никогда не выполнится.
+// Каждое задание - отдельный этап профилировщика в группе s.name.
+int8_t schedAddPeriodic(Scheduler& s, const char* name, SchedJobFn fn, uint32_t periodMs, uint32_t phaseMs = 0);
+int8_t schedAddOneShot(Scheduler& s, const char* name, SchedJobFn fn);
+
+// Взвести задание через delayMs (можно вызывать из любой задачи).
+// Если задание уже взведено на более ранний срок, срок не переносится.
+void schedArm(Scheduler& s, int8_t id, uint32_t delayMs);
+
+// То же из обработчика прерывания: задание выполнится сразу после пробуждения задачи
+void schedArmFromIsr(Scheduler& s, int8_t id);
+
+// Выполнить задания, срок которых наступил; вернуть мс до ближайшего срока
+uint32_t schedRunDue(Scheduler& s);
+
+#endif // SCHEDULER_H
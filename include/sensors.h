@@ -1,22 +1,20 @@
 // =================================================================================
 // File:         include/sensors.h
-// Description:  Объявления (прототипы) функций для работы с датчиками 1-Wire
-//               и дискретными входами. Это "оглавление" для модуля sensors.
+// Description:  Объявления (прототипы) функций для работы с датчиками 1-Wire.
+//               Это "оглавление" для модуля sensors. Дискретные входы - в inputs.h.
 // =================================================================================
 
 #ifndef SENSORS_H
 #define SENSORS_H
 
 #include "config.h" // Нужен для доступа к глобальным структурам и переменным
+#include "json_writer.h"
 
 // Инициализация шины 1-Wire
 void initializeSensors();
 
-// Обновление всех показаний с датчиков DS18B20
-void updateAllSensorReadings();
-
-// Чтение и фильтрация состояния дискретных входов с PCF8574
-void readDigitalInputs();
+// Обновление всех показаний с датчиков DS18B20; возвращает мс до следующего события конвейера
+uint32_t updateAllSensorReadings();
 
 // --- Вспомогательные функции для работы с NVS и адресами 1-Wire ---
 
@@ -27,6 +25,24 @@ bool nvsClearVar(const String& varName);
 bool nvsBindVarToRom(const String& varName, const String& rom, String* clearedVarOut=nullptr, String* replacedRomOut=nullptr, String* errMsg=nullptr);
 bool owIsKnownVar(const String& v);
 
+// Устройства последнего полного обхода шины - элементами открытого JSON-массива
+// (rom, var, t). Шина не опрашивается: список и температуры - из кэша.
+uint16_t owScanToJson(JsonWriter& sensors, bool withBinding, uint16_t maxCount);
+
+// Запрос внеочередного обхода шины (/api/ow/scan); true - обход ещё идёт,
+// список в owScanToJson пока от предыдущего обхода
+bool owRequestScan();
+
+// Итог последнего фонового обхода шины 1-Wire
+struct OwDiscoveryReport {
+    unsigned long lastSweepTime = 0;
+    uint32_t sweeps = 0;
+    uint8_t devicesFound = 0;   // DS18B20 на шине
+    uint8_t unboundFound = 0;   // Из них без привязки к переменной
+    uint16_t missingMask = 0;   // Бит i - привязанный OW_VARS[i] не ответил
+};
+const OwDiscoveryReport& owGetDiscoveryReport();
+
 // Объявление функции для получения температуры
 float getTempByVar(const char* varName, bool& isAlarm);
 
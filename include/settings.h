@@ -0,0 +1,33 @@
+// =================================================================================
+// File:         include/settings.h
+// Description:  Кэш настроек NVS в оперативной памяти (appSettings).
+//               Все ключи читаются один раз при старте; регуляторы, насосы и
+//               дисплей берут значения из RAM. Сохранение из веб-интерфейса
+//               идёт через функции ниже: сначала NVS, затем копия в RAM.
+// =================================================================================
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include "config.h"
+
+// Загрузка всех пространств NVS (owmap, profiles, params, general) в appSettings
+void settingsLoad();
+
+// --- Запись (NVS + RAM) ---
+bool settingsSetProfile(uint8_t cont, uint8_t tileIdx);
+bool settingsSetTzad(const char* tzadKey, float value);
+void settingsSetPi(uint8_t cont, const PiParams& pi);
+void settingsSetPumpEnableMask(uint8_t mask);
+void settingsSetSummerCutoff(float value);
+void settingsSetGvpPid(float dz, float kf, float max);
+bool settingsSetCurvePoints(const String& json); // false - график некорректен, не сохранён
+bool settingsSetComfort(uint8_t cont, const String& json); // false - не JSON-объект, не сохранено
+void settingsSetCtrlIndex(const String& value);
+void settingsSetTimeWasSet(bool value);
+void settingsSetOwRom(uint8_t varIdx, const String& rom); // Пустая строка - удалить привязку
+
+// Значение TZAD для плитки (из RAM)
+float settingsTzadForTile(uint8_t tileIdx);
+
+#endif // SETTINGS_H
@@ -0,0 +1,38 @@
+// =================================================================================
+// File:         include/stream_export.h
+// Description:  Потоковая выгрузка больших ответов (история, журнал во flash).
+//               Обработчик забирает соединение, как /api/live, и отдаёт
+//               функцию наполнения; задание "export" задачи web вызывает её
+//               порциями по EXPORT_CHUNK_BYTES, пока свободно окно TCP.
+//               Тело ответа заканчивается закрытием соединения, поэтому объём
+//               выгрузки не ограничен ни памятью, ни таймаутами сервера.
+//               Одновременно идёт одна выгрузка.
+// =================================================================================
+
+#ifndef STREAM_EXPORT_H
+#define STREAM_EXPORT_H
+
+#include "config.h"
+
+#define EXPORT_CHUNK_BYTES 1024
+
+// Дописать в buf (len - уже занято, cap - ёмкость) следующую порцию;
+// true - данных больше нет
+typedef bool (*ExportFill)(char* buf, size_t cap, size_t& len);
+
+// Проверка в начале обработчика: false - идёт другая выгрузка, клиенту
+// уже отправлен 503 (состояние текущей выгрузки трогать нельзя)
+bool exportAvailable();
+
+// Начать выгрузку по текущему запросу. head - заголовок ответа без
+// завершающей пустой строки (её и "Connection: close" добавит выгрузка).
+void exportBegin(const char* head, ExportFill fill);
+
+// Очередная порция (задача web). Возвращает мс до следующего вызова
+// (SCHED_NEVER - выгрузки нет).
+uint32_t exportPump();
+
+// printf в буфер порции; обрезанная строка не дописывается
+bool exportAppend(char* buf, size_t cap, size_t& len, const char* fmt, ...);
+
+#endif // STREAM_EXPORT_H
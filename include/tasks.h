@@ -0,0 +1,64 @@
+// =================================================================================
+// File:         include/tasks.h
+// Description:  Разделение работы контроллера на задачи FreeRTOS.
+//               control (реле, ПИ, насосы) и sensors (1-Wire, RTC) - на ядре 1
+//               с высоким приоритетом; ui (кнопка, дисплей, восстановление I2C)
+//               и web (веб-сервер) - на ядре 0 рядом со стеком Wi-Fi.
+//               Каждая задача сама регистрируется в сторожевом таймере.
+// =================================================================================
+
+#ifndef TASKS_H
+#define TASKS_H
+
+#include "config.h"
+
+// Статистика задачи для /api/system/status
+struct TaskStats {
+    const char* name;
+    uint32_t runs;           // Выполнено заданий
+    uint32_t lastExecUs;
+    uint32_t maxExecUs;      // Самый долгий проход планировщика
+    uint32_t maxLatencyUs;   // Самое большое опоздание задания относительно срока
+    uint32_t stackFreeMin;   // Минимум свободного стека, байт (0 - не измеряется)
+};
+
+// Запуск задач (в конце setup())
+void startTasks();
+
+// Без USE_RTOS_TASKS: выполнить задания, срок которых подошёл (из loop())
+void tasksRunCooperative();
+
+// Изменён теневой регистр реле: задача control запишет его в конце такта
+void tasksWakeRelays();
+
+// Запрошен обход шины 1-Wire из веба: задача sensors начнёт его сразу
+void tasksWakeSensors();
+
+// Данные или подтверждение от клиента HTTP (из задачи AsyncTCP): обслужить сервер
+void tasksWakeHttp();
+
+// Такт control завершён: задача web разошлёт дельту подписчикам /api/live
+void tasksWakeLive();
+
+// Начата потоковая выгрузка (stream_export): задача web начнёт её отправку
+void tasksWakeExport();
+
+uint8_t tasksCount();
+const TaskStats& tasksStats(uint8_t i);
+
+// Захват мьютекса на время блока; с nullptr (до создания) ничего не делает
+class MutexLock {
+public:
+    explicit MutexLock(SemaphoreHandle_t m) : mutex(m) {
+        if (mutex) xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    }
+    ~MutexLock() {
+        if (mutex) xSemaphoreGiveRecursive(mutex);
+    }
+    MutexLock(const MutexLock&) = delete;
+    MutexLock& operator=(const MutexLock&) = delete;
+private:
+    SemaphoreHandle_t mutex;
+};
+
+#endif // TASKS_H
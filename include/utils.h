@@ -10,8 +10,41 @@
 #include "config.h"
 
 // Функции для работы с профилями и "плитками"
+uint8_t getProfileIndex(uint8_t cont);
 String getProfileId(uint8_t cont);
+bool setProfileId(uint8_t cont, const String& id);
+bool tileIdExists(const String& id);
 int tileIndexById(const String& id);
 const TileDef& getTile(uint8_t idx);
 
+// --- Журналы: история в ОЗУ, журнал во flash, журнал событий ---
+
+#define TEMP_NONE INT16_MIN // Нет данных (датчик в аварии, нет уставки)
+
+// Секунды от включения - одни часы для t в /api/history и up в /api/flashlog
+// и /api/events; millis() переполняется через 49 суток, счётчик - нет
+uint32_t uptimeSeconds();
+
+// Температура в 1/16 °C; NaN и выход за int16 - TEMP_NONE
+int16_t quantizeTemp(float v);
+
+// Целые little-endian в байтовом буфере
+inline void putU16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void putU32(uint8_t* p, uint32_t v) {
+    putU16(p, (uint16_t)v);
+    putU16(p + 2, (uint16_t)(v >> 16));
+}
+
+inline uint16_t getU16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+inline uint32_t getU32(const uint8_t* p) {
+    return getU16(p) | ((uint32_t)getU16(p + 2) << 16);
+}
+
 #endif // UTILS_H
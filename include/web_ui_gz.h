@@ -0,0 +1,960 @@
+// =================================================================================
+// File:         include/web_ui_gz.h
+// Description:  СГЕНЕРИРОВАН scripts/build_web.py из web/index.html - не править.
+//               Исходник 85802 Б, после минификации 69332 Б, gzip 15049 Б.
+//               Подключается только из web_interface.cpp.
+// =================================================================================
+
+#ifndef WEB_UI_GZ_H
+#define WEB_UI_GZ_H
+
+#include <pgmspace.h>
+
+#define WEB_UI_ETAG "\"6c6ac43bf33d63f1\""
+
+static const size_t WEB_UI_GZ_LEN = 15049;
+static const uint8_t WEB_UI_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x7d,0x6b,0x73,0x1b,0xc7,
+  0x95,0xe8,0x77,0xfe,0x8a,0x16,0xe4,0x0d,0x80,0x18,0x00,0x81,0xe1,0x43,0x12,0x40,
+  0x4a,0x57,0x91,0x64,0x2f,0xaf,0xad,0x47,0x59,0xb4,0xbd,0xb9,0xba,0xba,0xd4,0x10,
+  0x18,0x90,0x13,0x02,0x33,0xd8,0x99,0x01,0x1f,0xe6,0xb2,0x4a,0xb1,0x12,0x27,0x5b,
+  0x95,0x4a,0xbc,0x8e,0xaf,0x5d,0x95,0x4d,0xe2,0x4d,0x6e,0x6d,0xed,0xc7,0x55,0x1c,
+  0x3b,0x71,0x2c,0x4b,0xae,0xda,0x5f,0x00,0xfe,0x85,0xfd,0x25,0xf7,0x9c,0xd3,0xdd,
+  0x33,0xdd,0xf3,0xc2,0x80,0xa4,0xec,0xc4,0x65,0xdb,0xb2,0x30,0xd3,0xdd,0xa7,0x4f,
+  0x9f,0x3e,0x7d,0x5e,0x7d,0xba,0x67,0xe5,0xdc,0xf5,0xdb,0xd7,0xd6,0xbf,0x7f,0xe7,
+  0x06,0xdb,0x0e,0x86,0x83,0xcb,0x2b,0xf8,0x7f,0x36,0x30,0x9d,0xad,0xd5,0xd2,0x78,
+  0xa7,0x04,0xcf,0x96,0xd9,0xbb,0xbc,0x32,0xb4,0x02,0x93,0x75,0xb7,0x4d,0xcf,0xb7,
+  0x82,0xd5,0xd2,0xeb,0xeb,0x2f,0xd5,0x2f,0x96,0xd8,0xbc,0x78,0xef,0x98,0x43,0x6b,
+  0xb5,0xb4,0x6b,0x5b,0x7b,0x23,0xd7,0x0b,0x4a,0xac,0xeb,0x3a,0x81,0xe5,0x40,0xbd,
+  0x3d,0xbb,0x17,0x6c,0xaf,0xf6,0xac,0x5d,0xbb,0x6b,0xd5,0xe9,0xa1,0xc6,0x6c,0xc7,
+  0x0e,0x6c,0x73,0x50,0xf7,0xbb,0xe6,0xc0,0x5a,0x6d,0x35,0x9a,0xd0,0x47,0x60,0x07,
+  0x03,0xeb,0xf2,0x9b,0x6f,0xae,0xd7,0xaf,0x5e,0x64,0xd7,0xa0,0xb5,0xe7,0x0e,0x06,
+  0x96,0xb7,0x32,0xcf,0x0b,0xd8,0x8a,0x1f,0x1c,0xc0,0xdf,0x6d,0xcf,0x75,0x83,0xc3,
+  0x7a,0xbd,0x0f,0x35,0xea,0x7d,0x73,0x68,0x0f,0x0e,0xda,0xfe,0x81,0x1f,0x58,0xc3,
+  0xfa,0xd8,0xae,0xd5,0xcd,0xd1,0x68,0x60,0xd5,0xf9,0x8b,0x5a,0xf9,0xae,0xb5,0xe5,
+  0x5a,0xec,0xf5,0xb5,0x72,0xed,0x35,0x77,0xd3,0x0d,0xdc,0x9a,0x6f,0x3a,0x7e,0xdd,
+  0xb7,0x3c,0xbb,0xdf,0xa9,0xd7,0x37,0xcd,0xee,0xce,0x96,0xe7,0x8e,0x9d,0x5e,0xbd,
+  0xeb,0x0e,0x5c,0xaf,0x7d,0xbe,0xdf,0xec,0x1b,0xfd,0x25,0x28,0xea,0x9a,0x5e,0x4f,
+  0x29,0x87,0x12,0xfa,0x07,0x4a,0x02,0x6b,0x3f,0x90,0xd5,0x5b,0xdd,0x96,0x65,0xb4,
+  0xe4,0x4b,0xdf,0x82,0x31,0xf7,0x4c,0xef,0xa0,0x7d,0x7e,0xb9,0xb9,0x7c,0xe1,0x42,
+  0x13,0xbb,0x70,0xbd,0x9e,0xe5,0xc9,0xfa,0xbd,0xae,0xd5,0xb2,0x96,0xe1,0xf5,0xc8,
+  0xb3,0x87,0x50,0x51,0xbe,0x6f,0xf6,0x96,0xad,0x7e,0x4f,0x79,0xbf,0xed,0xee,0x5a,
+  0xf8,0x7e,0x73,0xc9,0xea,0x5d,0x80,0xf7,0x48,0x7f,0x00,0xb3,0xb9,0xd5,0x3e,0x6f,
+  0x74,0x17,0xac,0xa5,0x66,0xf4,0xae,0xbf,0xa5,0x20,0xe7,0x99,0x3d,0x7b,0xec,0xb7,
+  0x2f,0x8e,0xf6,0xe1,0xc1,0xdf,0x36,0x7b,0xee,0x5e,0xbb,0xc9,0x8c,0xd1,0x3e,0x83,
+  0x57,0xcc,0xdb,0xda,0x34,0x2b,0xcd,0x1a,0xfd,0xdb,0x68,0x5e,0xac,0x62,0x9d,0xc0,
+  0x0c,0xc6,0x7e,0xdd,0xdd,0x21,0xd8,0xd6,0x85,0xfe,0x02,0xc1,0x89,0x5e,0x23,0xf8,
+  0x10,0x3d,0xf1,0xda,0x1c,0x98,0xde,0x90,0x1a,0xf4,0x2f,0xf6,0x2e,0xf4,0xcc,0x78,
+  0x09,0xb6,0xb9,0xb8,0x68,0x34,0x8d,0x4b,0x51,0xc9,0x9e,0xe9,0x39,0xbc,0x49,0xbf,
+  0xbf,0xd0,0xed,0xc5,0x0a,0xb0,0xc5,0xf2,0xf2,0x62,0xaf,0xb9,0x10,0x15,0x78,0xd6,
+  0xc8,0xb4,0xbd,0xd4,0x36,0xa2,0x28,0xad,0x95,0x3f,0x1e,0x0e,0x05,0xa5,0x7a,0x2d,
+  0xeb,0x42,0xaf,0x97,0x28,0xa2,0x11,0xf5,0x97,0x5a,0x0b,0x86,0x82,0x84,0xeb,0xed,
+  0xd8,0xce,0x16,0x35,0xeb,0xf6,0x2d,0x43,0x25,0x82,0x2c,0xa3,0x76,0x30,0xac,0x4b,
+  0x17,0x8f,0xbe,0x7b,0xb8,0xe9,0xee,0xd7,0x7d,0xfb,0x2d,0x78,0xdf,0x16,0x53,0x0c,
+  0x6f,0x3a,0x30,0x77,0x5b,0xb6,0xd3,0x6e,0x76,0x46,0x66,0xaf,0x87,0x65,0xcd,0x23,
+  0x5c,0x49,0x87,0xc4,0xab,0x50,0xdd,0x6a,0xb7,0x96,0x61,0x6a,0xfc,0x2e,0xb2,0x76,
+  0x7d,0xd3,0xda,0x36,0x77,0x6d,0x98,0x7f,0x7f,0x08,0x2c,0xbd,0x7d,0xb4,0xe9,0xf6,
+  0x0e,0x0e,0x55,0xb6,0xde,0x35,0xbd,0x8a,0xc6,0xe8,0xd5,0x4e,0x82,0x65,0x79,0x9d,
+  0xf8,0xeb,0x6a,0x47,0x2d,0x8d,0x58,0xb6,0xda,0x19,0xd8,0x8e,0x05,0xac,0x63,0x6f,
+  0x6d,0x07,0xed,0x56,0x63,0xb9,0x83,0x8c,0x16,0xc3,0xa7,0x7e,0xd0,0xc6,0xc5,0x6b,
+  0xda,0xce,0x11,0xe7,0xb1,0xc3,0x8c,0x5e,0x43,0xae,0xd4,0xbb,0x0b,0x19,0xb3,0x1a,
+  0xd2,0xa1,0xe5,0x59,0x43,0xd6,0x6a,0x2c,0xc1,0x5f,0x1d,0xc2,0xc6,0x1c,0xd8,0x5b,
+  0x4e,0xbb,0x0b,0x02,0xc2,0xf2,0x3a,0x0a,0x79,0x78,0x15,0x7a,0xb1,0xc7,0x91,0x5c,
+  0x6a,0x02,0x39,0x5d,0x1f,0xe4,0x85,0xeb,0xb4,0xfd,0xc0,0xee,0xee,0x1c,0x74,0x02,
+  0x77,0x04,0x44,0x7e,0xab,0x6e,0x3b,0x3d,0x6b,0xbf,0xdd,0x82,0x1a,0x34,0x1f,0x2a,
+  0xbf,0x2f,0xc6,0xf9,0xbd,0x55,0x3d,0x6a,0x88,0x61,0xc1,0x88,0x54,0xc4,0x60,0xda,
+  0xf6,0xb9,0x60,0x6a,0xb7,0x8c,0x66,0x73,0x14,0xcd,0x23,0x33,0xc7,0x81,0x7b,0xd4,
+  0xd8,0xf2,0x6c,0x1c,0xb8,0x6c,0xdb,0xb3,0xfd,0xd1,0xc0,0x3c,0x68,0xe3,0xeb,0x0e,
+  0x95,0x81,0xac,0x81,0x37,0x81,0x85,0xd4,0x19,0x0f,0x1d,0xbf,0x0d,0x0c,0x6a,0x99,
+  0x41,0x05,0x9b,0xd7,0xfb,0x76,0x50,0x1b,0xda,0x0e,0x74,0x52,0x59,0x30,0x00,0x7a,
+  0xad,0xd5,0xf7,0xaa,0xd5,0xce,0x96,0x39,0x12,0xc3,0x05,0xbc,0x40,0xda,0x28,0x44,
+  0x16,0x74,0x8c,0xc9,0x20,0x98,0x7c,0xe2,0xb4,0x76,0x0b,0x86,0xe6,0xbb,0x03,0xbb,
+  0xc7,0xc4,0xe4,0x2b,0x32,0x46,0x56,0x92,0x92,0x80,0xd7,0xe0,0x0f,0xca,0x74,0x70,
+  0x32,0x2b,0x44,0xe3,0xf5,0xf8,0x43,0xb5,0x23,0x47,0xd8,0x1f,0x58,0xfb,0x1d,0xfc,
+  0x5f,0xbd,0x67,0x7b,0x56,0x97,0xa6,0x80,0x0f,0x91,0xd0,0x6f,0x36,0x2e,0x44,0xf8,
+  0xd7,0x49,0x4c,0x1f,0x86,0xa4,0x83,0x7f,0x95,0xc9,0x14,0xb3,0x6b,0x24,0xa6,0xf7,
+  0x02,0x4c,0x9e,0xce,0x93,0x46,0x27,0x83,0xc7,0x34,0xac,0x7e,0x30,0x06,0x5e,0xe8,
+  0x1f,0xd4,0x85,0x9a,0x69,0xfb,0x23,0x13,0xd4,0xcb,0xa6,0x15,0xec,0x59,0x96,0xd3,
+  0x21,0xf6,0xaa,0xdb,0x30,0x2f,0x7e,0x7b,0xd3,0xf4,0x2d,0xec,0x41,0xa0,0xe9,0x8f,
+  0x37,0x39,0xa6,0x11,0x5e,0xcd,0xc6,0xa5,0x38,0x5a,0x8b,0x80,0x56,0x62,0x09,0x85,
+  0x02,0x1e,0x58,0xa9,0x67,0x06,0x66,0xdd,0x73,0xf7,0x0e,0x35,0xac,0xd4,0x7e,0x05,
+  0x73,0xe7,0x23,0x4a,0x5c,0x80,0x9d,0x87,0x12,0x83,0x88,0xc6,0x9a,0x9d,0x50,0xac,
+  0x04,0x81,0x3b,0xcc,0x9f,0xf3,0x08,0x9b,0xf6,0xc0,0xf4,0x61,0xa9,0x6f,0xdb,0x03,
+  0xe0,0x27,0x0d,0x80,0xe3,0x22,0x05,0xa8,0xde,0xc0,0xdc,0xb4,0x84,0x4c,0x52,0xd6,
+  0xd8,0xde,0x36,0xa0,0x5d,0x27,0xec,0xa0,0xf2,0x9e,0x67,0x8e,0x0a,0x10,0x60,0xd7,
+  0x1c,0x8c,0xad,0x43,0x65,0x45,0x7b,0x08,0x2f,0xb1,0x7e,0x55,0xa1,0x36,0x74,0x1d,
+  0x97,0x7a,0xd1,0x18,0xa3,0x45,0x7c,0x84,0xeb,0x88,0xeb,0x90,0x43,0xb5,0xef,0x98,
+  0x72,0xa9,0xc6,0x19,0xe8,0xa8,0x21,0x6a,0x6c,0x9a,0xbd,0x2d,0x2b,0x9c,0x11,0xdb,
+  0x21,0xc6,0xda,0x1c,0xb8,0xdd,0x1d,0x85,0xbe,0x06,0x27,0x30,0xe7,0xdd,0xd8,0x72,
+  0xb9,0x74,0x09,0x56,0x7f,0x2e,0x63,0x20,0xbf,0xd2,0x78,0x03,0x0f,0x4c,0x89,0xbe,
+  0xeb,0x0d,0xdb,0xe3,0xd1,0xc8,0xf2,0xba,0xc0,0x65,0xc9,0x05,0x4a,0x95,0x46,0xa6,
+  0x07,0x13,0xaf,0x23,0xd9,0x70,0x77,0xb2,0xa4,0xaa,0xaa,0x92,0x75,0xc1,0xaa,0x6a,
+  0xe5,0x70,0xa1,0x67,0x56,0x88,0x75,0xc8,0xc9,0x9a,0xdf,0xa7,0x54,0xec,0xa9,0xdd,
+  0x46,0xe4,0xcf,0xee,0x39,0xac,0x13,0xeb,0x9c,0x2b,0xec,0x29,0xbd,0x87,0x0a,0x3f,
+  0xb5,0xfb,0x50,0xe7,0xe7,0xf5,0x1f,0x55,0x8a,0x21,0xc0,0x75,0xff,0x14,0x04,0x42,
+  0xdb,0x21,0x15,0x81,0xd0,0x7c,0xc8,0x43,0x20,0xaa,0x14,0x43,0x40,0x58,0x11,0x53,
+  0x30,0x88,0xec,0x90,0x54,0x14,0x22,0x53,0x24,0x0f,0x07,0xa5,0x56,0x0c,0x89,0xb1,
+  0xb3,0x03,0x4b,0xdb,0x49,0x22,0x71,0xde,0xba,0x64,0x75,0xad,0xbe,0xe8,0xf3,0xfc,
+  0xe2,0xa5,0xa5,0xe6,0xd2,0x05,0xbd,0x8b,0xf3,0x66,0x6f,0x73,0x69,0xb3,0x77,0xd4,
+  0xd8,0x0c,0x9c,0x69,0x4b,0x6c,0x99,0xab,0x7b,0x23,0xb9,0xc0,0x74,0x7d,0xd4,0x1d,
+  0x7b,0x3e,0x80,0x1e,0xb9,0x36,0x89,0x4a,0x5a,0x57,0x3d,0x90,0x31,0x9e,0x49,0xaa,
+  0x06,0x65,0x56,0x67,0x0c,0xd6,0x3a,0x08,0x9e,0x01,0xa8,0x1f,0xfe,0x22,0x6f,0x91,
+  0x69,0x92,0xc6,0x76,0xb6,0xc1,0xd0,0x0f,0x54,0x39,0x93,0x66,0x5c,0x24,0xed,0x11,
+  0x02,0xc8,0x0d,0x0e,0x73,0x30,0x00,0x51,0x61,0xf8,0xcc,0x82,0xf5,0x0d,0xf6,0x46,
+  0xdd,0x1d,0x07,0x44,0x82,0x36,0x90,0xc0,0xdc,0x1c,0x58,0xbd,0x14,0x62,0x76,0xad,
+  0xde,0x22,0x58,0xc5,0x3a,0xf9,0xc4,0x4b,0xf1,0xb4,0xdc,0xbd,0xb0,0x74,0xa1,0x27,
+  0x09,0xe0,0xb8,0x88,0xc1,0xc0,0xdd,0xb3,0x38,0x7d,0xa5,0x1f,0x90,0xc5,0x2d,0x9a,
+  0xfb,0x20,0x39,0x85,0x04,0x78,0x1a,0x5b,0xe8,0xb5,0xb5,0x0e,0xda,0xdc,0xd1,0x80,
+  0xfe,0x2b,0xe1,0x80,0xaa,0xd3,0x7a,0xa5,0x36,0xd5,0xbc,0x9e,0x78,0x0d,0xde,0x53,
+  0xa8,0x33,0x52,0x08,0x25,0xa9,0x90,0x85,0xbf,0xa8,0x10,0x03,0x54,0x10,0xe9,0xf3,
+  0x4b,0xdd,0xe5,0x85,0xe5,0xf8,0x34,0x2c,0x2d,0x2f,0x59,0xcb,0x8b,0x1c,0x22,0xcc,
+  0x25,0xb2,0x6f,0xb2,0xa9,0xca,0x51,0x39,0x74,0x2f,0x48,0x6b,0xd1,0xcd,0x89,0x68,
+  0x9d,0x9c,0x61,0x0e,0xb3,0x0f,0x1e,0x83,0x62,0x8a,0xf2,0x05,0x28,0x6c,0xd8,0x66,
+  0xf3,0xef,0x14,0x93,0x76,0x51,0xb5,0x68,0x71,0x45,0x92,0x51,0xcb,0x62,0x46,0xc7,
+  0x45,0xc5,0x40,0x4f,0xea,0x65,0x93,0x4c,0x3f,0x3f,0x69,0xef,0xc4,0x8d,0x1b,0xb2,
+  0x15,0x2d,0xa7,0xa7,0x9a,0x87,0xa2,0xef,0x3a,0x1a,0xed,0x1c,0xdc,0xc8,0xdc,0xb2,
+  0x34,0x73,0x31,0xb4,0x72,0x32,0x3c,0x04,0x10,0x63,0x56,0x10,0x00,0xa6,0x7e,0x1d,
+  0xed,0xed,0x22,0x16,0x38,0x18,0xd9,0xaa,0x89,0xfd,0x3f,0x86,0x56,0xcf,0x36,0x59,
+  0x05,0x0c,0x71,0x41,0x97,0x4b,0x97,0xc0,0x4d,0xa8,0x1e,0xc6,0x20,0xe7,0x9a,0xf3,
+  0x06,0x99,0xee,0x47,0x21,0x36,0x75,0x9c,0xb8,0xd1,0xe1,0xac,0xd6,0xb2,0x6c,0xad,
+  0x52,0x73,0xca,0x48,0x52,0xec,0x4a,0x0e,0x92,0x6c,0x99,0x56,0xfa,0x08,0x97,0x2e,
+  0x2c,0xab,0x23,0xa4,0xfe,0x32,0xba,0xb8,0x08,0x3c,0xc2,0xa0,0x23,0x18,0x1b,0x9a,
+  0x34,0xe9,0x26,0xa2,0x28,0xb3,0x9d,0xd1,0x38,0xa8,0xf1,0xdf,0x5c,0x2e,0x1f,0x2a,
+  0x8c,0x17,0x53,0x02,0x9c,0xb3,0x72,0x95,0x40,0x01,0x91,0x5d,0xcc,0xf1,0x49,0x46,
+  0x73,0xfa,0xfd,0x4c,0x3f,0x58,0x91,0xf1,0x2a,0x18,0x12,0xf6,0xb5,0xc8,0x31,0xa2,
+  0x67,0x75,0xe0,0xed,0xbe,0xdb,0x1d,0xfb,0xda,0xf0,0xf9,0xab,0x43,0xb9,0xcc,0x15,
+  0x25,0x55,0xcf,0x15,0x1e,0x8a,0xc7,0x8a,0xff,0x1a,0xd2,0x63,0x6d,0x2d,0xd4,0x5a,
+  0xad,0x66,0xcd,0x58,0x5a,0xa8,0xa1,0xb5,0x5a,0xd5,0xba,0x97,0x92,0x43,0xc7,0x20,
+  0x47,0x19,0x49,0xcd,0x9e,0xa2,0x69,0x60,0xd5,0xf6,0x6d,0x30,0x36,0xc6,0xb0,0xf8,
+  0x1c,0xff,0x14,0x7e,0x6d,0x2b,0xe6,0xd7,0xa6,0xac,0xfc,0xa6,0x74,0x75,0xb5,0x3e,
+  0x19,0x0a,0xb3,0x46,0x60,0x63,0xc8,0x8e,0x46,0x92,0x36,0x84,0x2c,0x2b,0x6c,0x8a,
+  0xda,0x4b,0xb1,0xc8,0xc0,0x5d,0xd9,0xb5,0x48,0x58,0x79,0xee,0xe0,0xac,0x3c,0x37,
+  0x55,0xbc,0x89,0x41,0x6a,0xfd,0xd0,0x18,0x0f,0x73,0x63,0x1c,0x9b,0xee,0xa0,0xa7,
+  0xc5,0x4a,0xb8,0x18,0xd9,0x42,0x8f,0xae,0xa5,0x86,0x27,0x96,0x80,0xce,0x09,0xf0,
+  0xca,0x62,0x55,0xa4,0x76,0x56,0x9c,0x45,0x59,0xcf,0xe7,0x81,0x29,0x10,0x10,0xb8,
+  0xc5,0xac,0x11,0xb8,0xee,0x60,0xd3,0xf4,0x52,0xa4,0x19,0xfa,0x82,0x6d,0x72,0x08,
+  0x23,0x99,0xd3,0x89,0x09,0x6e,0x1c,0x76,0x1a,0x38,0xd6,0x20,0xaa,0x79,0x87,0x08,
+  0xa9,0xdd,0x8a,0xd5,0x41,0x9e,0x25,0xf0,0xe0,0x40,0x1d,0xa2,0x76,0xec,0x03,0x67,
+  0xd6,0xf7,0xdb,0x14,0x76,0x51,0xab,0x52,0x4d,0x55,0xcc,0x44,0xf3,0x3d,0x30,0x47,
+  0xbe,0xd5,0x96,0x3f,0xf4,0x56,0xdb,0x35,0xed,0x51,0xfa,0xc4,0x53,0x04,0x89,0xee,
+  0x8a,0xa7,0x68,0x23,0xbd,0x8f,0x94,0x35,0xd7,0xbf,0xd8,0xbf,0xd4,0x37,0x13,0x6e,
+  0xaa,0x36,0xf8,0xae,0x35,0x18,0xf0,0x35,0x9d,0x2e,0x3e,0xe3,0xaa,0x38,0x7d,0x4a,
+  0x4f,0x10,0x12,0x5a,0x04,0x16,0xca,0xc0,0xa4,0x61,0x3b,0xc0,0x5b,0xa0,0x06,0xa5,
+  0x2c,0x33,0x62,0x70,0x93,0xae,0x60,0x31,0x7f,0x12,0x5c,0x7b,0xd7,0xf4,0x83,0xc3,
+  0x68,0x78,0xa9,0xa6,0xc1,0x74,0x3d,0xa1,0xba,0xe5,0x92,0x53,0x79,0x68,0x83,0x3a,
+  0x68,0xf8,0xdb,0x8a,0x52,0xe5,0x56,0xd1,0x99,0xfa,0x7c,0x09,0x4a,0xa7,0x48,0x19,
+  0x8e,0x89,0xe5,0x79,0xae,0xc7,0xf1,0x39,0x43,0xa7,0x3b,0xab,0x7f,0xc5,0xf1,0x86,
+  0x15,0x34,0xb0,0x81,0xd6,0x85,0xcd,0x12,0x2e,0xb3,0xa0,0x19,0x4a,0xbf,0x22,0x5a,
+  0x80,0x1b,0x90,0x7d,0x8f,0x5b,0x92,0xf8,0xbf,0x2c,0x03,0x25,0x66,0x65,0xaa,0x21,
+  0x97,0x0c,0x07,0x2e,0x8f,0x03,0x54,0x9d,0x1d,0x23,0xa9,0xd0,0xd3,0x62,0x10,0xed,
+  0x6d,0xd3,0xaf,0xe0,0x03,0xb6,0x74,0xdb,0xdd,0x6d,0xab,0xbb,0x93,0x63,0x6c,0xeb,
+  0x11,0x97,0x02,0x56,0xbd,0x84,0x7c,0x18,0x05,0x81,0x68,0x27,0xab,0x02,0xb2,0xbd,
+  0x2a,0x99,0x9a,0x42,0x61,0x2a,0x79,0xfd,0x81,0x1b,0x1c,0xc6,0x63,0x49,0x71,0xf7,
+  0x96,0x6a,0x22,0xc5,0x0f,0x8b,0x06,0xcd,0xa0,0xfe,0xa6,0xed,0x20,0x85,0xa7,0x46,
+  0xbe,0xb8,0x45,0xb6,0x3c,0xf3,0x4a,0x4b,0x0d,0x80,0x69,0x72,0x28,0xb2,0x3a,0x97,
+  0x49,0x45,0x45,0x48,0x35,0x36,0x91,0xde,0x87,0x5f,0xf9,0x2a,0x54,0x30,0x18,0x3b,
+  0x45,0x70,0x88,0xd6,0x61,0xc1,0xa5,0xd6,0x11,0x21,0x6b,0x03,0x24,0xaa,0xb2,0xe3,
+  0x13,0x1a,0xe2,0xa1,0xda,0x96,0x86,0xb8,0x5c,0x62,0x05,0x56,0x15,0x67,0x18,0x6e,
+  0x5d,0x8b,0xed,0x07,0xac,0xd5,0x6e,0xb1,0x79,0x56,0x6f,0xa5,0x19,0x56,0x0a,0x1b,
+  0xa8,0x0d,0x16,0xa0,0xc1,0x22,0x5f,0xc7,0x64,0x4d,0xc0,0xa3,0x81,0x1e,0xcc,0x9e,
+  0x1d,0x74,0xb7,0x0f,0xc3,0x8d,0x15,0xcf,0x02,0x5c,0xec,0x5d,0xab,0x93,0xca,0x42,
+  0xd1,0xcc,0xca,0x31,0x2f,0xa0,0x16,0x11,0x50,0x18,0xd7,0x62,0x2e,0xf0,0xa7,0x1d,
+  0x1c,0xb4,0x9b,0xa2,0x7a,0x53,0xd6,0xc5,0xf8,0x2c,0x50,0x11,0x77,0x5d,0x64,0x77,
+  0xe6,0x26,0x10,0x76,0x0c,0x76,0x5b,0x2c,0x02,0x64,0x3b,0xe0,0xac,0x40,0xcb,0x94,
+  0x98,0x4a,0xb7,0xab,0xae,0xff,0xc6,0xa2,0x1f,0x63,0x61,0x81,0x11,0x75,0xd4,0xde,
+  0xb4,0x60,0x51,0x5a,0x69,0xfd,0x09,0x5b,0xae,0x54,0x0a,0x67,0x0f,0x77,0xe4,0x38,
+  0xc6,0xf4,0x73,0x60,0xf5,0x03,0xd4,0x91,0x1d,0x61,0xda,0xd0,0xcf,0x38,0x3a,0xdc,
+  0xe8,0xcc,0xc5,0x67,0xa9,0xf9,0x77,0x47,0xdc,0x64,0x17,0xe2,0x87,0xbd,0xc8,0x24,
+  0x1d,0x0a,0x39,0xfd,0x59,0xad,0xe5,0xe0,0x22,0xd9,0x43,0xbf,0x90,0x97,0xfe,0xa1,
+  0x82,0x43,0x90,0x2d,0xa5,0x53,0xa0,0x74,0x9c,0xf4,0x02,0x52,0x48,0x2d,0x03,0x7d,
+  0x43,0xb7,0x67,0x0e,0xea,0x68,0x96,0x01,0x43,0x44,0xb4,0xec,0xdb,0xfb,0xd0,0x2c,
+  0x39,0x53,0x6d,0x6d,0xbb,0x6d,0xb9,0xaa,0xe9,0xe7,0x22,0xf6,0xb5,0x78,0x2d,0xb7,
+  0xf5,0x2e,0xc1,0x3f,0x31,0x24,0x28,0x10,0xb1,0x6b,0x69,0xaa,0x4d,0x56,0x81,0x35,
+  0x37,0x70,0xd5,0xf8,0xaa,0x98,0x24,0x3e,0xb5,0x20,0x9f,0x2a,0x4b,0x18,0x09,0xa9,
+  0x5d,0x6a,0xee,0xee,0x15,0xdb,0x25,0x33,0x62,0x7b,0x64,0x4d,0xb6,0x84,0x5e,0xf2,
+  0x52,0x7c,0x67,0x71,0xa1,0x2a,0x71,0xa0,0x98,0x46,0xc2,0x88,0x2e,0xbe,0x55,0x25,
+  0x85,0x69,0xd2,0xb6,0x8e,0x75,0xc0,0xb6,0x17,0x12,0x1e,0x85,0xac,0xd3,0x1d,0xb8,
+  0xbe,0x95,0xf4,0x37,0x14,0xc2,0x24,0xf5,0x2d,0x9f,0xa3,0xd8,0x62,0xcc,0xdb,0xfe,
+  0x39,0x3f,0xb2,0x9d,0x1b,0x68,0xe1,0xe4,0x6f,0xd4,0x24,0xe4,0x94,0xce,0x14,0x71,
+  0x45,0xa3,0xcf,0xa5,0xdc,0xb2,0xe0,0x53,0x85,0x30,0x96,0xa6,0x1a,0x3f,0x5a,0x7b,
+  0x4c,0x2d,0xa0,0x98,0xfb,0x54,0x08,0x22,0x09,0xa1,0x4a,0x7b,0xf0,0x92,0xe7,0x46,
+  0x96,0x13,0x3a,0x25,0xed,0x6d,0xbb,0xd7,0xb3,0x1c,0xf4,0x5f,0x87,0xb0,0xe6,0x82,
+  0x3a,0x91,0x08,0x8c,0xe5,0x19,0xbc,0xe6,0x05,0xf2,0x90,0x55,0x27,0x2a,0x39,0xf7,
+  0xc9,0x0e,0x58,0xdc,0xbd,0x13,0x3a,0x39,0x67,0x76,0xd2,0x02,0x68,0x3d,0xf3,0x40,
+  0xe8,0x13,0x37,0xdf,0xc7,0x4b,0xe7,0x56,0x93,0x38,0x27,0xc5,0x01,0x8c,0xa2,0x7a,
+  0x6a,0x0f,0x02,0xe9,0x02,0x26,0x68,0x0a,0xfb,0xc7,0xd8,0x30,0xb9,0x73,0x97,0xb2,
+  0x71,0xc7,0x05,0x76,0xde,0xee,0x9b,0x86,0x1e,0xd7,0x58,0xfa,0x3a,0x13,0xf0,0x3b,
+  0x49,0x9b,0xce,0xa8,0xa6,0x35,0x57,0x24,0x33,0x74,0xe2,0x1c,0x26,0x1c,0xfa,0x3c,
+  0x0b,0x32,0x49,0x2c,0xb2,0x59,0x35,0xc0,0x67,0x67,0xaf,0xa6,0x20,0xaf,0x28,0x07,
+  0xc2,0x3e,0x16,0x70,0xcf,0xc5,0x2f,0x8a,0x5e,0xa7,0x45,0x95,0x02,0x7b,0x88,0xd1,
+  0x9c,0x20,0x1e,0x19,0x0d,0xfd,0x81,0x14,0xae,0x5f,0x99,0xe7,0xc9,0x5d,0x6c,0xc5,
+  0xef,0x7a,0xf6,0x28,0xb8,0x0c,0xdc,0xe7,0x07,0xec,0xea,0xf5,0x9b,0x6b,0xb7,0x36,
+  0xee,0xac,0xdd,0x62,0xab,0xac,0xd4,0x82,0x7f,0x4a,0x1d,0xa8,0xc9,0x6b,0xb0,0x95,
+  0x79,0x9e,0x95,0x86,0x4b,0x96,0x67,0xa8,0x59,0x5e,0x5a,0xfa,0x98,0x28,0x59,0xe9,
+  0xd9,0xbb,0xac,0x3b,0x30,0x7d,0x7f,0xb5,0x14,0xe6,0x72,0x94,0x98,0xdd,0x5b,0x2d,
+  0x0d,0xe1,0x77,0x1d,0x83,0xd2,0x25,0xad,0x96,0x9e,0xf6,0xa1,0x97,0xa1,0xe7,0x8c,
+  0x79,0x71,0x86,0xfa,0x82,0x8b,0xe7,0xd2,0xe5,0xc9,0xaf,0x26,0xcf,0x26,0x4f,0x8f,
+  0xdf,0x3e,0x7e,0x74,0xfc,0x90,0xad,0xc1,0x98,0x80,0xc0,0x5a,0x3d,0x99,0x83,0xc0,
+  0xbb,0xc7,0xf0,0xd7,0x06,0xa6,0xcf,0x6d,0xb4,0x4a,0x97,0xef,0xe1,0x8f,0xd6,0x7d,
+  0x18,0x26,0x34,0xba,0x0c,0xd8,0x1b,0x5a,0xbf,0x72,0xa3,0x1f,0xfa,0x56,0xa1,0x46,
+  0xfb,0xfa,0xd0,0xfb,0xbf,0x4d,0x3e,0x9d,0xfc,0x69,0xf2,0xd9,0xe4,0x0b,0x76,0xfc,
+  0x10,0x10,0xf9,0xc3,0xe4,0xd9,0xf1,0xdb,0x93,0xcf,0xda,0x12,0x64,0xa2,0x1d,0x6d,
+  0xe2,0x0b,0x4a,0xb8,0x3d,0x6b,0x63,0xad,0x74,0xb9,0x5e,0x0f,0x11,0x80,0xce,0x67,
+  0xc5,0x60,0x9d,0x4d,0xbe,0x84,0x8e,0x3f,0x99,0x3c,0x3e,0xfe,0xc9,0xf1,0x07,0x85,
+  0x3a,0x5e,0x1f,0xb9,0x3d,0xec,0xb8,0xc9,0xfe,0xeb,0xf1,0xb5,0x53,0xf6,0xfd,0xe7,
+  0xc9,0xc7,0x30,0xe4,0x87,0x38,0xec,0xe3,0x47,0xc5,0x7a,0xb7,0x9d,0xdd,0xb3,0xeb,
+  0xfd,0x31,0xf4,0x0f,0x63,0x9f,0x3c,0x05,0x1e,0xf8,0x45,0xb1,0xfe,0xdf,0x32,0x77,
+  0xcf,0x66,0xf8,0xc0,0x7a,0x4f,0xa0,0xeb,0x2f,0xb1,0xfb,0x42,0x5d,0xbf,0x81,0xb1,
+  0xc4,0xd3,0x4f,0xf9,0xe4,0x37,0x30,0xd9,0x3f,0x04,0x92,0xff,0x90,0x4d,0x7e,0xdd,
+  0x9a,0xd6,0xb3,0x28,0xc0,0xfe,0x6f,0xb6,0xa0,0x73,0x59,0x45,0xdd,0xac,0xd6,0x30,
+  0x3a,0x23,0xc4,0x8c,0x59,0x10,0x33,0x9e,0x33,0x62,0xbf,0x03,0xf1,0xf0,0x63,0x58,
+  0xa6,0x7f,0x61,0xc7,0x3f,0x3e,0xfe,0x60,0xf2,0xc9,0x0c,0xb8,0x5d,0xf7,0x0e,0x4e,
+  0x81,0x9c,0xb2,0x9b,0x07,0x40,0x4d,0xb6,0xed,0x59,0xfd,0xd5,0xd2,0x79,0xb9,0x11,
+  0xa6,0x40,0xde,0x0c,0x1c,0xa6,0xec,0x60,0x72,0x6a,0x22,0x83,0x1d,0xff,0x14,0xd7,
+  0x16,0xf0,0xb9,0xe0,0xf2,0x95,0x79,0x53,0x76,0x94,0xe8,0x6e,0x06,0x51,0x39,0x8b,
+  0xac,0x34,0x84,0xac,0x34,0xbe,0x5e,0x59,0xf9,0xf5,0x09,0xcb,0xaf,0x59,0x5a,0x7e,
+  0xfd,0xe2,0xf2,0xeb,0x94,0x97,0x5f,0xaf,0xc0,0xfc,0xeb,0x95,0x98,0x7f,0xdd,0x22,
+  0xf3,0x39,0xca,0xcc,0xe7,0x21,0x34,0x19,0x19,0xc5,0xa1,0x21,0x4a,0xf1,0x3c,0x26,
+  0x22,0x80,0xd9,0x12,0xf5,0x43,0x80,0xff,0x47,0xec,0xf1,0xf8,0x67,0xd0,0xcb,0x07,
+  0x28,0x5e,0x1e,0xc3,0xfa,0x7e,0x3c,0xf9,0x62,0xf2,0x29,0x20,0xf0,0x70,0xf2,0xd9,
+  0x49,0x24,0x25,0x2d,0xd5,0x67,0x80,0x3c,0x80,0x3c,0xfe,0x29,0xfc,0xff,0x67,0xf0,
+  0xf4,0xc7,0xc9,0x33,0x2e,0xbd,0x3e,0x86,0x97,0x00,0xba,0xe8,0xfa,0xdd,0x00,0xda,
+  0xf4,0x5c,0x17,0x6c,0xea,0xff,0x7e,0xf8,0xfe,0xa9,0x85,0x48,0x8b,0xd1,0xd0,0x1e,
+  0xa2,0x28,0x87,0xf1,0x56,0x22,0x79,0x3a,0x79,0x5c,0x2d,0x86,0x50,0x6b,0x03,0x43,
+  0x97,0x67,0x83,0x8e,0x11,0x47,0x47,0x91,0xb0,0x05,0xd1,0x31,0xf2,0xd0,0x39,0x4b,
+  0x5e,0xf9,0x1d,0x68,0x3b,0xe0,0x46,0x06,0xeb,0xfd,0xb3,0xe3,0x1f,0xc2,0xc3,0xa7,
+  0x80,0xfb,0x89,0xf8,0x63,0xf2,0x1f,0x28,0x35,0x0a,0x0d,0x8f,0xaf,0xbd,0x0d,0x2f,
+  0xe8,0x9e,0x56,0x88,0xde,0x7e,0xf5,0xc6,0x75,0x36,0x79,0x1f,0x71,0x87,0x49,0x7f,
+  0x02,0xd8,0xff,0x65,0x16,0x0c,0x84,0x7b,0x7a,0x6a,0x51,0xfe,0x11,0xad,0x6e,0xa0,
+  0x24,0xa3,0x59,0x07,0x3c,0x66,0xa2,0x83,0x75,0xb6,0x38,0xc0,0x62,0xfc,0x31,0x2e,
+  0x00,0x10,0x90,0x1f,0xcf,0x82,0x07,0xf9,0xf6,0x49,0x3c,0xd4,0xff,0x87,0x72,0x6f,
+  0xcb,0x02,0x8f,0xd8,0x1c,0x24,0x64,0x9e,0x08,0x3c,0xb0,0x28,0x45,0x2d,0x4d,0x20,
+  0x3d,0x9d,0x2a,0x0f,0xb3,0x7d,0x75,0xd5,0x4a,0x15,0x2c,0xaf,0x86,0x14,0x35,0x56,
+  0x8f,0xf2,0xcc,0xb2,0x85,0x30,0x9b,0x7c,0x1e,0x59,0xa0,0xc7,0x8f,0xd8,0x5a,0x9b,
+  0x45,0x4a,0x23,0xec,0xac,0xa0,0x77,0x2e,0x4d,0xdd,0x85,0x94,0xc5,0xc6,0x01,0xda,
+  0x1b,0x23,0xd3,0x33,0x87,0x1b,0x91,0xf9,0xf1,0x0c,0x64,0xc5,0x8f,0x1a,0x28,0x5d,
+  0xbf,0x00,0x21,0xfa,0xcf,0xc0,0x3f,0x84,0xd5,0x1f,0x51,0x64,0x1f,0xff,0x08,0x26,
+  0xf1,0xf3,0xe3,0x47,0xd0,0xd1,0x82,0xd6,0x91,0x92,0xd2,0xa5,0xaf,0xfc,0x44,0xec,
+  0x91,0x76,0x94,0x0c,0xf8,0x83,0x69,0x64,0x4c,0x0d,0xbd,0x40,0x3b,0xcf,0x0a,0xba,
+  0xdb,0x28,0x1e,0x78,0x3a,0x8e,0x44,0x11,0x66,0x6f,0x63,0x68,0x3b,0xc0,0x13,0x84,
+  0x6c,0x62,0x96,0xc3,0x48,0x63,0xd8,0x77,0x14,0x9d,0x94,0x49,0x84,0xc0,0x48,0x2b,
+  0xf3,0x1c,0xec,0xe5,0x15,0x62,0x2d,0x9d,0x00,0x82,0xff,0x04,0xe4,0x28,0xc1,0xa9,
+  0xc4,0x82,0x83,0x11,0x40,0x74,0xc6,0xc3,0x4d,0x9c,0x73,0x3f,0xb0,0x46,0xab,0xa5,
+  0x66,0xa3,0x55,0xe2,0x81,0x2b,0xb4,0xba,0x61,0xca,0xad,0x2e,0x30,0x1a,0xf0,0x1f,
+  0x81,0xc1,0xf2,0x66,0x88,0x8b,0x12,0xfc,0x64,0x22,0xa2,0xc8,0x92,0xf8,0x31,0x35,
+  0x5c,0xc7,0x28,0x5e,0x97,0x4a,0x87,0xd1,0xe0,0x94,0x64,0x78,0x31,0x22,0xc3,0x14,
+  0xab,0x22,0xd9,0xb9,0x6f,0xee,0x5a,0x59,0x6b,0x8c,0x16,0xd6,0x1f,0x84,0xa2,0xf9,
+  0x23,0x7a,0x2d,0xf1,0x8e,0xb6,0x3d,0x89,0x97,0x88,0x8c,0x32,0x0a,0xba,0x33,0x25,
+  0x1c,0xce,0xf2,0x13,0x47,0x98,0x48,0x1b,0x15,0xa3,0x61,0xcd,0x8e,0x1e,0x05,0xd3,
+  0x12,0x91,0x12,0x23,0xa0,0x52,0xce,0x48,0xd9,0xc6,0x91,0xc2,0x25,0xaa,0x8c,0x0a,
+  0xfd,0x33,0x58,0x96,0x3f,0x81,0x95,0xfa,0x29,0xae,0xd3,0x4f,0x71,0x85,0xea,0x4b,
+  0x37,0x34,0xde,0x61,0x1d,0x7d,0x21,0x97,0x65,0x1a,0x1a,0x38,0x8f,0xd9,0x58,0x24,
+  0x26,0x29,0x26,0xef,0xa2,0x08,0x61,0x26,0x13,0x68,0x32,0x6f,0x85,0xa1,0xbc,0x61,
+  0x68,0x20,0x01,0x8a,0xdc,0x6c,0x7a,0x34,0xa3,0x7c,0x7b,0x5e,0x02,0x2e,0x47,0xc2,
+  0x4d,0xf7,0xa9,0x0b,0x48,0xb8,0xb8,0x88,0xfb,0x50,0xf7,0xf0,0xd8,0xe4,0x97,0x93,
+  0xf7,0x26,0x1f,0x7d,0xb5,0x22,0xed,0x39,0xcb,0xb4,0xbf,0x21,0xa1,0xf6,0xf5,0x4a,
+  0xb5,0x6f,0x80,0x58,0xfb,0x6b,0x91,0x6b,0x7f,0x6b,0x82,0x2d,0x34,0x19,0x67,0x12,
+  0x6a,0xc5,0x6d,0xc7,0x98,0xa0,0xd2,0xd2,0xfa,0x4b,0x85,0x65,0x98,0x0c,0x48,0xa2,
+  0xe1,0xf5,0x47,0x94,0x98,0xd0,0xd5,0x3b,0x60,0x97,0x25,0xc5,0x68,0x42,0x80,0xe9,
+  0x99,0xcd,0x3a,0xdb,0x74,0x5b,0xc4,0xf8,0x5d,0x37,0x27,0x4a,0xf0,0xbb,0xc9,0x6f,
+  0x37,0x5a,0xd1,0x74,0x25,0x5b,0x6f,0xed,0x8e,0x72,0x9a,0x93,0x54,0xcd,0x07,0xb0,
+  0x30,0xa5,0x77,0x23,0xaf,0xf1,0xe2,0xd4,0xbe,0x73,0x9b,0x2f,0xe5,0x34,0xff,0x15,
+  0xb1,0xf9,0x97,0x40,0xe1,0xc7,0x6c,0x29,0x0f,0xc8,0x72,0x41,0x20,0xcb,0xe9,0x5c,
+  0x7f,0xe6,0x3c,0x30,0x23,0x13,0x18,0xa7,0x62,0x02,0xe3,0xb4,0x4c,0x60,0x9c,0x86,
+  0x09,0x8c,0xd3,0x31,0x81,0x71,0x16,0x4c,0x60,0x3c,0x07,0x26,0x60,0x32,0xdf,0x82,
+  0x47,0x51,0xa8,0x1f,0xfe,0x66,0x03,0xdf,0xa0,0xd3,0x97,0xc7,0x25,0x5f,0x1c,0xff,
+  0x08,0x63,0x3b,0xa0,0xa7,0x9e,0xf2,0xb8,0xe4,0x43,0xb9,0xa1,0xd0,0x66,0xfa,0xde,
+  0x46,0xae,0xc1,0x73,0x79,0x85,0x14,0x03,0xe8,0x6f,0x2f,0xea,0xdf,0x72,0x68,0x97,
+  0x1d,0x50,0xd0,0x2c,0x0a,0xa9,0x42,0xde,0x05,0xcf,0x10,0xd4,0x23,0xb8,0xfb,0x24,
+  0x07,0xf1,0xb7,0xda,0xfd,0xca,0x3c,0x55,0x94,0x90,0x65,0xa7,0x94,0xb1,0x57,0x92,
+  0xe6,0x0b,0x37,0x4b,0x28,0xdf,0x60,0xd3,0xdd,0xd7,0x87,0x1f,0x75,0xaf,0xab,0x30,
+  0x9e,0x4a,0x56,0x8a,0x62,0xa5,0xa2,0x9f,0x0c,0xed,0xdc,0x3c,0x99,0x66,0xd6,0xf4,
+  0xb2,0x36,0x2b,0x5c,0x2d,0xfb,0x84,0x97,0xb6,0xf2,0xf4,0xbc,0x19,0x49,0x53,0x11,
+  0xe4,0xc2,0x39,0xd2,0x49,0x02,0x13,0x08,0x0b,0x1c,0x54,0x30,0x2c,0xee,0x9f,0xc5,
+  0x8b,0x3e,0xa4,0xf9,0xfc,0x13,0x7a,0xe3,0xa8,0x5e,0x6a,0x3c,0x0c,0x27,0xea,0xa8,
+  0xb4,0xc3,0x6c,0x87,0x54,0x8b,0x4f,0x88,0xad,0xa0,0xb5,0xe1,0x07,0xa6,0x17,0x94,
+  0x66,0x6e,0x66,0x39,0xbd,0x58,0xa3,0x14,0xf3,0x31,0x17,0x82,0x67,0xf5,0xc6,0x5d,
+  0xec,0x39,0x45,0x37,0x27,0x88,0x35,0x13,0x76,0xc6,0xc9,0x06,0x65,0x9c,0x7a,0x50,
+  0xc6,0x73,0x1c,0xd4,0xc2,0xc9,0x06,0xb5,0x70,0xea,0x41,0x2d,0xe4,0x0c,0x4a,0x4d,
+  0xc4,0x09,0x5b,0xc0,0x4b,0x3f,0xe4,0xef,0x8c,0xa5,0x2c,0x9c,0x08,0xb9,0x7a,0x31,
+  0x42,0xf8,0x34,0xbe,0x64,0x8b,0x00,0x30,0x42,0x00,0xef,0xe1,0x0a,0x9a,0x1d,0xc0,
+  0x42,0x08,0xe0,0x77,0xc7,0x0f,0x4f,0x02,0x60,0x31,0x04,0xf0,0x1f,0x27,0xc3,0x60,
+  0x29,0xa2,0xc1,0xc9,0x00,0x2c,0x47,0x43,0x98,0xfc,0xe1,0x24,0x00,0x9a,0x21,0x80,
+  0xdf,0x4c,0x3e,0x49,0x17,0x9c,0x85,0x1c,0x28,0x70,0x9c,0xae,0x71,0x2e,0x6f,0x9d,
+  0xdc,0x81,0x3a,0x85,0x36,0x34,0xce,0x4a,0x1b,0x9e,0x42,0x1d,0x1a,0x5f,0xaf,0x3a,
+  0x34,0xfe,0x4a,0xd5,0xa1,0xf1,0x37,0xa0,0x0e,0x8d,0x93,0xa9,0x43,0xe3,0xd4,0xea,
+  0xd0,0x78,0x8e,0xea,0xd0,0x38,0x99,0x3a,0x34,0x4e,0xad,0x0e,0x8d,0xe7,0xa8,0x0e,
+  0x8d,0x93,0xa9,0x43,0xe3,0xd4,0xea,0xd0,0x98,0x59,0x1d,0x1a,0xdf,0xaa,0xc3,0x6f,
+  0xd5,0xa1,0xf1,0x5c,0xd4,0x61,0xfe,0xae,0x3a,0x67,0xbf,0xf0,0x20,0x6d,0xb6,0x6a,
+  0xfc,0x88,0xa7,0x4a,0x4c,0x3e,0x81,0x3f,0x7f,0xa6,0xf8,0x15,0x6a,0xa5,0xa7,0x18,
+  0x47,0xfb,0x1c,0xf3,0x31,0x50,0x5f,0x25,0xf4,0xa1,0x38,0x40,0x1d,0x8d,0x38,0x3b,
+  0x4e,0x1b,0xe1,0xe1,0x59,0xa0,0x46,0xc9,0x91,0xff,0x1c,0xc0,0x3e,0x05,0x5d,0xab,
+  0x0d,0x78,0x06,0x48,0x3e,0x5e,0xe2,0x89,0x80,0x48,0x9f,0x47,0x3a,0x35,0x02,0xa6,
+  0xea,0x6e,0x3a,0xe3,0x1d,0xae,0xd7,0xf4,0x6e,0xe4,0x84,0xa8,0x9d,0x60,0x20,0x78,
+  0xea,0x04,0xa9,0x44,0x51,0x4f,0x8c,0xe3,0x9d,0xa1,0xf8,0x0c,0x7f,0xf1,0x4c,0xf0,
+  0xc0,0xc3,0x9f,0x98,0xaa,0xf2,0xa1,0x96,0xaa,0x22,0xf5,0x15,0x94,0x89,0xf2,0x8f,
+  0xa2,0x8c,0x3b,0xa5,0x6c,0x1e,0x01,0xcc,0x4b,0x60,0x98,0x57,0xae,0xe0,0x4a,0xcf,
+  0x25,0xd1,0x49,0x2f,0x5d,0xbe,0xc9,0xc9,0x0f,0x0f,0x54,0xb3,0xc0,0x1d,0x93,0x1c,
+  0xc3,0x16,0x33,0xb4,0xf2,0xc7,0x23,0xd9,0x8a,0x90,0xfa,0xb6,0xd3,0x6f,0x5e,0xa7,
+  0xf3,0x01,0x3f,0xb9,0x30,0x2f,0x98,0x38,0x62,0x76,0x85,0xe9,0xf0,0x28,0x79,0x29,
+  0x12,0x09,0xf4,0x04,0xe6,0x9e,0x25,0xb3,0x36,0x4a,0xcc,0xf4,0x6c,0xb3,0x3e,0xb0,
+  0x77,0xe1,0xd5,0x08,0x0c,0xc9,0xc0,0x2a,0x9d,0x30,0xe8,0xf9,0xd1,0xe4,0x9d,0xba,
+  0x58,0x84,0x8f,0x26,0x4f,0x8e,0x7f,0x01,0x4b,0x11,0xd6,0x7e,0xe1,0x30,0x16,0xdd,
+  0x85,0x53,0x2a,0x66,0xd2,0x8f,0xec,0xd6,0xc6,0x2b,0x76,0xaa,0x1d,0xff,0x0a,0xa6,
+  0x4c,0xa1,0x21,0x4a,0xc9,0x48,0x94,0x05,0x31,0x79,0x52,0x6d,0xc7,0x8c,0x4d,0xa4,
+  0x50,0x1a,0x90,0xdc,0xdd,0xb6,0x66,0x33,0x7d,0xbf,0x2d,0x85,0x52,0xf9,0x98,0x8f,
+  0xd2,0x31,0x9f,0x7c,0x89,0xb9,0x67,0x94,0x47,0xfc,0x25,0x89,0xcd,0x77,0xb2,0xf1,
+  0x1e,0x7d,0x0d,0x78,0xaf,0xa7,0x53,0x7c,0x9d,0x28,0xfe,0x13,0x4c,0xdf,0x62,0x40,
+  0xf8,0x2f,0x26,0x5f,0xd6,0xd8,0xf1,0x0f,0x33,0x51,0x5f,0xb7,0x4f,0xbd,0xc1,0x39,
+  0xab,0x8e,0xbf,0xb3,0xf6,0x7c,0xbc,0xdd,0xd3,0xae,0x85,0xb3,0x5a,0x0c,0xc6,0x59,
+  0x2c,0x06,0xe3,0xeb,0x58,0x0c,0xc6,0xe9,0x17,0x83,0xf1,0x75,0x2c,0x06,0xe3,0x4c,
+  0x16,0x83,0xf1,0xf5,0x2c,0x06,0xe3,0x2b,0x5e,0x0c,0xef,0xa3,0x29,0x89,0xf9,0xc3,
+  0x60,0x4e,0xfd,0x44,0x44,0x76,0x70,0x85,0x4c,0xde,0x67,0x60,0x44,0x3d,0x99,0x9e,
+  0xd2,0x31,0xcb,0x6a,0xd8,0xda,0x1d,0xdd,0xb1,0x7b,0xd7,0xdf,0x4a,0x9d,0x9d,0xd2,
+  0xe4,0xd7,0xb4,0x59,0xfe,0x36,0x5a,0xa3,0x3c,0x21,0x19,0x10,0x2b,0xb1,0x0a,0x98,
+  0x70,0xa9,0x73,0x94,0x0e,0xed,0x6c,0x66,0x69,0xca,0x10,0x5e,0xe9,0xa7,0xc7,0xa9,
+  0xa2,0x8c,0x3f,0x5c,0x1d,0x98,0xb9,0xfa,0x39,0x65,0x07,0x7f,0x1a,0x1e,0x80,0xc8,
+  0x18,0x45,0x1c,0xe0,0x57,0x32,0x8a,0x9b,0xe6,0x7e,0xfa,0x30,0x7e,0x0d,0x0c,0xf1,
+  0xf9,0xf1,0x0f,0x1b,0x62,0x95,0x90,0x98,0xfc,0x19,0x2c,0x9a,0x4a,0xc6,0x6a,0xc9,
+  0x00,0xf7,0x15,0x2c,0x98,0x97,0xa9,0xe7,0xaf,0x78,0xcd,0xfc,0x2b,0x26,0xc4,0xa3,
+  0x03,0xa2,0x45,0x41,0xcf,0x64,0x85,0xf0,0x4b,0x4e,0xae,0x8d,0x03,0xb7,0x9f,0xce,
+  0x62,0xeb,0xff,0x45,0x49,0xc0,0x1f,0xc0,0xe2,0xfc,0x1c,0x66,0xe5,0xe7,0xb0,0x68,
+  0x3f,0x95,0x99,0x25,0xcf,0x28,0xab,0xe4,0x49,0x1e,0xb7,0x65,0xc3,0xcf,0x9d,0xac,
+  0xa5,0x33,0x99,0xac,0xbb,0x69,0x9d,0x7f,0xc5,0x2e,0x3d,0xde,0xa4,0x82,0xd7,0x9e,
+  0xe4,0x49,0x44,0xf0,0x85,0x81,0xac,0x9f,0xa1,0x9b,0xcd,0x44,0xda,0xfc,0x97,0x84,
+  0xd1,0x63,0x6e,0x1c,0xc0,0xeb,0x4a,0xab,0xfe,0xa6,0xed,0x59,0xd5,0xc4,0xa4,0xab,
+  0x04,0x90,0xd8,0xc4,0x4f,0xdd,0x33,0xfd,0x92,0x08,0x9d,0x50,0xee,0xde,0xdd,0xae,
+  0xe9,0xe4,0x64,0x6e,0xf1,0x00,0xc0,0x63,0x0c,0x00,0x44,0xb1,0xf0,0x9f,0xf2,0x88,
+  0x40,0xea,0xd6,0x3a,0x40,0xcc,0xcf,0xc9,0xfa,0x88,0xc7,0x29,0xca,0xc7,0xbf,0xc0,
+  0x08,0x06,0x01,0x24,0x07,0x5a,0x50,0x21,0xc7,0x65,0x17,0xd7,0x51,0x95,0xe2,0x2f,
+  0x31,0x63,0x4f,0xd2,0x7b,0x03,0x48,0x41,0xfb,0xb9,0x5a,0x70,0x1e,0x2a,0x8d,0x6c,
+  0x98,0x06,0xce,0xf6,0x50,0xc3,0xb7,0x06,0x54,0x8b,0xf3,0x6a,0x54,0x8b,0xee,0x62,
+  0x92,0x7c,0x29,0x1e,0xf8,0xe7,0x48,0xa0,0x90,0x5f,0x19,0x12,0xf6,0xc4,0x61,0xc4,
+  0xc3,0x81,0x0a,0x30,0xbc,0xa5,0xa9,0x74,0xf9,0x7c,0x2b,0x1e,0x96,0x8a,0x55,0xc3,
+  0xac,0xc4,0x10,0x28,0x3e,0x20,0x66,0xb1,0xf3,0x1a,0xb1,0x26,0xe2,0x7a,0x9e,0xb0,
+  0x15,0x3e,0xd3,0x78,0x64,0x75,0x8a,0x6b,0xca,0xd2,0x5d,0xd3,0x8b,0xef,0xfc,0x8b,
+  0x0a,0xe1,0xcd,0x40,0xd0,0xd4,0x1d,0x21,0x2f,0xc9,0xe1,0x50,0x16,0xe8,0xa7,0x42,
+  0xb3,0xc0,0x44,0x3d,0xa5,0x43,0x30,0xb8,0xd6,0x9f,0xad,0xcc,0xf3,0xaa,0xf1,0x26,
+  0xeb,0x0e,0x08,0x0c,0x27,0xb3,0xb4,0x85,0xe7,0x6b,0x32,0x4b,0x0d,0x3c,0xee,0x92,
+  0xdd,0x96,0x1a,0x67,0xb7,0x6e,0x61,0xf3,0x56,0x76,0x7b,0x03,0xdb,0x1b,0x39,0xbd,
+  0x53,0xf7,0xd9,0xed,0x17,0xb0,0xfd,0x42,0x76,0xfb,0x45,0x2c,0x5f,0xcc,0x2e,0x5f,
+  0x40,0xf8,0x0b,0xd9,0xf0,0x17,0xb1,0x7c,0x51,0x29,0x9f,0xe7,0xd3,0x92,0xbe,0x08,
+  0x12,0xfc,0x6e,0x14,0xe2,0x77,0xe3,0x0c,0xf8,0xdd,0x48,0x44,0xaf,0x93,0xfc,0x6e,
+  0xcc,0xcc,0xef,0xc6,0x89,0xf8,0xdd,0xc8,0xe3,0x77,0xe3,0x5b,0x7e,0xff,0xe6,0xf2,
+  0xfb,0x42,0x21,0x7e,0x5f,0x38,0x03,0x7e,0x5f,0x48,0x6c,0xb6,0x24,0xf9,0x7d,0x61,
+  0x66,0x7e,0x5f,0x38,0x11,0xbf,0x2f,0xe4,0xf1,0xfb,0xc2,0xb7,0xfc,0xfe,0xcd,0xe5,
+  0xf7,0xc5,0x42,0xfc,0xbe,0x78,0x06,0xfc,0xbe,0x98,0xd8,0x1b,0x4c,0xf2,0xfb,0xe2,
+  0xcc,0xfc,0xbe,0x78,0x22,0x7e,0x5f,0xcc,0xe3,0xf7,0xc5,0x6f,0xf9,0xfd,0x9b,0xcb,
+  0xef,0x4b,0x85,0xf8,0x7d,0xe9,0x0c,0xf8,0x7d,0x29,0xb1,0x95,0x9d,0xe4,0xf7,0xa5,
+  0x99,0xf9,0x7d,0xe9,0x44,0xfc,0xbe,0x94,0xc7,0xef,0x4b,0xdf,0xf2,0xfb,0x37,0x97,
+  0xdf,0x97,0x0b,0xf1,0xfb,0xf2,0x19,0xf0,0xfb,0x72,0x22,0xf3,0x22,0xc9,0xef,0xcb,
+  0x33,0xf3,0xfb,0xf2,0x89,0xf8,0x7d,0x39,0x8f,0xdf,0x97,0xbf,0xe5,0xf7,0x6f,0x2e,
+  0xbf,0x5f,0x28,0xc4,0xef,0x17,0xce,0x80,0xdf,0x2f,0x84,0xfc,0x7e,0x21,0x93,0xdf,
+  0x2f,0xcc,0xcc,0xef,0x17,0x4e,0xc4,0xef,0x17,0xf2,0xf8,0xfd,0xc2,0xb7,0xfc,0xfe,
+  0x37,0xcc,0xef,0xa7,0xb9,0x4e,0x25,0x2b,0x07,0x3a,0x71,0x94,0xf3,0xa9,0xbc,0x4c,
+  0x89,0x2e,0xe0,0xf9,0xec,0x6c,0x76,0x8c,0xc7,0xc3,0x51,0x6b,0x03,0x53,0x62,0xd3,
+  0xf7,0x66,0xb4,0xab,0xa5,0x58,0x45,0xdf,0xb4,0xae,0x9e,0x3c,0x15,0x5a,0xe9,0x77,
+  0x96,0x1c,0xe8,0xe2,0x43,0x32,0x0a,0x0d,0xc9,0x38,0xf3,0x21,0x19,0xcf,0x6b,0x48,
+  0xc6,0x49,0x67,0xe9,0xb4,0x63,0x32,0x9e,0xdf,0x34,0x19,0x27,0x9d,0xa6,0xd3,0x8f,
+  0xe9,0x34,0xf3,0x94,0xbf,0xa9,0x0e,0xe0,0xfd,0xaf,0x78,0x8b,0x30,0xeb,0xbe,0x06,
+  0x9e,0x7d,0x90,0x73,0xe9,0x4b,0x8a,0xa8,0x88,0xee,0xdc,0x2d,0xa9,0x5b,0x79,0xf8,
+  0x7a,0x63,0x7b,0x3b,0xbe,0x65,0x37,0xb4,0x1d,0xcc,0xc1,0x65,0x43,0x73,0x7f,0xb5,
+  0x64,0x2c,0xa4,0x6e,0xf2,0x8d,0x06,0x66,0xd7,0xda,0x76,0x07,0x40,0xdc,0xd5,0xd2,
+  0xe4,0x97,0x93,0x5f,0xca,0x94,0xdd,0xf0,0x4a,0xa1,0x58,0x37,0xc3,0x61,0x6e,0x37,
+  0x4b,0x97,0x0a,0x74,0xf3,0xef,0x93,0x7f,0x2f,0x69,0x7a,0x96,0x20,0xf7,0x70,0x9f,
+  0x2c,0xa9,0x67,0x13,0xda,0xb5,0x55,0x12,0x59,0xdd,0xe9,0xfa,0x00,0xb4,0x01,0xcf,
+  0xd9,0x4e,0x2f,0x5e,0x28,0x89,0x8c,0xec,0xf4,0xe2,0xc5,0x92,0xc8,0xb7,0x4e,0x2f,
+  0x5e,0x2a,0x89,0x6c,0xea,0xf4,0xe2,0xe5,0x92,0xc8,0x95,0x4e,0x2f,0x6e,0x96,0x44,
+  0x26,0xf4,0x74,0xcb,0x2c,0x97,0x8d,0xd7,0xd5,0xe4,0xfc,0x24,0x17,0xbf,0x47,0x57,
+  0x7c,0xf1,0x4b,0x05,0x3e,0x9e,0x7c,0xc6,0xb7,0x05,0x89,0xdb,0xce,0x28,0x4f,0xe4,
+  0x31,0x3f,0xa3,0x2f,0x4f,0x49,0x3f,0xa4,0x4b,0x02,0x68,0x57,0xf4,0x4c,0xf4,0x5e,
+  0x37,0xf0,0x06,0x6b,0xf8,0x6d,0x80,0x74,0xe1,0xf3,0x0e,0x0c,0xec,0x13,0x58,0xa2,
+  0x9f,0xa3,0xf8,0x49,0xc1,0x21,0x6d,0xb3,0x3b,0x03,0xa4,0xb6,0xd3,0x8d,0x77,0x6f,
+  0xc4,0x39,0x15,0x17,0x2f,0x58,0x71,0x8d,0x1a,0xbb,0x7a,0x71,0x03,0x73,0x92,0x66,
+  0xce,0x5b,0x4f,0x74,0x7c,0x2a,0xa9,0xf3,0x15,0x5c,0xeb,0xc0,0x73,0x9e,0x9c,0x9b,
+  0x78,0x39,0x7e,0x08,0x56,0xfb,0x3c,0x83,0x4c,0x4d,0xe5,0xd7,0xef,0x8b,0xd4,0x54,
+  0xaa,0x01,0x44,0xf4,0xf0,0x66,0x14,0x9e,0xac,0x8a,0x93,0x30,0xb0,0x7a,0x9b,0x07,
+  0x04,0x70,0x9d,0xb3,0x8f,0x4a,0x39,0xf5,0x16,0xff,0xb4,0x12,0xf9,0x19,0x04,0xce,
+  0x8b,0x02,0x31,0x01,0x67,0xf2,0x1e,0x60,0xff,0x29,0x5e,0x7f,0x06,0xb3,0xff,0x33,
+  0x76,0x67,0xed,0x56,0x9d,0x98,0xe1,0x13,0xce,0x82,0xca,0x34,0x40,0x9b,0x6b,0xf8,
+  0xad,0x84,0xd8,0x60,0xba,0xfc,0x1d,0x9f,0x7b,0x5e,0xbd,0x74,0xf9,0x3b,0x28,0x89,
+  0xfc,0x4e,0x7c,0x0a,0xd4,0x6c,0x30,0x67,0x8d,0x33,0x4d,0x26,0x1f,0x8d,0xe0,0xfd,
+  0x9e,0x8b,0xc6,0xa5,0xc6,0x4b,0xff,0xfd,0xf0,0xf7,0xe1,0x7f,0x25,0xfa,0xf8,0x4b,
+  0xd7,0x1d,0x8e,0x06,0x56,0x60,0x51,0x16,0x30,0xde,0x5e,0x5f,0x8f,0x9a,0x2a,0x39,
+  0x16,0x20,0x67,0x2d,0xcf,0xee,0x96,0xd8,0xbc,0x36,0x41,0xf4,0x59,0x06,0xee,0x69,
+  0xd0,0xbd,0x8c,0x0f,0x45,0xca,0x56,0x44,0x89,0xc6,0x0c,0xbc,0x0a,0x00,0x6f,0xef,
+  0x64,0xf2,0x68,0x8c,0x4a,0x20,0x02,0x3f,0x00,0xca,0x63,0x7a,0x16,0xf2,0xed,0x27,
+  0x5c,0xc6,0x4c,0x13,0x2e,0xd8,0x8d,0x39,0xb0,0xbc,0xa0,0x00,0x6b,0x51,0xbd,0x19,
+  0xf8,0x8b,0xea,0xab,0x1c,0xa6,0x77,0x76,0x5d,0x40,0x3a,0x31,0xdf,0xa9,0xf0,0x41,
+  0xc2,0xcb,0xbb,0x30,0xff,0x59,0x26,0xd8,0x70,0xa6,0xe3,0x63,0x1d,0x29,0x9d,0x5b,
+  0xbe,0x4f,0xab,0x53,0xb8,0x19,0xb1,0x73,0x7e,0xfa,0xd5,0x3e,0x2d,0x7e,0xe5,0xce,
+  0xca,0xfc,0xa8,0xd8,0x94,0x51,0x0f,0xc5,0x27,0xed,0xf6,0x2b,0x39,0x13,0x14,0x5e,
+  0xc8,0xbf,0x07,0xce,0xb0,0xbb,0xd7,0xd8,0xd8,0xc0,0x54,0x73,0xb6,0xca,0x2a,0xfd,
+  0xb1,0x43,0x08,0x54,0xaa,0x87,0x73,0xfc,0xb6,0x7e,0x51,0x72,0xc8,0xb8,0x4b,0xdf,
+  0x66,0x7d,0x73,0xe0,0x5b,0x35,0x06,0x33,0xe8,0xe3,0x17,0x1f,0xc0,0x77,0xaa,0xb1,
+  0xbe,0x6d,0x0d,0x7a,0x7e,0x9b,0x1d,0x1e,0xd5,0x98,0x3f,0xde,0x84,0x5f,0xf7,0xee,
+  0xb3,0xa3,0xce,0x9c,0x04,0xc7,0x76,0x6d,0x6b,0x2f,0x82,0xe9,0x81,0x80,0x42,0x98,
+  0x58,0xc3,0xf5,0x58,0x85,0xbf,0xbd,0xb7,0x03,0x50,0xef,0x33,0xb7,0xcf,0x6e,0x6f,
+  0xfe,0x00,0xf4,0x64,0x03,0xd6,0x88,0x67,0x5b,0x7e,0x05,0x51,0x68,0xf0,0x2e,0xaa,
+  0x55,0x26,0x81,0x8c,0x4c,0x2f,0xf0,0x01,0xca,0x4e,0xc3,0x1f,0x0d,0xec,0xa0,0x52,
+  0x6e,0x94,0xab,0x1d,0x06,0x2b,0x8c,0xb9,0xf0,0x16,0xbb,0x10,0xd0,0xf1,0x95,0x0d,
+  0xaf,0x60,0x06,0x6c,0xb6,0xc2,0xdb,0x35,0x06,0x96,0xb3,0x15,0x6c,0xb3,0x3a,0x6b,
+  0xc1,0xdb,0x17,0x5f,0xac,0x52,0x23,0xf7,0x1e,0x15,0xde,0xb3,0xef,0xdf,0x8f,0x3d,
+  0xfd,0xd3,0x3f,0x11,0xb6,0xf2,0x55,0x1c,0x06,0xd5,0xdf,0xed,0xcc,0x1d,0xcd,0x79,
+  0x60,0xae,0x79,0x8e,0xe8,0xfe,0x28,0x22,0xc0,0x68,0xbc,0x39,0xb0,0xfd,0xed,0x4a,
+  0x77,0xdb,0x74,0xb6,0xf0,0x23,0x0b,0x62,0x14,0xbb,0xd8,0x90,0x88,0xd3,0x99,0xa3,
+  0x71,0x22,0xf9,0xf0,0x2b,0xa0,0x37,0xcc,0xee,0x76,0xa5,0xef,0xb0,0xd5,0xcb,0x40,
+  0xfb,0x00,0x24,0xfb,0x21,0xeb,0x3b,0x95,0xdd,0x1a,0x93,0x10,0x3a,0xec,0x88,0x75,
+  0x4d,0xfc,0x52,0x53,0xc5,0x02,0xaa,0x30,0x84,0x07,0xab,0x89,0xbe,0x8f,0x52,0x29,
+  0xd3,0xb4,0x21,0x2c,0x98,0x68,0xb0,0xdb,0xca,0x35,0x66,0x51,0x8b,0xa3,0x2a,0xa2,
+  0x45,0x3d,0x01,0x56,0xab,0x2c,0x9c,0xf0,0xbe,0x53,0x3d,0x64,0x11,0x06,0xa3,0xb1,
+  0x8f,0xdd,0x43,0x1b,0xbb,0xcf,0xf8,0x0c,0x70,0x06,0xa8,0x12,0x1a,0x84,0x71,0x8d,
+  0x39,0xe3,0xc1,0x00,0xc1,0x2a,0x33,0x0d,0x68,0x38,0x30,0x79,0x38,0xd9,0xd8,0xf2,
+  0x9c,0x60,0xb1,0x1b,0xbb,0x30,0x9b,0x77,0xdd,0xb1,0xd7,0x05,0x08,0x9c,0x48,0x1d,
+  0x41,0x02,0x0b,0x67,0xd1,0xb1,0xf6,0x98,0x52,0xa7,0x52,0x9e,0x37,0x47,0xf6,0x3c,
+  0xf6,0x0b,0xb3,0x3a,0x67,0xf9,0x0d,0xb3,0xd7,0xa3,0xf2,0x57,0x6d,0x3f,0xc0,0x4b,
+  0x87,0x2a,0xe5,0x3e,0x74,0x8e,0xe3,0x22,0x12,0x09,0x58,0x43,0x00,0xf5,0x3f,0xef,
+  0xde,0xbe,0xd5,0x80,0x19,0xf2,0xad,0x8a,0xd5,0xc0,0x6b,0x31,0x25,0x69,0x39,0x0b,
+  0x41,0x8d,0x61,0xa3,0xdf,0xe1,0x63,0x15,0x5c,0x4c,0xef,0x76,0xc5,0x3b,0x3e,0x4e,
+  0x78,0x85,0xd2,0xa7,0x33,0x27,0x67,0x8e,0x8f,0x75,0xee,0x28,0x0b,0x9d,0x9e,0x35,
+  0x08,0xcc,0xa2,0xf8,0x20,0x69,0xa0,0x47,0x76,0x6e,0x75,0x55,0x47,0xe4,0x45,0xd6,
+  0xc2,0xc9,0x84,0x1e,0x48,0x63,0x55,0xaa,0x71,0xa4,0x68,0xf9,0x75,0x18,0x98,0x53,
+  0x68,0x17,0xba,0xe3,0xa0,0x22,0x28,0x5e,0x63,0xad,0x66,0xb3,0x09,0xf5,0x05,0x75,
+  0x61,0xb2,0xe7,0xe7,0x19,0xe5,0x78,0x3d,0xc3,0x54,0x4e,0xcc,0x49,0x65,0x5c,0x86,
+  0x83,0xc5,0xf8,0xc1,0xf1,0x87,0xc0,0xb8,0xd2,0x68,0xc4,0xdc,0xdf,0x3f,0x53,0x62,
+  0xe3,0x17,0xf0,0xe2,0xf3,0xb9,0x14,0xda,0xcc,0x89,0x45,0x09,0xc2,0xc7,0xde,0x72,
+  0xd4,0x35,0x59,0x43,0x7a,0x56,0x23,0x42,0x89,0x8a,0x3b,0xd6,0x81,0x5f,0xc1,0x92,
+  0x88,0x68,0xae,0x43,0xdf,0x4f,0x44,0x41,0x53,0xe5,0x8c,0x9d,0x3a,0xb6,0x23,0x64,
+  0xd1,0x90,0x8f,0x3a,0x72,0x4d,0x61,0x5d,0x04,0x85,0xaf,0x14,0x41,0x05,0xb4,0x0e,
+  0x99,0x0f,0x3f,0xcc,0x78,0x07,0x44,0x70,0x65,0xdb,0xf4,0xb7,0xb1,0xa4,0xe7,0x76,
+  0x41,0x9f,0x3a,0x41,0xe3,0x1f,0xc7,0x96,0x77,0x70,0x57,0x9c,0x31,0xbd,0x3a,0x18,
+  0x80,0xb8,0x08,0xaf,0xb2,0x2a,0x57,0xc3,0x05,0x07,0x46,0x29,0xe0,0x65,0x0d,0x1a,
+  0x24,0xc2,0x1b,0xe2,0x3a,0x2b,0x40,0xad,0x8c,0x37,0x5a,0x21,0x2b,0xf2,0x79,0x0d,
+  0x40,0xb4,0x5b,0x28,0xc3,0xb0,0x23,0xf6,0x9d,0xef,0xb0,0xf4,0x8e,0x04,0x1e,0x57,
+  0xf2,0x8b,0xdb,0x59,0xc5,0xe5,0xc8,0xe4,0x2b,0x0b,0xa6,0xe1,0x1d,0x23,0x8b,0xf0,
+  0x5f,0x49,0x44,0x29,0xcb,0xb1,0x0c,0x54,0x9c,0x13,0x4b,0x0f,0x44,0x80,0x3b,0x18,
+  0xac,0xbb,0x15,0x68,0x83,0xa7,0xd3,0x9b,0x35,0xb6,0x69,0x6d,0x9b,0xbb,0xb6,0xeb,
+  0xb5,0x59,0xd9,0x86,0xe1,0x98,0x4e,0x50,0x16,0x92,0x41,0xb4,0x49,0xb2,0x37,0xa2,
+  0xca,0x45,0x0f,0xf0,0x38,0x9f,0xbe,0x90,0xda,0xd0,0xa3,0x89,0xf4,0x6f,0xd0,0x78,
+  0x00,0x4e,0x38,0x9e,0x24,0x9c,0xeb,0xb7,0x6f,0x5e,0xe3,0xe9,0x90,0xaf,0xba,0x66,
+  0xcf,0xea,0x15,0x80,0x16,0x9b,0x72,0x56,0x51,0x94,0x80,0x30,0x5d,0x61,0xe0,0x61,
+  0x9f,0x40,0x95,0x1b,0x03,0x0b,0x7f,0x7e,0xef,0x60,0xad,0x57,0x29,0xcb,0x3a,0xd1,
+  0xec,0x49,0xb3,0x6e,0x4a,0x2b,0xaa,0xa3,0xb5,0xba,0x21,0xd8,0x37,0xaf,0x15,0xd5,
+  0xd1,0x5a,0xdd,0xde,0xf9,0x5e,0xe0,0x4c,0x69,0x75,0x7b,0x47,0x6b,0x42,0x26,0xec,
+  0xf4,0x56,0x54,0x2d,0x6a,0x78,0xf5,0xda,0xb5,0x1b,0x77,0xef,0x6e,0xbc,0x72,0xe3,
+  0xfb,0xc8,0x08,0xe2,0x6e,0xb6,0x0d,0xb3,0xdb,0x05,0xc3,0x64,0x63,0xcb,0x83,0x69,
+  0x06,0x7a,0x77,0x62,0xcb,0x45,0x50,0x87,0x88,0x2a,0xd1,0xcf,0x60,0xff,0x4e,0x48,
+  0xb9,0x06,0xf9,0xb8,0x58,0x00,0x2f,0x43,0x0c,0xe9,0x3b,0x5b,0x64,0x9f,0xe0,0x7c,
+  0xe3,0xe4,0x57,0xca,0xd1,0x67,0xb7,0x10,0x4f,0x39,0x17,0xf1,0x5a,0x5c,0x04,0xa0,
+  0x02,0x57,0x04,0x1b,0xe7,0x8b,0xb0,0x4b,0xfa,0x20,0x37,0x6a,0x9d,0xa5,0x66,0x55,
+  0xd3,0xad,0xdb,0x76,0xcf,0x52,0x87,0x11,0x35,0xd9,0x1c,0x8c,0x3d,0x14,0xa1,0x29,
+  0xdd,0x82,0xf9,0x05,0x56,0xa8,0xda,0x73,0xd6,0x30,0x64,0x4d,0x6d,0x24,0x4c,0xe9,
+  0x9f,0x3e,0x92,0x74,0xd5,0xe9,0xbd,0xec,0x52,0xef,0x5c,0x59,0xfb,0x40,0x73,0x28,
+  0xbc,0x0b,0xeb,0x18,0x98,0x1a,0x3f,0xd7,0xbe,0x16,0x58,0xc3,0x4a,0x34,0x45,0x35,
+  0x56,0x6e,0x95,0xe3,0x5a,0xfc,0x28,0x36,0x18,0x90,0xfe,0xea,0x6a,0x40,0x82,0xcb,
+  0x6b,0x9a,0xcb,0x1a,0x0e,0x14,0x58,0x83,0x76,0x84,0x01,0x0a,0x8a,0x4a,0x6c,0xaa,
+  0xc0,0x82,0x29,0x83,0xa0,0x03,0x8b,0x6a,0x88,0x74,0x05,0xbd,0x13,0x7e,0x87,0x09,
+  0x9b,0xa8,0x63,0x40,0x9c,0x2c,0x90,0xc4,0x9c,0x92,0x19,0x0c,0x21,0xc5,0x4c,0xd8,
+  0x0d,0x0f,0x6e,0xf0,0xd6,0x47,0x79,0x82,0xd7,0xbc,0x17,0xbb,0x6f,0xfa,0xbe,0x22,
+  0x80,0x07,0xb6,0xb3,0xc3,0x15,0x28,0xfe,0x4a,0x91,0x1f,0xdd,0x81,0x0d,0xfd,0xd6,
+  0x58,0x24,0x0d,0x90,0x6e,0x73,0x9c,0xe8,0x38,0xf0,0x18,0xe1,0xb7,0x12,0x84,0xe7,
+  0xa3,0x47,0xe2,0x2b,0xaa,0x52,0x9d,0x83,0x39,0xab,0x31,0xf2,0x2c,0xec,0xf6,0xba,
+  0xd5,0x37,0xc7,0x03,0x1a,0x94,0xbe,0x56,0xb8,0x4a,0x3b,0xe2,0x1c,0x4d,0xeb,0x3b,
+  0x07,0x55,0x39,0x37,0xbc,0xb6,0x5c,0xda,0x39,0x0d,0x54,0x1e,0xe0,0x8d,0x38,0x89,
+  0x93,0x2d,0x40,0xc9,0x82,0xb8,0x76,0x50,0x88,0x5a,0xbb,0x42,0xa7,0x22,0x11,0xac,
+  0x5d,0xd4,0xbf,0x7c,0xa0,0x37,0xf0,0xaa,0x88,0x32,0x59,0x15,0xbb,0x29,0x03,0x8b,
+  0x38,0x07,0xe9,0x90,0x68,0xec,0x77,0xcd,0x91,0x95,0xdd,0x3a,0xce,0xae,0xdc,0xc2,
+  0x0c,0xd7,0x5b,0xf6,0x18,0x13,0xf8,0x4a,0x95,0x0a,0xbd,0xca,0xe6,0xd5,0x24,0xf8,
+  0x50,0xd6,0x45,0xee,0x5e,0x9e,0x8c,0x8c,0x6a,0x95,0x53,0x5a,0x72,0x47,0xb1,0x58,
+  0x7b,0x5e,0x37,0x06,0x85,0x7c,0xc4,0xa9,0xed,0xa9,0x56,0xbc,0x7f,0xee,0x2b,0x4e,
+  0xef,0x9b,0xd7,0x8b,0xb5,0xbe,0xbd,0x33,0xb5,0x21,0x57,0x28,0xd2,0x04,0x00,0xe6,
+  0xbd,0x8a,0x6f,0xd1,0xf4,0x22,0x7f,0x17,0x8c,0x36,0x0e,0xb9,0x46,0x8e,0x23,0xae,
+  0x68,0xdb,0xe9,0xbb,0x65,0x3e,0x27,0x73,0x11,0xde,0x0d,0x0c,0x94,0x09,0x8d,0x8d,
+  0x36,0x31,0xbe,0xeb,0xcc,0xa9,0xb8,0x35,0x6c,0xb0,0xd4,0xbc,0xbf,0x5f,0xbf,0xf9,
+  0x2a,0x9a,0x8a,0xfc,0x9d,0xac,0x11,0x51,0x8e,0x0b,0xd4,0x5b,0xe6,0x90,0xfa,0x52,
+  0x7d,0xf2,0xb2,0xb0,0x6c,0x08,0x0d,0xe4,0x39,0xfa,0xf2,0x23,0x60,0x92,0x0e,0x42,
+  0x51,0x1a,0xbc,0x5e,0xbc,0xb9,0xf8,0x40,0x64,0x01,0x00,0x61,0x4d,0xc5,0x62,0x99,
+  0xae,0xc3,0x22,0xa8,0x99,0x5a,0x6c,0x4e,0xf5,0x88,0x90,0x87,0xaf,0x86,0x6d,0x48,
+  0xcf,0xa6,0x82,0x48,0x68,0x24,0xee,0x40,0xa5,0xe8,0x2e,0x61,0xb9,0xfa,0x51,0x5d,
+  0xcd,0xd6,0x2d,0xa2,0xbf,0x40,0x7f,0x1e,0xcd,0x09,0x46,0x99,0x22,0x89,0x22,0xdc,
+  0xf5,0xc1,0x9f,0x6c,0x6d,0x47,0x00,0xaa,0x09,0xca,0xf0,0xf5,0x9d,0xb0,0xf0,0xa5,
+  0xb1,0xc7,0x2f,0x6f,0xc8,0x61,0x7c,0xe5,0x4e,0x87,0x32,0xd8,0x09,0x9b,0x81,0x73,
+  0xd7,0xf5,0x82,0xe9,0x2d,0xf0,0x5a,0x8c,0x68,0x85,0x41,0xb3,0xd7,0xf0,0xc6,0x8d,
+  0xa9,0xcd,0xe8,0x5e,0x0e,0xec,0x88,0x8e,0xf0,0x17,0x40,0x0c,0xab,0x45,0xfd,0xbc,
+  0xba,0x76,0x73,0x6d,0xfd,0x2e,0xc5,0x56,0xf0,0xf2,0x81,0x9b,0x18,0x2a,0xaa,0x1b,
+  0x46,0x8d,0x3f,0x99,0xfb,0x6d,0x66,0x80,0xa9,0x1e,0xf8,0x54,0xb0,0xc0,0x7f,0xe2,
+  0xdb,0x8b,0x4b,0xe8,0x21,0x85,0xa1,0x1b,0x82,0x8d,0x50,0xc0,0x4f,0x32,0x7b,0xaf,
+  0xb9,0x7b,0x7e,0x1b,0x94,0xe0,0x8e,0x3d,0x7a,0xc3,0x1c,0xd8,0xe0,0x6e,0x5a,0x62,
+  0x49,0xdf,0x6b,0x34,0x1a,0x44,0x9a,0x14,0x95,0x4c,0xf1,0xc7,0x46,0x74,0xaf,0x41,
+  0xb9,0x7a,0x5f,0x71,0x89,0x56,0x2f,0x5b,0x69,0x7c,0x6a,0x3b,0xbb,0xd8,0x43,0xb9,
+  0x1a,0x19,0xae,0xf8,0x71,0x4f,0x74,0xb0,0xf3,0xfa,0x0a,0x3c,0x84,0x3e,0x34,0x47,
+  0x15,0x6f,0xf5,0x72,0xe5,0x70,0xbf,0x7d,0x8b,0x76,0x96,0x2a,0x5e,0xdc,0xf9,0x69,
+  0x20,0x1d,0xc0,0x34,0x20,0xfb,0x05,0xa8,0x7c,0x90,0x53,0xd3,0x1f,0x8f,0x94,0x9a,
+  0xf8,0x4d,0x6c,0xef,0xa8,0x2a,0x56,0x10,0xc7,0x4a,0x46,0x6b,0xd0,0xe3,0x5e,0x92,
+  0x9a,0x1f,0x48,0xef,0xee,0xb4,0x45,0x44,0x6b,0xe8,0x6f,0xb5,0xcb,0x78,0x89,0x08,
+  0x7d,0xf4,0xe6,0x83,0xc9,0x1f,0xd0,0x3b,0x66,0xf4,0xf3,0x63,0xfa,0xb9,0xc4,0xe8,
+  0xc4,0xf8,0x4f,0xd0,0x45,0x6e,0x94,0x71,0x12,0x28,0xda,0xb4,0x23,0x42,0x05,0x04,
+  0x81,0x9b,0xc4,0x7c,0xe5,0xea,0x93,0x00,0xd6,0x35,0x47,0x44,0x12,0x76,0xb4,0x7a,
+  0x99,0xc7,0x48,0x6c,0x10,0x8b,0xb7,0x2a,0xa3,0xc6,0x7e,0x15,0xad,0x34,0xf8,0x9b,
+  0xad,0x08,0xe6,0x68,0x08,0xc6,0x90,0xef,0x2f,0x6b,0xef,0xcd,0xfd,0x2a,0x0d,0x20,
+  0xf2,0x9c,0x87,0xa6,0xb7,0xb3,0xc6,0xa7,0x05,0xe0,0x01,0x19,0x32,0x68,0x4a,0xf6,
+  0xab,0xda,0xf5,0x81,0xe8,0xfa,0x40,0xe9,0xda,0x0f,0x3b,0x3e,0x50,0x3a,0xf6,0x4f,
+  0xd6,0x2d,0x4d,0x10,0x75,0x1b,0xa9,0xf0,0x7d,0x64,0x15,0x41,0x14,0xe4,0x07,0x20,
+  0x08,0x12,0x81,0x53,0x0f,0x03,0x42,0x77,0xad,0xa0,0xb2,0xef,0x57,0x1b,0x18,0x33,
+  0xa5,0x89,0xdb,0x97,0xd3,0x98,0xc0,0x80,0x53,0x3e,0x76,0x45,0xcc,0x07,0x99,0xa7,
+  0xf8,0x68,0xcf,0x0c,0xab,0x7e,0xc9,0xaf,0x46,0xc3,0xa8,0x0b,0xd4,0x7b,0x7c,0xfc,
+  0x73,0xda,0x5f,0x98,0xfc,0x81,0x5f,0xb2,0xc3,0x8e,0x1f,0x51,0x54,0xe4,0x73,0x79,
+  0x59,0x35,0x9e,0xf7,0x9c,0x7c,0xd6,0x20,0xdb,0x3b,0x0c,0xf6,0x21,0x2a,0x34,0xf9,
+  0x35,0x31,0x9a,0xb6,0x3a,0x2a,0x60,0xf1,0xda,0xc1,0x51,0x95,0x78,0x1d,0x7f,0x54,
+  0x29,0xbe,0x51,0x9b,0x03,0xd9,0x21,0x16,0x2b,0xaf,0x2c,0x96,0x29,0x97,0xf9,0x7c,
+  0x21,0x01,0xf1,0xcf,0x5d,0xf5,0x3c,0xf3,0xa0,0x61,0xfb,0xf4,0x77,0x58,0x15,0xa7,
+  0x25,0x9b,0xad,0x3b,0x61,0x9c,0x75,0xaf,0xd0,0x6a,0x54,0x03,0xa5,0xab,0x18,0x26,
+  0x5d,0x59,0xe2,0x51,0xd1,0x43,0x02,0x71,0xcf,0xbe,0x9f,0xbb,0x36,0xc3,0x59,0xc4,
+  0x8a,0xfb,0x9d,0xec,0x36,0xca,0x2a,0xd5,0xda,0x1c,0x10,0x39,0x81,0x24,0x60,0xa6,
+  0xac,0xa3,0x90,0x04,0xa2,0xa0,0xd9,0x51,0x63,0xb6,0x4f,0xee,0xc7,0x2a,0x4d,0xb3,
+  0xa0,0x10,0x89,0xd1,0xb8,0x59,0x02,0x4f,0x1d,0x2e,0x87,0x75,0x43,0x83,0x8b,0xe6,
+  0x32,0x7b,0x11,0x79,0x9d,0x60,0x5d,0x29,0xf3,0x20,0x54,0xb9,0x0d,0xfe,0x10,0xbc,
+  0x2f,0x63,0xaf,0xb0,0x64,0x35,0xc7,0x13,0x96,0x66,0x26,0x34,0x9c,0xfc,0x1a,0x33,
+  0x8c,0x26,0x77,0x43,0x55,0x55,0xaf,0x2e,0x04,0x6b,0x50,0x15,0xfa,0x0f,0x34,0x9d,
+  0x95,0xb0,0x15,0x42,0xe9,0x89,0x63,0x17,0x9a,0x2a,0x4f,0xa5,0x56,0xd5,0xb0,0xa2,
+  0x47,0x31,0x53,0x5d,0x05,0x34,0xa4,0xf8,0xaf,0xa0,0x30,0xa2,0x38,0xa0,0xdf,0x10,
+  0x4c,0x82,0x0a,0xae,0x52,0x31,0x6b,0x9b,0x30,0x30,0xb3,0xb1,0x5f,0xdf,0xa4,0x65,
+  0x16,0x6b,0x2f,0x18,0xb2,0x12,0xb5,0x03,0x20,0xf1,0x3a,0x72,0x86,0x2a,0xe5,0xc9,
+  0xef,0x49,0x16,0xe2,0x59,0x59,0x7e,0x2e,0x99,0x72,0x44,0x1e,0x8a,0x75,0x45,0xfb,
+  0xd1,0xf4,0x21,0x40,0xb6,0xce,0xe8,0xfa,0xc6,0x27,0x93,0xcf,0xf0,0xc2,0x6d,0x56,
+  0xf9,0x3f,0xd5,0x46,0x59,0x38,0x4f,0x52,0xd5,0x16,0x1e,0x78,0x8f,0x7b,0x1e,0xc4,
+  0xd5,0x0c,0x74,0x07,0x6b,0xb5,0x50,0x31,0xb0,0x85,0x0b,0x30,0x25,0xf8,0xdc,0xa4,
+  0xc7,0xa5,0x45,0xf1,0x58,0x6f,0xf1,0x17,0xcb,0x4b,0xe1,0x8b,0x25,0x7a,0x71,0xa1,
+  0x29,0x5f,0xa0,0xc6,0x85,0x17,0x17,0x9b,0x47,0xec,0x7e,0x26,0x4d,0x64,0xbf,0xf9,
+  0x14,0xf9,0x88,0x86,0xfe,0x29,0x6d,0xce,0x7d,0xca,0xb5,0x07,0x5e,0x5e,0x29,0xf6,
+  0x8f,0x98,0x96,0x1b,0xf8,0xf4,0xf8,0x17,0x21,0x19,0x32,0x2d,0x9e,0x9b,0x57,0xff,
+  0x01,0x46,0x7a,0x21,0x65,0x3d,0x73,0x71,0x00,0xe5,0x42,0x97,0x56,0x36,0x6a,0x36,
+  0x4c,0x6e,0xa6,0x09,0xf2,0x40,0xe4,0x7b,0xbe,0x70,0x68,0xbf,0xd8,0x3a,0x7a,0x10,
+  0xe9,0x6c,0xcc,0xa2,0x3c,0x0d,0x50,0xca,0xc2,0x4c,0x40,0x15,0x59,0x97,0xa7,0x01,
+  0x4c,0x89,0x9a,0x09,0xc0,0x94,0x68,0x7a,0x1a,0xb0,0x98,0x8a,0x9a,0x80,0xca,0x63,
+  0x17,0xa7,0x01,0x8b,0x89,0xa3,0x49,0x2a,0xc0,0xb2,0xee,0x9a,0xb9,0x41,0x3c,0x7e,
+  0xea,0x5b,0x5a,0xab,0xe6,0xae,0x35,0xa5,0xb2,0xc9,0x3d,0x83,0x50,0xe2,0xf4,0x87,
+  0xc1,0x3a,0xcc,0x40,0x25,0x40,0x59,0xcd,0xd5,0x51,0x85,0x1b,0xda,0xb8,0x5f,0x81,
+  0x7a,0x82,0xab,0xf8,0xa0,0x8a,0x61,0xe8,0x92,0xc8,0x95,0x2d,0xb1,0x36,0x13,0xc6,
+  0x54,0x50,0x05,0x59,0xfe,0x92,0xbd,0x6f,0xf5,0x2a,0x06,0x8a,0xc3,0x12,0x95,0x6b,
+  0xb1,0x25,0xcf,0x72,0x7a,0x96,0x77,0xd7,0x72,0x40,0x8c,0xf8,0x15,0x9f,0xff,0x0d,
+  0x3c,0x1a,0x57,0x1a,0x40,0x31,0xa1,0x36,0xe6,0xa4,0x0a,0xc0,0xed,0x0e,0x5c,0xdf,
+  0x9e,0x8b,0x3b,0x21,0xa5,0x52,0x67,0x8e,0xf8,0x0d,0x8b,0x74,0x01,0x1e,0x62,0x06,
+  0x42,0x41,0xf0,0x4e,0x4a,0xa5,0x58,0xa9,0x2a,0x9b,0xd5,0x5c,0x5f,0xb1,0x7f,0x00,
+  0x33,0x80,0xb4,0xbf,0x69,0x06,0xdb,0x8d,0xa1,0xed,0x48,0xcc,0x85,0xca,0xac,0xe1,
+  0xea,0xaa,0x26,0x55,0x9f,0x23,0xc7,0x20,0x58,0x03,0x20,0x88,0x86,0xd0,0x65,0x27,
+  0x63,0x64,0x3e,0xfd,0x0d,0xd4,0xce,0x19,0xa2,0x9c,0x2a,0xbf,0x11,0x08,0x1b,0xc7,
+  0x07,0x5d,0xe8,0xa1,0x65,0x98,0x3d,0x64,0xaa,0x52,0x68,0xd4,0x6c,0x13,0x3f,0x29,
+  0x8f,0x63,0x17,0xc1,0xbb,0xd3,0x13,0x92,0x8d,0x9d,0x10,0xe8,0x1c,0x37,0x18,0xcf,
+  0xf1,0x05,0x08,0x1a,0x65,0x68,0x55,0x3c,0x14,0xcd,0x5e,0x43,0x7e,0xd9,0x1e,0xf7,
+  0x41,0x1c,0x30,0x15,0x9b,0x68,0x9d,0xf1,0x7a,0xf7,0x9a,0xf7,0x65,0xb1,0xdc,0x50,
+  0x63,0x12,0x94,0x58,0x1d,0x40,0x69,0xf1,0x2b,0x47,0x0b,0x98,0xfe,0x81,0xd3,0x65,
+  0xa4,0x97,0x79,0xa8,0x2f,0x31,0x6d,0x46,0x53,0x9f,0x37,0xae,0x22,0xcd,0x3d,0xd3,
+  0x0e,0x58,0x1f,0x3f,0x1f,0x24,0xb6,0x14,0xdd,0xbd,0x79,0x1f,0x57,0x1c,0x48,0x7f,
+  0x36,0xb4,0x82,0x6d,0xb7,0xd7,0x2e,0xdf,0xb9,0x7d,0x77,0x9d,0x36,0x40,0x98,0xd0,
+  0x32,0x30,0xb7,0x61,0x63,0x54,0x87,0x3f,0xf0,0x51,0x2a,0x0b,0xb3,0x9e,0x4a,0xd1,
+  0x34,0xc3,0x1f,0x0d,0x77,0xa7,0xca,0x82,0x6d,0xe0,0x0a,0xbe,0x85,0x89,0xa6,0x45,
+  0xa5,0xbc,0x69,0xf6,0xb0,0xdd,0x08,0xa0,0x51,0x68,0x59,0x5f,0x41,0xd4,0x4e,0xf0,
+  0x14,0x02,0xba,0x77,0x5f,0x05,0xdd,0x00,0x07,0x1d,0x89,0x5f,0x65,0x9b,0xa0,0xd1,
+  0x77,0xc0,0xe5,0x26,0x34,0x10,0xfa,0x1d,0x60,0x32,0xdb,0x17,0x74,0x57,0xec,0x15,
+  0xaf,0x06,0xfe,0x61,0xb3,0xca,0xcd,0x11,0x1e,0xca,0xac,0x80,0x91,0xc3,0xe3,0xba,
+  0xe0,0x5e,0x0b,0xd5,0x04,0x96,0x2b,0x68,0x61,0xfc,0x8a,0x02,0xdd,0x4f,0x13,0xde,
+  0x24,0x21,0xb4,0x11,0x5e,0xff,0xc3,0x13,0x93,0x28,0xc1,0x04,0x4d,0x67,0x4c,0x6a,
+  0x4f,0xb9,0x71,0xa4,0x51,0x0e,0x2d,0x79,0x45,0x4c,0x80,0xb4,0xba,0x4a,0xe1,0x88,
+  0xbb,0x03,0x37,0x50,0x36,0xfb,0x71,0x37,0x9e,0x33,0x4d,0x1f,0xd8,0x2a,0xce,0x34,
+  0x7c,0x83,0xf9,0x9c,0x17,0xba,0x64,0x28,0xb7,0xe4,0x44,0xe0,0xb1,0x00,0x68,0x1e,
+  0xfa,0x7d,0xdc,0xc1,0xeb,0x44,0x86,0x37,0x56,0x40,0x7f,0x6f,0xd8,0xe6,0x56,0x27,
+  0x3e,0xd7,0x5b,0xf7,0xaf,0xc8,0xe5,0x79,0x25,0x5a,0x97,0x35,0xbc,0x8c,0x19,0x79,
+  0xbc,0x2d,0xc5,0x7d,0x54,0x3b,0x0c,0x91,0x97,0x4a,0x7c,0xf7,0x31,0x54,0xf2,0xee,
+  0xde,0xcb,0x72,0x58,0x80,0x88,0x36,0xc4,0x4e,0xc8,0xc5,0xe6,0x2e,0xf9,0x77,0xe2,
+  0xe7,0x4c,0x6c,0x1c,0xea,0x9f,0x38,0xf4,0x90,0xdd,0xb0,0x0c,0xb9,0xcd,0xc7,0x5d,
+  0x49,0x28,0x50,0x67,0xf5,0x3d,0x98,0x51,0xca,0x26,0x13,0x79,0x51,0x30,0xaf,0x4f,
+  0xd0,0x7f,0x05,0x07,0x07,0x6f,0x15,0xc3,0xaf,0x45,0x82,0x11,0xf6,0x84,0x3c,0x58,
+  0xb4,0xcd,0x1e,0x1d,0xff,0x84,0x8c,0xaf,0x28,0xf0,0x1d,0xf6,0xd1,0x10,0xd4,0xc9,
+  0x03,0xcf,0x3f,0x67,0x48,0x3c,0xf0,0x88,0xe1,0x7f,0xf8,0x81,0x4e,0xba,0xec,0x08,
+  0x1e,0xe8,0xfc,0xc3,0xe3,0xa8,0xa3,0xac,0x7e,0x60,0x42,0xd4,0x3e,0x7e,0x43,0x0e,
+  0xda,0xe3,0xe3,0xf7,0xd9,0x6b,0xb7,0x6f,0x0a,0xa0,0x34,0x86,0xe3,0x0f,0x80,0x23,
+  0x29,0xf9,0x86,0xb2,0x19,0xdf,0xe6,0x9d,0x3c,0xe5,0xf7,0x94,0x40,0xa5,0xa7,0x02,
+  0xa9,0x52,0xf2,0x5a,0x94,0x52,0xac,0xef,0xa9,0x12,0x01,0xe5,0x5d,0x52,0x22,0xd4,
+  0x18,0x5e,0x1a,0x6a,0x79,0x98,0xd8,0x52,0x16,0xc2,0xb3,0xbe,0x7e,0x30,0xb2,0xc0,
+  0x75,0x30,0x47,0x23,0x98,0x53,0xda,0x99,0x99,0x47,0xe9,0x50,0x06,0x73,0x12,0x5d,
+  0xac,0x36,0xdf,0xee,0xf7,0x03,0x0f,0x96,0xb0,0xdd,0x3f,0xa8,0x1c,0x22,0xdb,0x11,
+  0xcb,0x49,0x0a,0x0b,0x7e,0x15,0xb4,0x00,0xb1,0xa3,0x44,0xb5,0xb3,0x24,0x0f,0x8b,
+  0xc4,0x43,0x9a,0xc0,0xa1,0x02,0x58,0xf1,0xb4,0xcb,0x83,0x83,0x01,0xbf,0xd8,0x1e,
+  0x58,0xbd,0x30,0x5c,0x59,0x79,0xa0,0xe4,0x1d,0xf2,0x1b,0xbf,0x9f,0xb5,0xd9,0x0b,
+  0x87,0xd4,0x10,0xf0,0x3a,0x62,0x2b,0x75,0xf9,0x08,0x48,0x81,0x11,0xd3,0xd1,0x64,
+  0xb4,0x34,0x65,0x1a,0xc4,0xc9,0xb4,0xff,0x21,0xe5,0x4c,0xb6,0x94,0x01,0x76,0xd1,
+  0xbb,0xc4,0x44,0xe8,0x8a,0x70,0xc6,0x55,0x29,0x23,0xa7,0x7c,0x5e,0x65,0xb0,0x79,
+  0xe0,0x87,0xaa,0x26,0x69,0xb4,0x6c,0xa5,0x06,0xd0,0x65,0x57,0x71,0x99,0x77,0x71,
+  0x18,0x7e,0xe4,0x01,0x67,0x1b,0x27,0x42,0xb6,0x38,0x5c,0xdd,0x65,0x28,0x49,0x4e,
+  0x71,0xaa,0x83,0x5a,0x0d,0xff,0xb6,0x1d,0x26,0x3b,0x99,0xa2,0xe1,0x79,0x35,0xfa,
+  0xe8,0xde,0xfd,0x10,0x7f,0xbe,0xf6,0xa3,0x84,0x20,0x77,0x30,0xb8,0x4b,0xb7,0x7d,
+  0xca,0x54,0x19,0x7d,0x78,0x32,0xdb,0x46,0x8e,0x07,0xc4,0x45,0x11,0xd5,0x46,0x10,
+  0xcb,0x53,0x35,0x19,0xcb,0xd0,0x64,0x7a,0xfc,0x40,0xea,0xa8,0x55,0x96,0x54,0x59,
+  0x05,0x28,0xac,0x98,0x4e,0x5c,0xf4,0xfb,0xa4,0xb7,0xb8,0xc9,0xb4,0xba,0xca,0x52,
+  0x4c,0x29,0xc2,0xac,0xe2,0xd3,0x36,0x6a,0x01,0x2b,0x8a,0xb6,0x1a,0x8f,0x24,0x23,
+  0xc6,0x72,0xa0,0x4a,0xb7,0xdf,0x24,0x2a,0x8b,0xb5,0x50,0x12,0x29,0x50,0xc0,0x48,
+  0xb8,0x19,0x2b,0xee,0x4f,0xaf,0x44,0xf3,0x00,0x3e,0x7d,0x93,0xfb,0xf4,0x59,0xee,
+  0x18,0x38,0x03,0x14,0xae,0x5d,0x6f,0xb5,0xcb,0xe2,0xeb,0xd2,0x20,0x24,0xd6,0x0d,
+  0x78,0x32,0xc2,0x27,0x07,0x9e,0xe4,0xa7,0xb0,0x31,0x48,0xa8,0xb0,0x1b,0x12,0x44,
+  0xcb,0x8e,0x31,0x47,0xd5,0xc6,0x0f,0xc0,0xd5,0xae,0x94,0x6b,0x71,0xab,0x1e,0x2d,
+  0x7a,0xbe,0xb1,0x11,0x5a,0xf3,0xa1,0x8a,0x7c,0xa0,0x1d,0x96,0x40,0x42,0xd5,0x69,
+  0x2f,0xa4,0x74,0xf9,0xea,0xab,0x22,0x91,0xff,0x41,0x47,0xb1,0x80,0x69,0x73,0xc4,
+  0xed,0x33,0x0e,0xaa,0xcc,0x85,0x53,0x19,0x1d,0x02,0x4a,0x4b,0x7a,0x69,0xe0,0x9a,
+  0xd0,0x5f,0xc3,0xb3,0x28,0x85,0x15,0x91,0xa9,0x31,0x4c,0xa7,0xab,0xaa,0x6e,0x42,
+  0xa8,0x75,0xf9,0x9b,0x86,0xed,0xbf,0x64,0x3b,0x76,0x60,0x55,0x1c,0x04,0xe4,0xe8,
+  0x5e,0x44,0x19,0x6d,0xf9,0x32,0x34,0x2f,0x0b,0xbb,0xbe,0xac,0x99,0x0a,0x30,0xa3,
+  0x1e,0x30,0xf8,0x1b,0xa6,0xb0,0x86,0x42,0x96,0x71,0xc7,0x22,0x31,0x90,0x18,0x94,
+  0xf8,0x13,0x96,0x9f,0x1e,0x03,0x93,0x32,0x8b,0x92,0x01,0x59,0xf8,0x14,0xc6,0x55,
+  0xf1,0x8c,0x63,0xb4,0xfb,0x80,0x4f,0x57,0x1a,0x0e,0x69,0x36,0x80,0x7e,0x0f,0x9f,
+  0xe9,0x11,0x53,0xf6,0x78,0x61,0x40,0xfb,0x0e,0xc0,0x4b,0x62,0x80,0x50,0x2d,0xc5,
+  0xff,0xa9,0x50,0x97,0x87,0xf1,0xe4,0x44,0x9a,0x43,0xd9,0x75,0x85,0xd6,0x3c,0x30,
+  0xda,0x60,0xad,0x77,0x9f,0x82,0x48,0x22,0xc5,0x2d,0x6f,0x93,0x12,0x2b,0x8b,0x15,
+  0x09,0xf5,0x60,0xb8,0xa2,0x87,0x91,0xe7,0x06,0x2e,0xce,0x1c,0x6e,0xfd,0xdf,0xde,
+  0x73,0xc0,0xfa,0x1b,0x81,0x98,0x3d,0x68,0x74,0xcd,0xc1,0x80,0xb0,0xa9,0x11,0x57,
+  0x11,0x19,0x40,0x99,0xa8,0xdb,0x70,0xc8,0x40,0xba,0x0c,0xe2,0x43,0x8c,0x4b,0x21,
+  0xcf,0xea,0x83,0x54,0xd8,0x3e,0x33,0x11,0x84,0x7d,0x0a,0x21,0x74,0x85,0x38,0x7e,
+  0x15,0x43,0x6f,0x96,0xd3,0x75,0x7b,0xd6,0xeb,0xaf,0xad,0x5d,0x73,0x87,0x60,0x13,
+  0xc3,0xc0,0x49,0xb2,0xfa,0xd5,0xd0,0xfa,0xc3,0xe4,0xb0,0x34,0x43,0xfa,0xef,0xd7,
+  0xd7,0xef,0xb0,0xf2,0x8b,0x58,0xce,0xa1,0x4e,0xd7,0x94,0x62,0xb6,0x12,0x2c,0x86,
+  0x0b,0x3b,0x43,0x52,0x94,0x15,0xb4,0x19,0x45,0x07,0xcb,0x91,0xb0,0xc8,0xd0,0x3a,
+  0x84,0x78,0xa4,0x74,0x38,0x87,0xf0,0x47,0xbe,0x8d,0x15,0x92,0x96,0x72,0x5a,0x42,
+  0x79,0x23,0x5e,0x17,0x12,0x36,0xd7,0x5a,0x22,0x33,0xf2,0xa6,0x39,0xaa,0xdc,0x63,
+  0xf7,0xca,0xe1,0x17,0x07,0x71,0x81,0x5e,0xbb,0xbd,0xd1,0x2a,0xdf,0xaf,0x45,0xaf,
+  0xb7,0x76,0x47,0xf8,0xfe,0xe5,0x37,0xee,0xc4,0x0a,0x16,0x44,0x75,0x43,0x7b,0xbb,
+  0x28,0x2b,0xeb,0xaf,0x97,0xa8,0xf2,0xeb,0x77,0xd7,0x6f,0xdf,0x84,0xdf,0x6a,0xc9,
+  0xb2,0x52,0xb2,0x8c,0x25,0xf7,0xc3,0xd9,0x40,0x64,0x8d,0x38,0xb2,0x46,0x3a,0xb2,
+  0x46,0x16,0xb2,0x46,0x2a,0xb2,0x46,0x3a,0xb2,0x46,0x26,0xb2,0x46,0x36,0xb2,0x51,
+  0xba,0xcc,0xc0,0x32,0xbd,0xbf,0xb7,0xb7,0xb6,0x07,0xf8,0x55,0x55,0x4c,0xa1,0x0c,
+  0x42,0x19,0x64,0x53,0x8e,0x28,0xbe,0x22,0x71,0xd9,0x02,0xe9,0x46,0x73,0xc1,0x65,
+  0x36,0xca,0x44,0x1a,0xad,0x78,0xc4,0xb4,0xee,0x30,0x85,0xd9,0xee,0x61,0xfa,0x32,
+  0x00,0x90,0x09,0xb9,0x53,0x96,0xbe,0x1d,0x2d,0xfc,0x58,0x8c,0x58,0x6e,0xb2,0x05,
+  0xa0,0xba,0xc4,0xd1,0x28,0x8b,0x07,0x8b,0xb5,0xcc,0x23,0xb0,0x42,0x0f,0xf4,0x61,
+  0xd4,0x18,0x36,0x59,0xa3,0x0c,0xe3,0x94,0x41,0x76,0x34,0x55,0x46,0xef,0x60,0x90,
+  0xad,0xaa,0x1c,0xa4,0x1c,0x9d,0x9e,0x99,0x0d,0x04,0x5d,0xeb,0xd5,0x60,0x60,0x94,
+  0x9e,0x8d,0x22,0x4f,0x08,0xd7,0x1e,0x91,0x48,0xf6,0x58,0x64,0xc8,0x04,0x2a,0x6b,
+  0xd4,0x14,0x19,0x4f,0x0c,0x99,0xfb,0xc1,0x5c,0xd7,0x67,0x08,0x30,0x90,0x8d,0x7d,
+  0x68,0x26,0x27,0x12,0x25,0x15,0xcb,0x97,0x54,0x58,0xd3,0x1d,0x7b,0xf3,0x23,0xde,
+  0xf2,0x0a,0x51,0x02,0x85,0x15,0x27,0x53,0x11,0xfb,0x49,0xaa,0xa7,0xd0,0x7a,0x3a,
+  0x4c,0x9f,0x10,0x2a,0x07,0x52,0xa1,0x71,0x1e,0x72,0x24,0x9f,0xca,0x48,0x20,0xcd,
+  0x7f,0x97,0xd9,0x5b,0x8e,0xeb,0x59,0xec,0xbb,0xf3,0xfa,0x24,0x53,0x86,0xe6,0x60,
+  0xf0,0xaa,0xeb,0x6c,0xdd,0x01,0x14,0x7c,0x01,0x95,0x66,0x41,0x6e,0x25,0xdf,0xbe,
+  0xf5,0xf2,0xc6,0x4d,0xdc,0x4b,0xbe,0xd0,0x6c,0xa6,0x4e,0x1d,0x9f,0xa2,0x68,0xfa,
+  0xe6,0x66,0x9c,0xaa,0x73,0x38,0x57,0xd8,0xb1,0xed,0x60,0x52,0x34,0x9a,0x7d,0x78,
+  0x78,0x06,0x9d,0x7b,0x72,0xd8,0xa5,0xc5,0x88,0x1f,0x97,0x51,0xf2,0x7b,0x65,0x9d,
+  0xc4,0xe6,0x8a,0xe0,0x42,0xda,0xb6,0x43,0xdf,0xe4,0x31,0xdf,0x91,0xc3,0x23,0x92,
+  0xea,0xe5,0x96,0x8f,0xc1,0x83,0xc0,0xa3,0x4b,0x4f,0x59,0xe9,0x85,0x43,0x3e,0x86,
+  0xa3,0x52,0x78,0x41,0xf1,0xaf,0xb4,0x0f,0x77,0xbe,0x70,0x88,0xf8,0x1d,0x5d,0x79,
+  0xc0,0x31,0xa6,0x8f,0x76,0x7a,0xc3,0x0a,0xf4,0x51,0x05,0xfa,0xd2,0xf1,0xac,0x6d,
+  0xd7,0xee,0x5a,0xda,0x32,0x41,0x5d,0xcd,0xa7,0xa2,0x26,0xa9,0xc8,0x13,0xda,0x39,
+  0x82,0xe0,0xf2,0x74,0x89,0x46,0x15,0x25,0xa1,0x81,0x06,0x55,0xe5,0x32,0x44,0x8e,
+  0x8a,0xbf,0xa3,0x96,0x56,0x5a,0x6a,0x04,0x6d,0xa8,0x58,0x9e,0x48,0xd6,0x22,0x32,
+  0x41,0xed,0xbc,0xaa,0x63,0x94,0x8f,0xbc,0xff,0x29,0x35,0x01,0x8f,0x5d,0x4b,0xa9,
+  0x3c,0x97,0xb2,0x4e,0x72,0x86,0xff,0xbd,0x00,0x63,0x70,0xa4,0xdc,0xe9,0xe1,0x0a,
+  0xee,0x7a,0x5c,0x0d,0xc0,0xbc,0xd9,0x1c,0x83,0x79,0x57,0xee,0xd9,0x3e,0x7d,0x24,
+  0x0b,0x05,0x6a,0xf8,0x3b,0x0a,0xc8,0x17,0x5b,0x5f,0xcf,0xcd,0xbb,0xe6,0xa3,0xb1,
+  0x7b,0x6d,0x31,0xa2,0x59,0xfd,0xe9,0xfc,0x48,0x1e,0x16,0x5c,0x09,0x3d,0x6b,0x24,
+  0xa2,0xea,0x59,0xe7,0x48,0xdf,0x0e,0xcb,0xf1,0xbb,0xb5,0x13,0xd4,0x82,0x6d,0xb9,
+  0x03,0x2e,0x58,0x5c,0xba,0xdf,0xa1,0xed,0x21,0xc4,0xdc,0x35,0x4e,0xd4,0x2a,0xcb,
+  0x28,0x90,0x32,0x5e,0x91,0x2b,0x33,0xb8,0xe6,0xea,0x7a,0x3b,0x7e,0xd4,0xe6,0xbb,
+  0xa6,0xd6,0x95,0x86,0xc8,0xe9,0x12,0x29,0xa4,0xc8,0xe4,0xe0,0xcd,0x81,0x44,0x3a,
+  0x38,0x64,0x82,0x61,0xb8,0xb6,0x4a,0xe3,0x19,0x61,0x44,0x25,0x64,0x58,0xab,0xc6,
+  0xf5,0x0d,0x4e,0x45,0xbc,0xcc,0xe0,0x65,0x86,0xba,0x45,0x29,0x8d,0x2f,0xf5,0x04,
+  0x8c,0xc8,0x6b,0x01,0x50,0x46,0x94,0xae,0xc2,0xf5,0xf6,0xe5,0x50,0xff,0x52,0x26,
+  0x23,0x7b,0xd0,0x15,0x64,0x6e,0x08,0x7e,0x14,0x42,0x62,0xf7,0x5e,0x58,0xf2,0xe0,
+  0xfe,0x15,0x59,0x88,0x42,0xbd,0x72,0x4e,0x74,0x83,0xc3,0x16,0x3f,0xc1,0xc4,0xee,
+  0x0e,0xc6,0x3d,0xb0,0xfa,0x01,0x6a,0x15,0xec,0xee,0x54,0x0e,0xd0,0x60,0x4a,0x90,
+  0x61,0x6e,0x93,0x62,0x84,0xb8,0x0e,0xe6,0xbb,0xdf,0xdd,0x06,0x99,0x50,0x11,0x0a,
+  0x35,0x96,0xed,0xbb,0xaa,0xe6,0xfb,0x52,0x54,0x5d,0x57,0x77,0x2d,0xb2,0x77,0xb5,
+  0x57,0x86,0xb0,0x11,0x8a,0x25,0xf2,0x2b,0x28,0x40,0x3b,0x0d,0xa1,0x1c,0xd3,0x14,
+  0x2d,0x65,0x9e,0x72,0xd4,0x6a,0xa3,0x4c,0x84,0xc5,0x57,0x92,0x8a,0x0d,0xdc,0xec,
+  0xf5,0xff,0x75,0xf5,0x7a,0x9b,0x22,0xae,0xeb,0x77,0x6e,0xcb,0x5f,0x6b,0xb7,0xde,
+  0x68,0x53,0x78,0xb5,0x36,0x67,0xcc,0xde,0x48,0xdb,0x65,0x47,0x65,0x02,0xe6,0x3d,
+  0x58,0x1f,0x35,0xda,0xf8,0xaf,0x9e,0xc8,0xd6,0x4a,0x4b,0x20,0x38,0xd2,0x3a,0x79,
+  0x03,0xa3,0xc2,0xd4,0x0b,0x18,0xee,0x27,0xeb,0x44,0xe6,0x3a,0xc0,0xdf,0x29,0xde,
+  0x17,0xf8,0xdd,0x3d,0x6d,0xe5,0x1e,0x16,0xf1,0xb1,0xce,0xc0,0x72,0xc9,0x89,0xfc,
+  0xd0,0xdc,0xde,0x43,0x50,0xf7,0x1b,0x38,0x13,0x32,0xf8,0x43,0xbf,0xc5,0x06,0x97,
+  0x56,0x07,0xe6,0x28,0xac,0x83,0xbf,0x53,0xea,0xa0,0x99,0xa8,0x5a,0x41,0xd1,0xbc,
+  0xc7,0x60,0x01,0x0f,0x84,0xb0,0xf0,0xb7,0x80,0x25,0x46,0xc4,0x93,0xcf,0xc5,0x36,
+  0x55,0x45,0xc2,0xa3,0x45,0x12,0x99,0x55,0x60,0xc8,0x62,0xcc,0x01,0x63,0x0f,0xbc,
+  0x8a,0xcc,0x59,0x47,0xe9,0x85,0x05,0x55,0x9e,0xea,0x81,0x0c,0xa4,0xd9,0xf8,0x64,
+  0x77,0x6e,0xa0,0x5f,0x0a,0x0e,0x09,0x46,0x2e,0xa2,0x67,0x03,0x56,0x8a,0xd2,0x7b,
+  0x26,0x04,0xf9,0x79,0x7a,0x15,0x8a,0xfe,0x2e,0x09,0x49,0x9c,0xb2,0x34,0x37,0xd7,
+  0x7a,0xc2,0xeb,0x40,0x7b,0x9c,0xa0,0xd9,0x1b,0x23,0xd3,0x33,0x87,0x1b,0x74,0xf4,
+  0x95,0x03,0xb3,0xf5,0x77,0xb2,0x39,0xb0,0x57,0x76,0x73,0xe2,0xc1,0x58,0x73,0xfe,
+  0x2e,0x1a,0x07,0xf5,0x5f,0x93,0x61,0x3e,0x8e,0xf1,0xab,0x74,0x46,0x9f,0x0b,0xfd,
+  0x30,0xc3,0x6f,0x57,0x09,0x27,0xf1,0xdd,0x2a,0x84,0xf7,0x06,0x67,0x73,0x9c,0x09,
+  0x7e,0x4f,0x04,0xcd,0x43,0xbc,0xbc,0xcd,0xdf,0x88,0x5c,0x8a,0x37,0xe4,0x9e,0x4b,
+  0x33,0x9c,0x60,0x7e,0xbd,0xbc,0xaf,0xce,0xae,0x38,0xb6,0x10,0x0a,0x5e,0xf4,0x0c,
+  0x09,0xb8,0x01,0xe0,0x9a,0x34,0x00,0xbe,0x4c,0x89,0x04,0x35,0x19,0xae,0x1a,0xed,
+  0x46,0xdb,0xda,0x12,0xac,0xcc,0x07,0xcc,0x62,0x1c,0x1e,0x02,0x89,0x3c,0xa2,0xc3,
+  0xec,0x8d,0xf8,0xf5,0x91,0xdb,0xdb,0x58,0x23,0xbc,0xc2,0x98,0x4b,0x14,0xe9,0xca,
+  0x69,0x67,0x3b,0xbb,0xf1,0x76,0x4a,0x88,0x0c,0x24,0x84,0x38,0x77,0x31,0xa5,0xe7,
+  0x1c,0x10,0x53,0xfa,0xce,0xed,0x3c,0x3b,0x96,0x5a,0x56,0x44,0x95,0xb4,0x80,0xa2,
+  0x10,0x49,0x2c,0x52,0x86,0xf1,0x59,0xbf,0x12,0xa8,0x7e,0x46,0x7f,0x48,0x42,0x16,
+  0x15,0xb3,0x16,0xd0,0xbc,0x52,0x28,0x96,0x89,0x6b,0x39,0x37,0x5d,0x41,0xee,0xa7,
+  0x93,0x2c,0x69,0x71,0xc1,0x55,0x9d,0x6d,0xfa,0x78,0xcc,0x15,0x70,0xbe,0xa7,0x41,
+  0xb9,0x2f,0x24,0x66,0xf4,0x12,0x64,0x5c,0x75,0xc6,0x19,0x4e,0x01,0x0d,0x50,0xee,
+  0x6b,0x58,0x1b,0x05,0xb1,0x9e,0x02,0xdb,0x48,0x43,0xdb,0x28,0x88,0x76,0x01,0xd8,
+  0x02,0xef,0xa3,0xb4,0xed,0x0c,0x3e,0xef,0x85,0x42,0x89,0x7a,0x4c,0x5c,0x27,0x79,
+  0x8d,0x69,0x64,0x92,0x8f,0x86,0x5e,0x2a,0x91,0x69,0x80,0x0e,0x04,0x1f,0xa8,0xf2,
+  0x3d,0x17,0x98,0xd5,0x94,0x07,0x96,0xcf,0x11,0xe8,0x30,0x59,0xf4,0xb9,0x45,0x30,
+  0xa3,0xe8,0x7d,0xf5,0x8c,0xf6,0x5c,0x02,0xb1,0xc9,0x70,0xd4,0x61,0x51,0xa4,0x5b,
+  0x64,0x09,0x28,0x21,0x6e,0xe1,0x5e,0xe3,0xe4,0xd8,0x81,0x12,0xcf,0x16,0xc1,0xec,
+  0xb9,0xc4,0x4a,0xd4,0x9c,0x02,0x3d,0xd8,0x90,0x16,0xe4,0x9c,0xc1,0xce,0x26,0xa9,
+  0x29,0x6c,0x65,0x30,0x9c,0x13,0xb6,0x72,0xd2,0xf6,0x06,0xcb,0x39,0x61,0xfa,0x70,
+  0xb4,0x93,0x41,0x55,0x3e,0x04,0x19,0x59,0xd5,0x0d,0x68,0xba,0x1b,0x49,0x40,0xb9,
+  0x26,0x3e,0x99,0xcc,0xa1,0x45,0x07,0x44,0xc1,0x3c,0xb6,0xf7,0x65,0xa8,0x8b,0xab,
+  0xea,0x2a,0x57,0x8f,0x52,0x25,0x96,0x95,0x74,0xad,0x9b,0xb6,0x33,0xf6,0x73,0xec,
+  0xbb,0x07,0x2f,0x1c,0x72,0x88,0x47,0x14,0x64,0x1c,0x62,0x75,0xae,0x52,0x1f,0xa8,
+  0x59,0x5f,0x77,0x06,0xb3,0x40,0x19,0x0d,0x52,0x81,0x4c,0xc9,0x06,0x8b,0x01,0x41,
+  0xdf,0x34,0x6a,0x4e,0xfa,0x7d,0xda,0x19,0x57,0x05,0x82,0x62,0x15,0x44,0x40,0xcc,
+  0x1e,0x7e,0xc0,0x44,0xe8,0x76,0xe0,0x46,0xdb,0xb3,0x88,0xee,0x5a,0x46,0xa6,0x98,
+  0x53,0x32,0x3f,0x74,0x9b,0x4f,0x82,0xb1,0xfd,0x97,0xdf,0xb8,0x83,0xf9,0xbe,0xb2,
+  0xa6,0xa2,0xcd,0x31,0xa2,0x1b,0x59,0x17,0xf8,0xd5,0x19,0xe4,0x62,0x6a,0x70,0x85,
+  0xb5,0x1a,0x4d,0x54,0xf2,0x8d,0x56,0x18,0xb4,0xb4,0x1d,0xa5,0x78,0xa1,0xc9,0x4d,
+  0x00,0x19,0xd0,0xdc,0x57,0xca,0x2e,0x60,0xd9,0x42,0x8a,0x61,0x21,0x2b,0x60,0xb9,
+  0xc1,0xe3,0x58,0xe2,0x3a,0x16,0x39,0x4e,0x65,0x4b,0x2c,0xa2,0x62,0x98,0x79,0x12,
+  0x25,0xcd,0xab,0xcd,0x80,0xa1,0x63,0x50,0x64,0x3f,0x4b,0x4b,0x0c,0x6f,0xfb,0x68,
+  0xf2,0xae,0x1c,0x6b,0x4f,0x56,0xd0,0xea,0xbf,0xa8,0x50,0x97,0x7d,0x97,0xe8,0x10,
+  0xa5,0xc1,0xf3,0x2a,0x2b,0x38,0xfa,0xaa,0x0a,0x01,0x9e,0x63,0x75,0x2e,0x23,0x15,
+  0xf4,0x3a,0xe6,0x7e,0x67,0x2e,0x3e,0x0c,0x1e,0xa7,0xa7,0x2a,0x49,0x23,0x89,0xce,
+  0x2e,0xc9,0x95,0x30,0x35,0x2f,0x57,0x61,0x91,0x4a,0xbd,0x55,0xe5,0x29,0xbd,0xc8,
+  0xfd,0x33,0xb5,0x94,0x0d,0x0b,0x66,0xcf,0xa8,0xec,0x17,0xbc,0x65,0xc6,0x39,0x0f,
+  0x3d,0x07,0x6d,0x1d,0x14,0x9a,0xd4,0x73,0x04,0x29,0xcc,0x97,0xdc,0x15,0xd3,0x1a,
+  0x4f,0x54,0x79,0x36,0xf9,0x13,0x66,0x32,0x63,0x9a,0x8b,0x1a,0x44,0xa1,0xab,0x9c,
+  0xda,0x8c,0xf2,0x7e,0xc5,0xf5,0x3c,0x98,0xf0,0xfb,0x09,0xbf,0x3c,0x2b,0x96,0x8e,
+  0xa2,0x66,0xfe,0x4c,0x75,0xf2,0x70,0x61,0x62,0xf0,0x6c,0x4e,0x04,0xcf,0xd8,0x89,
+  0xa2,0x67,0x73,0x19,0xd1,0x33,0x1c,0x74,0x4d,0x50,0xe9,0xa8,0x3a,0x37,0x3d,0x70,
+  0x16,0x59,0xd0,0x22,0xe0,0x2d,0xa8,0x93,0x88,0x72,0x9d,0x2b,0xab,0xe7,0x88,0xb3,
+  0x12,0x56,0xb8,0x01,0x79,0xb2,0x54,0x12,0x1e,0xa0,0xb2,0x64,0x78,0x4a,0x49,0x14,
+  0x51,0x95,0x4b,0x8b,0xce,0x50,0x47,0xcf,0x06,0xf7,0xde,0x92,0x7a,0xa3,0xc5,0x37,
+  0xea,0x92,0x05,0xa2,0x85,0x96,0x31,0x40,0x5a,0x29,0xdc,0xc3,0xcb,0x88,0xc6,0x01,
+  0xfd,0x94,0x9e,0x3b,0x85,0xef,0x56,0xc0,0xf8,0x78,0x56,0x30,0x28,0xba,0x10,0x02,
+  0x79,0x35,0xa5,0x06,0x85,0x89,0xa6,0x10,0x40,0xde,0x03,0x93,0x72,0x95,0x46,0x3c,
+  0x6c,0x0c,0x3a,0xf8,0xce,0x18,0xe6,0xf0,0x35,0xeb,0x1f,0xc7,0x96,0x1f,0x54,0x3c,
+  0x0b,0x5d,0x57,0xb2,0xc5,0x29,0x65,0xf9,0xc6,0x40,0x3a,0x4e,0xe7,0xc4,0x93,0xe4,
+  0x73,0xb1,0xa1,0xef,0xd9,0x5b,0x18,0x2c,0xfc,0x1e,0x06,0xfa,0xa9,0x86,0x38,0x4a,
+  0xbe,0x69,0x76,0x77,0xf0,0x9a,0x38,0x07,0x10,0x1b,0xb8,0x1e,0xad,0xff,0xac,0x42,
+  0x3a,0xf6,0x6e,0x36,0xf1,0x5f,0xf0,0x53,0x78,0x45,0x19,0x61,0x0c,0xef,0x69,0x89,
+  0xad,0x2a,0xca,0xbd,0x4c,0x5d,0x5a,0x34,0x84,0xf9,0x11,0x8e,0x4a,0x8d,0x4a,0xb3,
+  0x33,0x0d,0x4b,0x53,0x27,0x6d,0xa6,0x90,0x4b,0x06,0xa6,0xf3,0xc7,0x29,0x31,0x87,
+  0xe5,0x85,0x56,0xca,0xf9,0x4b,0x4d,0xcb,0xba,0xd4,0x24,0x53,0xe5,0x7c,0xbf,0x7f,
+  0xb1,0x79,0xb1,0x59,0x0e,0x73,0xaf,0x58,0x85,0xf6,0xaa,0xd5,0xcb,0x7f,0x2c,0xbe,
+  0x6d,0x4e,0x53,0x06,0xb0,0x68,0xce,0xf8,0xe0,0xf9,0xbe,0x76,0x1b,0xbd,0x36,0x6a,
+  0xd4,0x61,0xd3,0x08,0x2e,0xbb,0xc3,0xa8,0x18,0x8f,0xf7,0xd2,0xb5,0x06,0xb1,0xeb,
+  0x19,0x0e,0xa7,0xc1,0x49,0x9b,0x31,0x79,0xd1,0x0b,0xac,0xa0,0x16,0xdd,0x59,0x83,
+  0x36,0x68,0xa6,0x73,0xe2,0xdb,0x68,0x99,0xec,0x5a,0xdc,0xdc,0x02,0x1f,0x25,0xef,
+  0xe4,0x29,0xbf,0x4b,0x24,0xce,0xb6,0x60,0xbb,0x5a,0xe2,0x14,0xaa,0x76,0x3f,0x49,
+  0x66,0x57,0x68,0x93,0x9d,0xa8,0x27,0xa3,0x70,0x4f,0xa7,0x1f,0xd5,0xd2,0xcc,0x7d,
+  0x9d,0x78,0x58,0xcb,0x7a,0x57,0x69,0xa2,0x43,0x88,0x37,0x70,0x10,0xba,0xd6,0x1d,
+  0x90,0x91,0x37,0x41,0x54,0xf1,0xcc,0xaa,0x68,0xff,0xec,0xa8,0x93,0x16,0x03,0xbd,
+  0x2b,0x22,0x4e,0x95,0xf0,0x26,0x87,0x22,0xeb,0x58,0xc6,0xa9,0xe6,0x11,0x44,0x59,
+  0x49,0x25,0x91,0x0b,0x28,0x25,0x9f,0xe4,0x25,0x0a,0x5d,0xb0,0xc0,0xa5,0x7e,0x99,
+  0x04,0x51,0xce,0xd4,0x7b,0x1c,0x56,0x42,0xf9,0xe9,0x19,0x39,0x40,0x3e,0x79,0xf1,
+  0x23,0x26,0x4d,0x65,0x1f,0x03,0x8e,0x6a,0x85,0x96,0x18,0x81,0x0b,0x0b,0x72,0xba,
+  0xe0,0x5f,0xc6,0xce,0x85,0x2f,0xab,0xe8,0xc0,0xf9,0xdb,0x69,0x90,0x47,0xd3,0x21,
+  0x8f,0x52,0x21,0x8f,0xa6,0x40,0x5e,0x9f,0x8e,0xf3,0x7a,0x2a,0xce,0xeb,0xf9,0x38,
+  0x1b,0xd3,0xa9,0x61,0xa4,0x52,0xc3,0x98,0x46,0x0d,0x63,0x3a,0x35,0x8c,0x54,0x6a,
+  0x18,0xd3,0xa8,0x61,0x4c,0xa7,0x86,0x91,0x4a,0x0d,0x23,0x9f,0x1a,0xea,0xd7,0x3d,
+  0x73,0xe1,0xeb,0x15,0xf5,0x5e,0xd4,0xb2,0x9c,0xbe,0xe4,0xd7,0x77,0x73,0xfb,0x89,
+  0x2a,0xe9,0x7d,0xc8,0xf7,0x53,0xe1,0xbf,0xd2,0x2f,0x00,0xff,0x95,0x7e,0x3a,0xfc,
+  0x57,0xa6,0xe3,0x7f,0xd3,0xdc,0x2f,0xd0,0x01,0xd5,0x4a,0xeb,0xe1,0xa6,0x99,0xbb,
+  0x54,0xc7,0xc3,0xd1,0x0d,0x07,0x95,0xdd,0x4d,0xd3,0xdf,0x29,0x2b,0x97,0x16,0x0e,
+  0xe1,0x39,0x9c,0x55,0xad,0x56,0x8e,0xf8,0x8e,0x6e,0x68,0x07,0x64,0xa2,0xd3,0x34,
+  0x15,0x02,0xf6,0x1d,0x8c,0x67,0xe0,0xe9,0xdf,0xe6,0x54,0x08,0x46,0x16,0x04,0xa3,
+  0x18,0x04,0x23,0x1b,0x87,0xc5,0xa2,0x10,0x32,0x71,0xb8,0x18,0x42,0x38,0x8a,0x08,
+  0x4b,0x47,0x2c,0xef,0xf0,0xc3,0xd0,0xdf,0xf9,0x4e,0xec,0xe8,0x65,0xf2,0x8d,0x3c,
+  0xae,0x89,0x16,0x51,0xd6,0x41,0xce,0x18,0xd8,0xf0,0x24,0x3c,0x2f,0x70,0x87,0xa0,
+  0xbe,0x82,0x96,0x0e,0x9a,0xbf,0xac,0x26,0xde,0x34,0x50,0x87,0xa0,0x69,0xa1,0xb5,
+  0x55,0xd5,0x84,0x78,0x67,0xcc,0x02,0xcf,0xd0,0xe1,0x19,0xd5,0xe9,0xf6,0x5e,0x89,
+  0xdf,0x4b,0x86,0xcd,0xf1,0xd4,0x96,0xd4,0x6a,0xed,0x52,0x64,0xec,0x1d,0xa5,0x85,
+  0x6c,0xfd,0x20,0xd4,0xbc,0x23,0xf3,0x00,0x9b,0x63,0x12,0xc9,0x60,0x80,0x56,0xdc,
+  0xc9,0x54,0xb1,0xcf,0x33,0x51,0xf2,0x8c,0x6a,0x16,0xb3,0xaa,0x59,0xd2,0xac,0x66,
+  0x59,0x76,0xb5,0xc0,0x52,0xcd,0xf0,0x00,0xbc,0xc6,0x83,0x20,0x5f,0x65,0xf3,0x3a,
+  0xdc,0x63,0x9d,0xcb,0xf5,0x58,0xa1,0x7a,0x25,0xa2,0x80,0xfc,0xc5,0xcf,0x3b,0x88,
+  0x53,0x75,0xb3,0x3a,0xa8,0xb2,0x77,0x99,0x44,0x32,0x76,0x76,0x1c,0x77,0xcf,0x11,
+  0x79,0xa6,0xda,0xa1,0xad,0x69,0x13,0x0c,0xd4,0xcd,0x9a,0xdf,0x0c,0xac,0xbe,0x90,
+  0x38,0x61,0x34,0x82,0x3e,0x50,0x92,0x86,0xe9,0x07,0xf2,0x98,0x45,0x8e,0x09,0xa9,
+  0xde,0x6e,0x9d,0x6f,0x41,0x0a,0xb7,0x40,0x63,0x2f,0xf0,0x12,0xf0,0xbe,0x30,0xa0,
+  0x08,0x9a,0x3a,0x65,0x11,0x72,0x68,0xcf,0x62,0x2a,0x1d,0x89,0x10,0xf1,0xb4,0xbb,
+  0x5c,0xe8,0x84,0x6c,0x81,0x03,0xe5,0xea,0xed,0xa4,0x42,0x4a,0xc4,0x9d,0xd7,0xfc,
+  0x63,0xf6,0xfc,0x4e,0x02,0x11,0x3d,0x92,0x19,0xcc,0x87,0xd9,0xe7,0xc3,0xb1,0x0a,
+  0x26,0xbc,0x21,0x13,0xa4,0x1d,0xb5,0x8b,0x9d,0x0e,0xd7,0x2e,0x1b,0xa9,0xb1,0xf0,
+  0x50,0xbf,0x8c,0x22,0x65,0x1f,0xef,0x67,0x75,0x46,0x07,0xfc,0x33,0xa7,0x00,0x11,
+  0x2b,0x47,0x97,0x55,0x44,0x90,0xc2,0x1c,0x95,0x5c,0x3e,0xb8,0xab,0x1b,0x11,0x45,
+  0xcf,0xee,0xa7,0xc4,0xe2,0x66,0xb2,0x53,0xb4,0xe8,0x6b,0x32,0x3e,0xf7,0x2f,0xc7,
+  0x8f,0x26,0x9f,0xe0,0x21,0xb5,0x27,0xf4,0xb9,0x0a,0x60,0xff,0x1a,0x5e,0x77,0xaa,
+  0x5e,0x1b,0x8e,0x9f,0xb5,0xe6,0x67,0x8d,0xf0,0x75,0xea,0x79,0x7c,0x85,0xc0,0x19,
+  0xd4,0xe3,0xa8,0xc1,0xec,0x12,0x6e,0x21,0x27,0x87,0x4c,0x3a,0x9d,0x7e,0xfc,0xdb,
+  0xf5,0x33,0x50,0xae,0xf7,0x56,0x41,0xb2,0xc5,0xcd,0xae,0x50,0x4a,0xee,0xf4,0x67,
+  0x82,0xf0,0x4a,0x3f,0x01,0x81,0xc7,0xd7,0x8b,0x83,0x50,0x4c,0x27,0x6d,0xe2,0x7a,
+  0x6f,0x55,0xa3,0x28,0xeb,0x4e,0x5f,0x79,0xc0,0xd8,0xf5,0x29,0x26,0x34,0xe5,0x82,
+  0x85,0x30,0x51,0xf4,0x63,0xba,0xf1,0xf6,0xc7,0x8c,0xae,0x62,0xa0,0xe3,0x90,0xc5,
+  0xe6,0x1a,0x86,0xb2,0x31,0xb2,0x71,0xab,0xbb,0xf7,0x16,0x08,0xab,0xb7,0x6a,0x40,
+  0xc8,0x36,0xfc,0xc1,0x04,0xb5,0xfd,0x36,0xd1,0xa4,0xd0,0x8c,0xdf,0x59,0x6b,0x9d,
+  0x46,0x66,0x82,0x37,0x04,0x95,0x76,0xec,0x76,0x21,0xfa,0xeb,0x5e,0x20,0x11,0xb8,
+  0x09,0xad,0x47,0x33,0xb4,0x1e,0xc5,0x5b,0x07,0x33,0xf4,0xbd,0x1e,0xeb,0x7b,0xba,
+  0xe4,0xe6,0x24,0x32,0x4e,0x47,0x22,0x63,0x26,0x12,0x19,0xa7,0x22,0x91,0x71,0x2a,
+  0x12,0x19,0x27,0x25,0x11,0x7e,0xcf,0xa6,0x90,0xd8,0xc0,0xbd,0x26,0xe1,0x6a,0x34,
+  0x85,0x39,0x3a,0x8b,0x73,0x51,0xe5,0x8d,0xff,0x69,0x95,0xb5,0x0a,0xb5,0x36,0x32,
+  0x5a,0x1b,0x05,0x5a,0x1b,0x99,0x7d,0x2f,0x16,0x6a,0x9d,0xd5,0xf7,0xc5,0x4e,0xd6,
+  0xa2,0x1e,0x11,0x19,0x6b,0x54,0xb3,0xcd,0xeb,0x1f,0xa9,0x66,0x41,0x25,0x3b,0x90,
+  0x15,0xda,0xec,0x29,0x65,0xea,0xa5,0xa0,0xb9,0xd3,0x88,0xf1,0xd3,0xdc,0x59,0x4c,
+  0xdb,0xe7,0xda,0xce,0xbb,0x17,0x44,0x7c,0x11,0x48,0xf2,0x54,0x47,0xb9,0x7c,0x3c,
+  0xbf,0xcd,0x70,0x18,0x6f,0x03,0x83,0x9b,0xda,0x0a,0xea,0x44,0xcd,0x70,0x8a,0xe4,
+  0xd6,0x03,0xf2,0xf2,0x50,0xd9,0x86,0x88,0xce,0x91,0xab,0x42,0x9b,0xbe,0x47,0xf2,
+  0x09,0xd8,0xa8,0x4f,0x31,0xc7,0xff,0x6d,0xbc,0x8e,0xe0,0xc7,0x74,0x09,0xf9,0x13,
+  0xfe,0xee,0x04,0xbb,0x65,0x88,0x16,0x3a,0x21,0xcf,0x6f,0xa3,0x6c,0x5b,0x2c,0xee,
+  0x35,0x27,0xa8,0x6c,0x57,0x81,0x79,0x94,0xe7,0x21,0x3c,0x03,0x4d,0x94,0x37,0xf0,
+  0x54,0x3d,0xdd,0x7e,0xda,0x7f,0xa0,0xce,0xe3,0x8a,0x2b,0xfa,0xb8,0xcf,0x13,0xee,
+  0xa8,0x34,0xce,0x76,0x6b,0x2d,0xad,0x0f,0xf5,0x93,0x55,0x59,0xfb,0x6c,0xf9,0xbe,
+  0x82,0xf0,0x86,0x0b,0xc9,0x74,0x2d,0x5f,0x28,0xdb,0x3d,0x46,0xb8,0xb4,0x9d,0x55,
+  0xb4,0x77,0xe3,0xcc,0x7b,0x37,0x44,0xef,0xb3,0x5c,0x93,0x5e,0x2c,0xb3,0x5b,0x8f,
+  0x83,0xcb,0x2d,0xba,0x13,0xb5,0x14,0xd1,0x79,0x81,0xe3,0xdd,0xef,0xdf,0x5d,0xbf,
+  0x71,0x73,0xe3,0xee,0xfa,0xd5,0xf5,0xd7,0xe9,0xb6,0xc9,0x39,0x91,0x80,0x0a,0xf3,
+  0xfa,0xfa,0xad,0x57,0x6e,0xdd,0x7e,0xf3,0x56,0xb9,0x36,0x27,0xf6,0xab,0x94,0x37,
+  0x74,0x11,0xa4,0x5e,0x27,0xe8,0x2a,0xcf,0x98,0x27,0xa0,0xe5,0x86,0x2b,0xb7,0xa0,
+  0x8d,0x50,0x55,0x09,0xb1,0x38,0x0a,0x7f,0xa2,0xf7,0xcd,0xbf,0x0a,0x17,0x7b,0xd9,
+  0x35,0x81,0x93,0xcb,0x77,0x37,0xde,0xbc,0xfd,0xda,0x2b,0x6b,0xb7,0x5e,0x2e,0xb7,
+  0xa3,0xeb,0x19,0x31,0x2f,0x1b,0x3a,0x9d,0xfc,0xdb,0xe4,0xb7,0x93,0x7f,0x81,0x3f,
+  0xbf,0x9f,0xbc,0x8b,0x27,0x5d,0x7c,0xff,0x1a,0x26,0x0c,0x42,0xc9,0x9e,0xeb,0xed,
+  0xe0,0x69,0x66,0x3a,0xb3,0x23,0xe0,0x5c,0x7d,0xf5,0xea,0x6b,0x37,0x01,0x0a,0x4b,
+  0xc2,0x79,0x17,0x84,0xd1,0xbb,0x00,0xed,0x9d,0xc9,0x7f,0xea,0x70,0xf8,0x65,0xb2,
+  0x2a,0x94,0xd7,0x6e,0xdc,0xb9,0xba,0xf6,0x1a,0x82,0x49,0xc1,0xe6,0xff,0x4e,0x7e,
+  0x0d,0xd8,0xfc,0x66,0xf2,0x7b,0x1d,0x8a,0x67,0x8d,0x4c,0xdb,0xd3,0xc0,0xdc,0x7e,
+  0xa5,0xdc,0x9e,0x13,0x39,0xaf,0x29,0x03,0xfb,0x1d,0x0c,0xe9,0xb7,0x93,0x8f,0x74,
+  0x30,0xee,0x4e,0x99,0xdf,0x43,0x12,0x3f,0xeb,0xa7,0xd0,0xd5,0x1a,0xf0,0x54,0xb8,
+  0xb1,0x7f,0x1d,0x8f,0xb7,0x32,0x3c,0xbd,0x13,0xbf,0x3c,0x28,0x2c,0xa6,0x02,0x3a,
+  0x9a,0xa4,0xdd,0x67,0xc7,0x2b,0xd4,0x37,0xcd,0xde,0x96,0x45,0xab,0x5c,0x69,0x21,
+  0xd1,0xd1,0x0e,0x6e,0x8f,0x47,0x78,0x99,0xa5,0xd8,0x4a,0x7e,0x7d,0xad,0xc2,0xf3,
+  0x87,0x78,0xc4,0x4a,0x89,0x72,0xb6,0x6e,0xe4,0x25,0xc9,0x3f,0xb8,0xd9,0xda,0x08,
+  0x53,0x8f,0xa2,0x74,0xa3,0xa1,0x31,0xa5,0x95,0x91,0xda,0xca,0xed,0x59,0xf9,0xed,
+  0xb0,0x46,0x5a,0xcb,0x9e,0x77,0x90,0xdf,0xf0,0xba,0x77,0x90,0xd6,0x8e,0x76,0xd2,
+  0xf2,0x5b,0xbe,0x41,0x9b,0x6d,0x29,0x6d,0x83,0xb7,0xcc,0xdd,0x5e,0x7e,0xdb,0x75,
+  0xac,0xa2,0xb7,0x55,0x24,0x94,0xb6,0x9a,0x1b,0xb4,0x6a,0xb9,0x48,0xb8,0xfd,0xd2,
+  0x4b,0xaf,0xae,0xdd,0xba,0x41,0x79,0xcc,0x9c,0x26,0x31,0x66,0x28,0x5f,0x7d,0x95,
+  0xad,0x19,0x78,0x10,0x9f,0x06,0x9e,0x59,0x2a,0x86,0x97,0x59,0x1e,0xe7,0x43,0x9c,
+  0xec,0x5a,0xc4,0xd0,0xa2,0x5e,0xea,0xda,0xaa,0xa6,0xb4,0x36,0x66,0x69,0x2d,0xc8,
+  0x97,0x89,0x9b,0x4c,0xa5,0x3c,0xca,0x26,0x19,0xff,0xb8,0xd7,0xd9,0x92,0x2c,0x9f,
+  0x24,0xa4,0x90,0x79,0x02,0xec,0x06,0xca,0x3d,0xea,0xbc,0x89,0xbb,0xfb,0xaa,0x54,
+  0x63,0x95,0x2b,0x55,0xda,0xe6,0x97,0x12,0x81,0x5e,0x68,0x84,0x10,0x91,0xc3,0x22,
+  0x84,0x4c,0xed,0xb3,0x75,0xda,0x3e,0xc3,0x18,0x68,0x2a,0xb5,0xa8,0x4f,0x2c,0x51,
+  0x3a,0x7b,0x17,0xac,0x8b,0xb7,0x27,0xcf,0x78,0x27,0xff,0x86,0xd7,0x02,0xf1,0xef,
+  0x96,0x65,0x90,0x94,0x9f,0x0f,0x80,0x65,0xe7,0x8d,0x9d,0x08,0x0a,0x48,0x50,0x16,
+  0x97,0xdd,0xb2,0x7d,0xbe,0x38,0xab,0xa4,0x03,0x44,0xf1,0x1a,0x32,0x56,0x74,0xb6,
+  0xa1,0xb5,0x61,0xfb,0x1b,0x74,0x34,0x13,0xa3,0xac,0xf2,0x10,0xc2,0xc0,0xdd,0xb2,
+  0xbb,0x1b,0xe2,0xc8,0x13,0x41,0x00,0x2b,0x37,0xb5,0xc4,0xa8,0x86,0xa7,0x81,0x13,
+  0xd3,0x1d,0x76,0x62,0x3c,0xbf,0x4e,0x84,0xb3,0xa6,0x8f,0xa3,0xca,0xa6,0x2c,0xd8,
+  0xc9,0x87,0x40,0xd4,0x8f,0x26,0xff,0x0f,0x78,0xe0,0x57,0x8d,0x46,0x23,0x4b,0xbb,
+  0xd2,0x19,0x54,0x98,0xfc,0x74,0x68,0xba,0xca,0xe7,0xdb,0x5b,0xad,0x0d,0x71,0x65,
+  0x83,0xbc,0x87,0xd9,0x98,0x82,0x97,0x71,0xa6,0x78,0x19,0x59,0x78,0x19,0x0a,0x5e,
+  0x5c,0x50,0x08,0x91,0x27,0x33,0x99,0x44,0xda,0xf5,0x60,0xd7,0x92,0xf9,0xc2,0x19,
+  0x32,0x71,0xf2,0x1e,0xbf,0x1d,0xed,0xf8,0x21,0x22,0xd8,0xe1,0x87,0x37,0x52,0x20,
+  0xd4,0x73,0x40,0x7c,0x08,0x96,0xb7,0x0e,0x20,0xab,0xe6,0xef,0xe8,0x6a,0xd5,0x2f,
+  0xe9,0x26,0x15,0x3a,0x7f,0x8d,0xc2,0x10,0x4f,0xef,0x84,0x5c,0x44,0x6f,0x68,0x1b,
+  0x8d,0x2e,0x7f,0x04,0x3e,0x39,0x27,0x82,0x6e,0x61,0x29,0x5d,0x03,0x29,0xce,0x52,
+  0x28,0x6f,0xa7,0xdf,0xde,0x12,0x9d,0x9c,0xf1,0x85,0x75,0x1d,0xf2,0xa1,0xb0,0x90,
+  0x5f,0xb3,0x7a,0x63,0x91,0x1f,0x1c,0xf9,0x6b,0xe2,0x55,0x74,0x89,0x5b,0x7a,0x0b,
+  0x11,0x45,0xe7,0xd8,0x86,0xad,0x68,0xe3,0x34,0x1a,0xe6,0x8b,0xab,0xec,0x01,0xab,
+  0xbc,0x70,0x18,0x96,0x87,0x58,0xb7,0xaa,0x47,0xd5,0x07,0xd1,0x25,0x85,0xca,0x76,
+  0xf6,0x06,0x0a,0x24,0x39,0xb1,0x29,0x62,0x0b,0x89,0x25,0x05,0x79,0x95,0xa5,0x6b,
+  0x81,0xc9,0xbf,0x82,0xc8,0x01,0xf9,0x58,0xce,0x54,0x40,0x4a,0x8d,0x29,0x8a,0xe7,
+  0x5c,0x5c,0xf1,0x4c,0x5b,0x9d,0xd9,0xf6,0xe1,0x74,0x6d,0x9a,0xdf,0xf8,0x48,0xca,
+  0xf3,0x90,0x64,0x71,0x59,0xb3,0x7c,0x5a,0xc2,0x29,0x12,0x1b,0xbf,0x45,0xfa,0x2e,
+  0x20,0xf4,0x5b,0xf8,0xf3,0xce,0xe4,0xbd,0xe7,0x40,0xa9,0xa9,0xa6,0x7d,0x01,0x82,
+  0x15,0x81,0x71,0x94,0xc1,0x05,0x21,0xa3,0x2a,0x8a,0x72,0x7a,0xcd,0x29,0xf7,0x9a,
+  0xed,0x36,0xc0,0xeb,0x0a,0xbd,0xd1,0xb8,0x2f,0xa7,0x7f,0x93,0x0d,0xbf,0xbe,0x98,
+  0x56,0x11,0x07,0x18,0xfa,0x7c,0xbb,0xf2,0x40,0x64,0x4d,0xe6,0x28,0xee,0x72,0x33,
+  0xb2,0xc6,0x84,0xc7,0xb7,0xcb,0x27,0x00,0xca,0xd1,0xdf,0x23,0x04,0x94,0xb3,0x19,
+  0x5d,0x90,0x65,0x71,0x2f,0xa0,0xbc,0x86,0xfb,0x20,0x58,0x14,0xd6,0x32,0xd2,0x6a,
+  0x89,0x6a,0x86,0x88,0x92,0xa5,0x1c,0x21,0x52,0xc3,0x69,0xac,0xe0,0x9d,0x44,0xc5,
+  0xb6,0xa8,0x31,0x71,0x36,0xba,0x1e,0x6d,0x2e,0x99,0x2b,0xa6,0x1f,0xc3,0x99,0x9e,
+  0x07,0x96,0x3c,0xc0,0x13,0x6d,0xfb,0x67,0xd1,0x48,0x96,0xaa,0x75,0x33,0x29,0x25,
+  0x8b,0x63,0x77,0xed,0x45,0x67,0x77,0x1c,0x2b,0x40,0x3d,0xc8,0xf7,0x80,0x7d,0x79,
+  0x94,0x47,0xa1,0x59,0x6a,0x04,0x73,0x4a,0xa2,0x9e,0x3e,0x0b,0x9d,0x94,0xdb,0xd2,
+  0xa2,0xd2,0x30,0x01,0x7a,0x94,0x12,0x09,0x4d,0x26,0x08,0x6a,0xc7,0x78,0xad,0x1e,
+  0x7d,0xf9,0xc3,0xa7,0x0b,0xd5,0x42,0xee,0x14,0x9f,0x62,0x10,0x9c,0x29,0x9e,0x04,
+  0x5f,0xd2,0x93,0xf6,0xad,0x49,0x4e,0x37,0xde,0xe9,0x4b,0xf8,0x2d,0x42,0x70,0x8a,
+  0xc9,0x93,0xc2,0x93,0xa0,0xbe,0x40,0xd1,0x75,0x06,0xb6,0x63,0xad,0xd3,0x75,0xf2,
+  0x6e,0xbf,0x2f,0x1f,0x22,0x84,0xa6,0x5c,0xce,0x25,0x00,0x8a,0x39,0xb3,0x06,0x39,
+  0x9e,0xb6,0x70,0x2b,0x6e,0x91,0xc8,0x02,0x3d,0x5b,0x89,0xfa,0xa6,0x5d,0x5f,0x51,
+  0x82,0x57,0x08,0x55,0x14,0x54,0x78,0x99,0x94,0x74,0xe4,0xa5,0xf3,0x6c,0xda,0xae,
+  0xc8,0xa1,0x4d,0x87,0x8e,0xb7,0x56,0x55,0xea,0x75,0x61,0xf4,0x72,0x75,0x57,0xef,
+  0x6f,0x71,0x8b,0x5e,0x2b,0x23,0xe1,0x45,0x45,0x0a,0x70,0xfc,0x1a,0xed,0x9b,0x16,
+  0xde,0x5b,0x40,0x9f,0xf3,0x72,0x07,0xbd,0x72,0x2c,0xe2,0x00,0x13,0x2f,0x54,0xfd,
+  0x4d,0x10,0xef,0xd7,0x45,0xfa,0x2e,0x3f,0x53,0x18,0x91,0x0f,0xbf,0x16,0xae,0x1d,
+  0x76,0x4a,0xfd,0xd4,0x22,0x81,0xa9,0x63,0x5d,0x32,0xb8,0xb1,0x4d,0x74,0x94,0x0c,
+  0x9e,0xd4,0x58,0x37,0xcd,0x37,0xdd,0xc1,0x04,0x05,0x59,0x5f,0x2b,0xa9,0x31,0xfe,
+  0x79,0xdb,0x9a,0xb8,0xcd,0x95,0x16,0x35,0x35,0x8c,0x4e,0xc9,0x71,0x57,0xef,0x32,
+  0x07,0xa8,0xe6,0x1f,0xf3,0x21,0x70,0x3c,0x04,0x39,0xdc,0x91,0x89,0x37,0xf8,0xc9,
+  0x42,0xa4,0x6f,0xb3,0xb1,0x4c,0xb4,0x6c,0x95,0xb5,0x9a,0xe2,0xd6,0x15,0x0a,0xfc,
+  0xf9,0x6a,0x7d,0xfa,0x46,0x1e,0x39,0x16,0xe3,0xc0,0x2d,0x77,0xe2,0xf7,0xe3,0x92,
+  0xee,0xb9,0x7b,0xe0,0x07,0xd6,0x50,0xb1,0x47,0xb5,0xa3,0x6a,0xbb,0xe1,0x32,0x3c,
+  0x64,0x60,0x11,0xa6,0x4a,0xfd,0xa3,0xcc,0xc8,0x1e,0x82,0xeb,0xcc,0x25,0x17,0x85,
+  0xf0,0x8b,0x36,0xc4,0x2a,0x93,0xa2,0x45,0x3c,0x56,0xf3,0x9a,0xd0,0x42,0x94,0x0d,
+  0xe8,0x21,0xb7,0x3a,0xff,0x78,0x8c,0xbc,0xf1,0x08,0x1f,0xf2,0xa1,0x07,0xdd,0x10,
+  0x76,0xd0,0x6d,0xc8,0x15,0x1b,0xbe,0xc0,0xb0,0x7e,0x4d,0x5b,0x1a,0x19,0x2c,0x19,
+  0x03,0x21,0x6c,0x87,0x5b,0xb2,0x55,0x28,0x6c,0xc3,0xef,0xd7,0xa9,0xb6,0x05,0xd9,
+  0xc9,0x31,0xa9,0x14,0x12,0x07,0x43,0x96,0xf2,0xe3,0x59,0x22,0x74,0x2e,0xef,0x2f,
+  0xfd,0x24,0xca,0xf4,0xc1,0xab,0x71,0xc0,0x06,0x7c,0xa6,0x7d,0x28,0xe4,0x2f,0xec,
+  0xf6,0xab,0x37,0xae,0xd7,0xe9,0x83,0xd9,0x78,0x51,0x2e,0x46,0xd6,0xff,0x42,0x47,
+  0x84,0xc4,0x07,0x13,0xe4,0x87,0x01,0xf0,0x98,0xd0,0xf1,0xfb,0x8d,0x95,0x4d,0x0f,
+  0xbf,0x36,0xfd,0x19,0x85,0xe3,0xe9,0x52,0x5c,0x9e,0xb2,0x83,0x9b,0x25,0x18,0x99,
+  0xff,0x13,0xb8,0xcf,0xef,0x33,0x7a,0xf1,0x07,0xba,0x20,0xf7,0x11,0x3a,0x45,0xda,
+  0x47,0xac,0xd2,0x07,0x11,0x1e,0x91,0x88,0xdb,0x7b,0x3a,0x39,0x6e,0x85,0x96,0x56,
+  0x36,0x1c,0x9e,0xb8,0xaf,0x9a,0xd9,0x29,0x21,0xa8,0x54,0x82,0x72,0xe6,0x89,0x91,
+  0xf3,0x57,0x98,0x91,0x44,0xf7,0xf9,0x62,0x5c,0x00,0xc6,0xfb,0x98,0x2e,0x7f,0xc2,
+  0xfb,0x86,0x39,0x4d,0xdf,0xc3,0x6f,0xf1,0x84,0x5b,0xfa,0x74,0xe4,0xea,0xe3,0xff,
+  0x5d,0x3e,0xfe,0x05,0xfc,0xfd,0x0c,0x3f,0x67,0xfb,0x67,0x46,0x84,0x7d,0x4c,0xb9,
+  0x32,0x3f,0x67,0x34,0x2f,0x40,0x67,0xa2,0xe5,0xca,0xe6,0xe5,0xc9,0xaf,0xe8,0xf6,
+  0x62,0xe5,0x96,0x6b,0xbc,0x6b,0x36,0xa2,0x30,0xb6,0x99,0xfc,0x19,0xca,0xbf,0xa4,
+  0xad,0x27,0xbe,0xbb,0xb2,0x32,0xbf,0x79,0x19,0x3b,0x0f,0xc3,0x03,0xa9,0x43,0xc9,
+  0x24,0xaa,0x4a,0x90,0x6c,0x92,0x4a,0x18,0x49,0x82,0xa6,0x04,0xa8,0x52,0x09,0xca,
+  0x97,0x57,0x8c,0xa0,0xef,0x9e,0x8e,0x7e,0xc0,0x8d,0x3f,0x46,0x7e,0xa3,0x0c,0x09,
+  0x49,0xc3,0x14,0x96,0x7c,0x7c,0xfc,0xce,0xf1,0xcf,0x81,0x19,0x27,0x1f,0x2b,0x53,
+  0x36,0xf9,0x0b,0x6d,0x21,0x7d,0x71,0xfc,0x88,0x95,0x30,0x29,0x03,0xde,0x7c,0xc9,
+  0x9f,0x4b,0x4c,0xa4,0x9b,0x7d,0x86,0xd7,0xfb,0x4e,0x27,0xb0,0x20,0x41,0x06,0x81,
+  0x55,0x02,0x65,0x13,0x58,0xc2,0x08,0x09,0x3c,0xed,0x26,0x47,0xb2,0xb3,0x93,0x32,
+  0x7a,0x57,0xec,0xf8,0xa4,0x5d,0xdf,0xab,0xd6,0x3b,0x63,0x73,0xd5,0x27,0xd8,0xcf,
+  0xd9,0x60,0xcd,0xd0,0x48,0x6a,0xc2,0x29,0x0e,0xab,0x88,0x46,0x51,0x85,0xf4,0x74,
+  0x75,0x52,0xac,0xb6,0xd4,0x26,0x05,0x61,0x93,0x32,0x09,0xeb,0xc2,0xcf,0x72,0x21,
+  0xdd,0xc1,0x13,0xeb,0xe6,0x52,0xef,0x05,0x56,0x48,0x43,0x57,0xec,0x4b,0x5b,0x57,
+  0x9f,0xf9,0xdc,0xe3,0x30,0xe1,0x06,0x22,0x6d,0xbd,0xe1,0x26,0x62,0x5b,0x6e,0xf0,
+  0xf3,0x93,0xea,0x8a,0xe1,0x63,0x39,0xd2,0x40,0xc9,0xdc,0x1d,0x10,0xc0,0x36,0x44,
+  0xd5,0x0d,0x79,0xd1,0x54,0x98,0x01,0x11,0x9e,0xba,0x16,0x03,0xa1,0xfb,0x15,0xb4,
+  0xdb,0x9a,0xd9,0x2a,0x7d,0xf4,0x9e,0xad,0xac,0xb2,0x05,0x7e,0x61,0x33,0x3b,0x8c,
+  0x5d,0xdf,0x97,0xdd,0xbd,0xe8,0x6f,0x23,0x78,0xe1,0xd0,0x3e,0xe2,0xc1,0xbc,0x07,
+  0xb1,0x14,0x02,0xcb,0xe9,0xcd,0x00,0x02,0x6a,0xc7,0x01,0xf0,0xf8,0x4e,0xb1,0x6c,
+  0xb3,0x38,0x38,0xde,0xf6,0x81,0x92,0x79,0x26,0xe9,0xc0,0x3f,0x69,0x7f,0xc8,0xc7,
+  0x58,0x43,0x2c,0x6b,0xa2,0xa7,0x36,0x53,0xe3,0x4e,0x55,0x71,0x3a,0x5c,0x60,0xc1,
+  0x8d,0x38,0xb9,0xc6,0x0e,0x24,0x39,0xc3,0x17,0xd7,0x90,0xec,0x9b,0xee,0xbe,0x95,
+  0x6f,0x03,0x3f,0x38,0x1f,0x22,0x4a,0x50,0x88,0xb7,0xef,0xe1,0x45,0x3a,0xab,0x5d,
+  0x01,0xe1,0x3e,0x6e,0xf5,0x68,0x10,0x23,0x0b,0x79,0x33,0x8a,0x08,0x74,0x37,0xa3,
+  0x64,0x17,0x04,0xc5,0xc7,0x15,0xa6,0x1e,0x40,0xb1,0xc8,0x8d,0xec,0x28,0xe9,0x07,
+  0x22,0x71,0x9a,0x78,0x50,0xe4,0xc1,0x48,0x56,0x92,0x1c,0x54,0x9b,0xa3,0x1b,0x13,
+  0xb7,0x30,0x45,0x5b,0x70,0x57,0x2d,0xe2,0xa2,0x1a,0x1f,0x3c,0x5d,0xc4,0x75,0xf2,
+  0xb4,0xf0,0x78,0x6e,0xc6,0xdc,0xac,0x69,0xe1,0x73,0xb9,0x69,0xe1,0x73,0xa7,0x48,
+  0x0b,0x57,0xb5,0x68,0x22,0x35,0x1c,0x70,0x7f,0x30,0xf9,0x0d,0xda,0x76,0xa0,0xea,
+  0x7e,0x8a,0xa6,0x97,0x62,0x51,0x80,0xd1,0x87,0x5a,0xee,0x47,0xe2,0xeb,0x57,0xa8,
+  0x03,0xff,0x48,0x1f,0x0e,0x0c,0x55,0xde,0xa3,0x30,0x11,0xf1,0xf3,0xb4,0x1b,0x2b,
+  0x93,0x29,0xd9,0xcf,0x1a,0x0f,0xd4,0xed,0x96,0x78,0x8a,0x47,0x7e,0x46,0xb9,0x9e,
+  0x50,0x9e,0x66,0xc1,0x86,0xc9,0x1f,0x62,0x5c,0x68,0x90,0xd2,0x59,0xf5,0x27,0x74,
+  0x03,0xe7,0x2f,0x12,0x27,0xdb,0xe9,0xbb,0x0b,0x27,0x1d,0x3c,0x7e,0x67,0x20,0xcc,
+  0x1e,0x01,0x3e,0x53,0x14,0x3f,0x7d,0xf5,0x0d,0xa7,0xae,0xcd,0x94,0xbb,0x52,0x85,
+  0x4c,0x3c,0xb9,0x0c,0x94,0x3b,0x49,0x52,0x9e,0x02,0x91,0x84,0x19,0x20,0x2d,0x08,
+  0x29,0x1b,0x63,0xf7,0xaa,0x54,0x64,0x09,0x70,0xbe,0x92,0x26,0x0e,0xb2,0x92,0x2d,
+  0x54,0x73,0x51,0x52,0xa5,0xd0,0x8b,0xad,0x98,0x64,0xc4,0xfb,0x20,0x04,0xe0,0x06,
+  0x17,0xb1,0x38,0x6d,0xcd,0x66,0xbb,0x89,0xa7,0x79,0x8b,0x03,0x55,0x64,0xa5,0x0a,
+  0x12,0x05,0xee,0xc9,0x00,0xea,0xd2,0x52,0x85,0x29,0xa4,0x1f,0xbf,0x9e,0xeb,0x48,
+  0x4b,0x64,0xfa,0x6a,0x45,0x5e,0x24,0xee,0xc2,0x6d,0x0e,0x82,0x26,0x66,0x2e,0xbc,
+  0x4a,0x24,0x53,0x00,0x92,0xc8,0xca,0x3e,0x34,0x10,0xe3,0xa5,0x8c,0x84,0xa5,0x30,
+  0xa3,0x47,0x7e,0x84,0x30,0x2b,0x39,0xa9,0x11,0x6c,0x5b,0x4e,0x45,0xcf,0xdd,0x33,
+  0xe5,0x16,0x88,0x3c,0x41,0x1b,0x8e,0x08,0xb7,0x48,0x71,0xfb,0xe7,0x6d,0x7e,0xa3,
+  0x84,0xfc,0x6e,0x1e,0xdf,0xee,0xfc,0x04,0x96,0x50,0x5a,0x61,0x81,0x34,0xc3,0xf8,
+  0xa8,0x8c,0x53,0x8d,0xca,0xf8,0x6a,0x47,0x45,0xc6,0xd4,0xca,0xbc,0xdf,0xf5,0xec,
+  0x51,0x70,0x99,0x81,0xb7,0x00,0x32,0xff,0xf2,0xca,0xfc,0x76,0x30,0x1c,0x5c,0xfe,
+  0xff,0xd1,0xa4,0xba,0x0f,0xd4,0x0e,0x01,0x00,
+};
+
+#endif // WEB_UI_GZ_H
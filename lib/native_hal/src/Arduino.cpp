@@ -0,0 +1,206 @@
+// =================================================================================
+// File:         lib/native_hal/src/Arduino.cpp
+// Description:  Реализация подмножества Arduino-ядра для [env:native].
+// =================================================================================
+
+#include "Arduino.h"
+#include "sim_clock.h"
+#include "sim_devices.h"
+
+#include <stdarg.h>
+#include <ctype.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// --- String ---
+
+static std::string numToString(unsigned long v, unsigned char base, bool negative) {
+    if (base < 2 || base > 16) base = 10;
+    char buf[72];
+    char* p = buf + sizeof(buf) - 1;
+    *p = '\0';
+    do {
+        *--p = "0123456789ABCDEF"[v % base];
+        v /= base;
+    } while (v);
+    if (negative) *--p = '-';
+    return std::string(p);
+}
+
+String::String(int v, unsigned char base) : String((long)v, base) {}
+String::String(unsigned int v, unsigned char base) : String((unsigned long)v, base) {}
+String::String(long v, unsigned char base) {
+    if (base == 10 && v < 0) s_ = numToString((unsigned long)(-v), base, true);
+    else s_ = numToString((unsigned long)v, base, false);
+}
+String::String(unsigned long v, unsigned char base) : s_(numToString(v, base, false)) {}
+String::String(float v, unsigned int decimals) : String((double)v, decimals) {}
+String::String(double v, unsigned int decimals) {
+    if (isnan(v)) { s_ = "nan"; return; }
+    if (isinf(v)) { s_ = "inf"; return; }
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+}
+
+bool String::equalsIgnoreCase(const String& o) const {
+    if (s_.size() != o.s_.size()) return false;
+    for (size_t i = 0; i < s_.size(); i++) {
+        if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+    }
+    return true;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t r = s_.find(c, from);
+    return r == std::string::npos ? -1 : (int)r;
+}
+
+int String::indexOf(const String& str, unsigned int from) const {
+    size_t r = s_.find(str.s_, from);
+    return r == std::string::npos ? -1 : (int)r;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t r = s_.rfind(c);
+    return r == std::string::npos ? -1 : (int)r;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    if (to > s_.size()) to = (unsigned int)s_.size();
+    return String(s_.substr(from, to - from).c_str());
+}
+
+void String::trim() {
+    size_t b = 0, e = s_.size();
+    while (b < e && isspace((unsigned char)s_[b])) b++;
+    while (e > b && isspace((unsigned char)s_[e - 1])) e--;
+    s_ = s_.substr(b, e - b);
+}
+
+void String::toUpperCase() { for (auto& c : s_) c = (char)toupper((unsigned char)c); }
+void String::toLowerCase() { for (auto& c : s_) c = (char)tolower((unsigned char)c); }
+
+void String::replace(const String& from, const String& to) {
+    if (from.s_.empty()) return;
+    size_t pos = 0;
+    while ((pos = s_.find(from.s_, pos)) != std::string::npos) {
+        s_.replace(pos, from.s_.size(), to.s_);
+        pos += to.s_.size();
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index >= s_.size()) return;
+    s_.erase(index, count);
+}
+
+String operator+(const String& a, const String& b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, const char* b) { String r(a); r.concat(b); return r; }
+String operator+(const char* a, const String& b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, char b) { String r(a); r.concat(b); return r; }
+
+// --- Print / Stream ---
+
+size_t Print::print(long v, int base) {
+    String s(v, (unsigned char)base);
+    return print(s);
+}
+
+size_t Print::print(unsigned long v, int base) {
+    String s(v, (unsigned char)base);
+    return print(s);
+}
+
+size_t Print::print(double v, int digits) {
+    String s(v, (unsigned int)digits);
+    return print(s);
+}
+
+size_t Print::printf(const char* fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, std::min((size_t)n, sizeof(buf) - 1));
+}
+
+size_t Stream::readBytes(char* buf, size_t n) {
+    size_t got = 0;
+    while (got < n) {
+        int c = read();
+        if (c < 0) break;
+        buf[got++] = (char)c;
+    }
+    return got;
+}
+
+String Stream::readStringUntil(char terminator) {
+    String r;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) r.concat((char)c);
+    return r;
+}
+
+// --- Serial ---
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (!muted_) fputc(c, stdout);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+    if (!muted_) fwrite(buf, 1, n, stdout);
+    return n;
+}
+
+int HardwareSerial::available() { return (int)rx_.size(); }
+
+int HardwareSerial::read() {
+    if (rx_.empty()) return -1;
+    int c = (uint8_t)rx_[0];
+    rx_.erase(0, 1);
+    return c;
+}
+
+int HardwareSerial::peek() { return rx_.empty() ? -1 : (uint8_t)rx_[0]; }
+
+void HardwareSerial::simInject(const char* text) { if (text) rx_ += text; }
+
+// --- IPAddress / ESP ---
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+    return String(buf);
+}
+
+uint32_t EspClass::getCycleCount() const {
+    return (uint32_t)(sim::nowUs() * 240u);
+}
+
+void EspClass::restart() {
+    fprintf(stderr, "[sim] ESP.restart() requested at %.3f s, stopping simulation\n", sim::nowUs() / 1e6);
+    exit(0);
+}
+
+// --- Время ---
+
+unsigned long millis() { return (unsigned long)(sim::nowUs() / 1000u); }
+unsigned long micros() { return (unsigned long)sim::nowUs(); }
+void delay(unsigned long ms) { sim::advanceUs((uint64_t)ms * 1000u); }
+void delayMicroseconds(unsigned int us) { sim::advanceUs(us); }
+void yield() {}
+
+// --- GPIO ---
+
+void pinMode(uint8_t pin, uint8_t mode) { sim::gpioSetMode(pin, mode); }
+int digitalRead(uint8_t pin) { return sim::gpioRead(pin); }
+void digitalWrite(uint8_t pin, uint8_t val) { sim::gpioWrite(pin, val); }
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) { sim::gpioAttachIsr(pin, isr, mode); }
+void detachInterrupt(uint8_t pin) { sim::gpioAttachIsr(pin, nullptr, 0); }
@@ -0,0 +1,261 @@
+// =================================================================================
+// File:         lib/native_hal/src/Arduino.h
+// Description:  Минимальная замена Arduino-ядра ESP32 для сборки [env:native].
+//               Содержит String, Print/Stream, Serial, IPAddress, GPIO и
+//               функции времени поверх виртуальных часов симулятора.
+//               Реализовано только то, что использует прошивка.
+// =================================================================================
+
+#ifndef NATIVE_HAL_ARDUINO_H
+#define NATIVE_HAL_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#include "pgmspace.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT          0x01
+#define OUTPUT         0x03
+#define INPUT_PULLUP   0x05
+#define INPUT_PULLDOWN 0x09
+#define OUTPUT_OPEN_DRAIN 0x13
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define bit(b) (1UL << (b))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define IRAM_ATTR
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+#define digitalPinToInterrupt(p) (p)
+
+using std::isnan;
+using std::isinf;
+using std::min;
+using std::max;
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+// --- String (подмножество Arduino WString) ---
+
+class String {
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") {}
+    String(const String& o) = default;
+    String(String&& o) = default;
+    explicit String(char c) : s_(1, c) {}
+    String(const __FlashStringHelper* s) : s_(reinterpret_cast<const char*>(s)) {}
+    explicit String(int v, unsigned char base = 10);
+    explicit String(unsigned int v, unsigned char base = 10);
+    explicit String(long v, unsigned char base = 10);
+    explicit String(unsigned long v, unsigned char base = 10);
+    explicit String(float v, unsigned int decimals = 2);
+    explicit String(double v, unsigned int decimals = 2);
+    explicit String(unsigned char v, unsigned char base = 10) : String((unsigned int)v, base) {}
+
+    String& operator=(const String& o) = default;
+    String& operator=(String&& o) = default;
+    String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+
+    unsigned int length() const { return (unsigned int)s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    const char* c_str() const { return s_.c_str(); }
+    bool reserve(unsigned int n) { s_.reserve(n); return true; }
+
+    bool concat(const String& o) { s_ += o.s_; return true; }
+    bool concat(const char* s) { if (s) s_ += s; return true; }
+    bool concat(const char* s, unsigned int n) { if (s) s_.append(s, n); return true; }
+    bool concat(char c) { s_ += c; return true; }
+    bool concat(int v) { return concat(String(v)); }
+    bool concat(unsigned int v) { return concat(String(v)); }
+    bool concat(long v) { return concat(String(v)); }
+    bool concat(unsigned long v) { return concat(String(v)); }
+    bool concat(float v) { return concat(String(v)); }
+    bool concat(double v) { return concat(String(v)); }
+
+    template <typename T> String& operator+=(const T& v) { concat(v); return *this; }
+
+    bool equals(const String& o) const { return s_ == o.s_; }
+    bool equals(const char* s) const { return s && s_ == s; }
+    bool equalsIgnoreCase(const String& o) const;
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* s) const { return equals(s); }
+    bool operator!=(const String& o) const { return s_ != o.s_; }
+    bool operator!=(const char* s) const { return !equals(s); }
+    bool operator<(const String& o) const { return s_ < o.s_; }
+
+    char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char& operator[](unsigned int i) { return s_[i]; }
+
+    bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+    bool endsWith(const String& p) const {
+        return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& str, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    String substring(unsigned int from) const { return substring(from, length()); }
+    String substring(unsigned int from, unsigned int to) const;
+
+    void trim();
+    void toUpperCase();
+    void toLowerCase();
+    void replace(const String& from, const String& to);
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+
+    long toInt() const { return atol(s_.c_str()); }
+    float toFloat() const { return (float)atof(s_.c_str()); }
+    double toDouble() const { return atof(s_.c_str()); }
+
+private:
+    std::string s_;
+};
+
+String operator+(const String& a, const String& b);
+String operator+(const String& a, const char* b);
+String operator+(const char* a, const String& b);
+String operator+(const String& a, char b);
+
+// --- Print / Stream ---
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t n) {
+        size_t w = 0;
+        while (n--) w += write(*buf++);
+        return w;
+    }
+    size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+    size_t write(const char* buf, size_t n) { return write((const uint8_t*)buf, n); }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper* s) { return write(reinterpret_cast<const char*>(s)); }
+    size_t print(const String& s) { return write(s.c_str(), s.length()); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC);
+    size_t print(unsigned long v, int base = DEC);
+    size_t print(long long v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned long long v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(double v, int digits = 2);
+    size_t print(bool v) { return print((int)v); }
+
+    template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(const T& v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+    size_t println() { return write("\r\n"); }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    size_t readBytes(char* buf, size_t n);
+    size_t readBytes(uint8_t* buf, size_t n) { return readBytes((char*)buf, n); }
+    String readStringUntil(char terminator);
+    void setTimeout(unsigned long ms) { timeout_ = ms; }
+protected:
+    unsigned long timeout_ = 1000;
+};
+
+// Serial: вывод в stdout, ввод — из очереди, которую наполняет симулятор
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t n) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override { fflush(stdout); } // Дождаться вывода (перед abort())
+    operator bool() const { return true; }
+
+    // --- Только для симулятора ---
+    void simInject(const char* text);
+    void simSetMuted(bool muted) { muted_ = muted; }
+private:
+    std::string rx_;
+    bool muted_ = false;
+};
+
+extern HardwareSerial Serial;
+
+// --- IPAddress ---
+
+class IPAddress {
+public:
+    IPAddress() : b_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : b_{a, b, c, d} {}
+    uint8_t operator[](int i) const { return b_[i & 3]; }
+    String toString() const;
+private:
+    uint8_t b_[4];
+};
+
+// --- ESP (частично) ---
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() const { return 200 * 1024; }
+    uint32_t getMinFreeHeap() const { return 180 * 1024; }
+    uint32_t getCycleCount() const;       // 240 МГц от виртуальных часов
+    uint32_t getCpuFreqMHz() const { return 240; }
+    void restart();
+};
+
+extern EspClass ESP;
+
+// --- Время и GPIO ---
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+// Точки входа скетча (определены в src/main.cpp)
+void setup();
+void loop();
+
+#endif // NATIVE_HAL_ARDUINO_H
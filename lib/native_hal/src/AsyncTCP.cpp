@@ -0,0 +1,148 @@
+// =================================================================================
+// File:         lib/native_hal/src/AsyncTCP.cpp
+// Description:  AsyncServer/AsyncClient для [env:native]: соединения с
+//               "браузером" симулятора, доставка по времени и подтверждения.
+// =================================================================================
+
+#include "AsyncTCP.h"
+#include "WiFi.h"
+#include "sim_clock.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+std::vector<AsyncServer*>& servers() {
+    static std::vector<AsyncServer*> s;
+    return s;
+}
+
+std::vector<std::shared_ptr<sim::TcpPeer>>& peers() {
+    static std::vector<std::shared_ptr<sim::TcpPeer>> p;
+    return p;
+}
+
+} // namespace
+
+namespace sim {
+
+void TcpPeer::sendData(const std::string& data) {
+    if (!open || !client || !client->dataCb_ || data.empty()) return;
+    std::string buf = data;
+    client->dataCb_(client->dataArg_, client, &buf[0], buf.size());
+}
+
+void TcpPeer::close() {
+    if (!open) return;
+    open = false;
+    if (client) client->disconnected();
+}
+
+bool tcpListening(uint16_t port) {
+    if (!WiFi.simApActive()) return false;
+    for (AsyncServer* s : servers()) {
+        if (s->port_ == port && s->listening_) return true;
+    }
+    return false;
+}
+
+std::shared_ptr<TcpPeer> tcpConnect(uint16_t port) {
+    if (!WiFi.simApActive()) return nullptr;
+    for (AsyncServer* s : servers()) {
+        if (s->port_ != port || !s->listening_ || !s->connectCb_) continue;
+        auto peer = std::make_shared<TcpPeer>();
+        AsyncClient* c = new AsyncClient();
+        c->peer_ = peer;
+        peer->client = c;
+        peer->drainUs = nowUs();
+        peers().push_back(peer);
+        s->connectCb_(s->connectArg_, c);
+        return peer;
+    }
+    return nullptr;
+}
+
+void tcpPoll() {
+    uint64_t now = nowUs();
+    uint32_t byteUs = cost().httpByteUs ? cost().httpByteUs : 1;
+    auto& list = peers();
+    for (size_t i = 0; i < list.size(); i++) {
+        std::shared_ptr<TcpPeer> p = list[i];
+        if (!WiFi.simApActive()) p->close(); // Точка доступа выключена - соединения рвутся
+
+        if (p->inFlight.empty()) {
+            p->drainUs = now;
+            continue;
+        }
+        size_t n = (size_t)((now - p->drainUs) / byteUs);
+        if (!n) continue;
+        n = std::min(n, p->inFlight.size());
+        p->received.append(p->inFlight, 0, n);
+        p->inFlight.erase(0, n);
+        p->drainUs += (uint64_t)n * byteUs;
+        if (p->inFlight.empty()) p->drainUs = now;
+        if (p->open && p->client && p->client->ackCb_) {
+            p->client->ackCb_(p->client->ackArg_, p->client, n, (uint32_t)(now / 1000u));
+        }
+    }
+    list.erase(std::remove_if(list.begin(), list.end(), [](const std::shared_ptr<TcpPeer>& p) {
+        return !p->open && !p->client && p->inFlight.empty();
+    }), list.end());
+}
+
+} // namespace sim
+
+AsyncClient::~AsyncClient() {
+    if (!peer_) return;
+    peer_->client = nullptr;
+    peer_->open = false;
+    peer_->queued.clear();
+}
+
+size_t AsyncClient::space() const {
+    if (!connected()) return 0;
+    size_t used = peer_->queued.size() + peer_->inFlight.size();
+    return used < SIM_TCP_SND_BUF ? SIM_TCP_SND_BUF - used : 0;
+}
+
+size_t AsyncClient::add(const char* data, size_t size, uint8_t apiflags) {
+    (void)apiflags;
+    size_t n = std::min(size, space());
+    if (!n) return 0;
+    peer_->queued.append(data, n);
+    sim::advanceUs(sim::cost().tcpWriteUs);
+    return n;
+}
+
+bool AsyncClient::send() {
+    if (!peer_ || peer_->queued.empty()) return false;
+    if (peer_->inFlight.empty()) peer_->drainUs = sim::nowUs();
+    peer_->inFlight += peer_->queued;
+    peer_->queued.clear();
+    return true;
+}
+
+void AsyncClient::close(bool now) {
+    (void)now;
+    if (!peer_ || !peer_->open) return;
+    peer_->open = false;
+    disconnected(); // Как _close() в AsyncTCP: onDisconnect сразу, в контексте вызывающего
+}
+
+void AsyncClient::disconnected() {
+    // Обработчик может удалить объект - после вызова к полям не обращаться
+    AcConnectHandler cb = discCb_;
+    void* arg = discArg_;
+    if (cb) cb(arg, this);
+}
+
+void AsyncServer::begin() {
+    listening_ = true;
+    if (std::find(servers().begin(), servers().end(), this) == servers().end()) servers().push_back(this);
+}
+
+void AsyncServer::end() {
+    listening_ = false;
+    servers().erase(std::remove(servers().begin(), servers().end(), this), servers().end());
+}
@@ -0,0 +1,105 @@
+// =================================================================================
+// File:         lib/native_hal/src/AsyncTCP.h
+// Description:  AsyncServer/AsyncClient (API AsyncTCP) для [env:native].
+//               Другой конец соединения - "браузер" симулятора (sim::TcpPeer):
+//               его данные приходят в onData сразу, а отправленное прошивкой
+//               уходит со скоростью cost().httpByteUs на байт и
+//               подтверждается onAck в sim::tcpPoll(). Окно передачи -
+//               SIM_TCP_SND_BUF, как TCP_SND_BUF в lwIP ESP32.
+// =================================================================================
+
+#ifndef NATIVE_HAL_ASYNCTCP_H
+#define NATIVE_HAL_ASYNCTCP_H
+
+#include "Arduino.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+#define ASYNC_WRITE_FLAG_MORE 0x02
+#define SIM_TCP_SND_BUF 5744
+
+class AsyncClient;
+
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+
+namespace sim {
+// Конец соединения со стороны "браузера"
+struct TcpPeer {
+    AsyncClient* client = nullptr;  // nullptr - прошивка удалила объект
+    std::string received;           // Доставлено от прошивки
+    std::string queued;             // add() без send()
+    std::string inFlight;           // Отправлено, ещё не доставлено
+    uint64_t drainUs = 0;           // Момент, до которого доставка посчитана
+    bool open = true;
+
+    void sendData(const std::string& data); // Браузер -> onData прошивки
+    void close();                           // Браузер закрыл -> onDisconnect прошивки
+};
+
+// Подключиться к слушающему порту; nullptr - никто не слушает
+std::shared_ptr<TcpPeer> tcpConnect(uint16_t port);
+bool tcpListening(uint16_t port);
+// Доставка отправленного прошивкой и подтверждения (из цикла симулятора)
+void tcpPoll();
+}
+
+class AsyncClient {
+public:
+    AsyncClient() {}
+    ~AsyncClient();
+
+    void onData(AcDataHandler cb, void* arg = nullptr) { dataCb_ = cb; dataArg_ = arg; }
+    void onAck(AcAckHandler cb, void* arg = nullptr) { ackCb_ = cb; ackArg_ = arg; }
+    void onDisconnect(AcConnectHandler cb, void* arg = nullptr) { discCb_ = cb; discArg_ = arg; }
+
+    size_t space() const;
+    size_t add(const char* data, size_t size, uint8_t apiflags = ASYNC_WRITE_FLAG_COPY);
+    bool send();
+    size_t write(const char* data, size_t size) { size_t n = add(data, size); send(); return n; }
+    bool connected() const { return peer_ && peer_->open; }
+    bool canSend() const { return space() > 0; }
+    void close(bool now = false);
+    void stop() { close(false); }
+    void setNoDelay(bool nodelay) { (void)nodelay; }
+    void setRxTimeout(uint32_t timeout) { (void)timeout; }
+
+private:
+    friend struct sim::TcpPeer;
+    friend std::shared_ptr<sim::TcpPeer> sim::tcpConnect(uint16_t port);
+    friend void sim::tcpPoll();
+    void disconnected();
+
+    std::shared_ptr<sim::TcpPeer> peer_;
+    AcDataHandler dataCb_;
+    void* dataArg_ = nullptr;
+    AcAckHandler ackCb_;
+    void* ackArg_ = nullptr;
+    AcConnectHandler discCb_;
+    void* discArg_ = nullptr;
+};
+
+class AsyncServer {
+public:
+    explicit AsyncServer(uint16_t port) : port_(port) {}
+    ~AsyncServer() { end(); }
+
+    void onClient(AcConnectHandler cb, void* arg) { connectCb_ = cb; connectArg_ = arg; }
+    void begin();
+    void end();
+    void setNoDelay(bool nodelay) { (void)nodelay; }
+
+private:
+    friend std::shared_ptr<sim::TcpPeer> sim::tcpConnect(uint16_t port);
+    friend bool sim::tcpListening(uint16_t port);
+
+    uint16_t port_;
+    bool listening_ = false;
+    AcConnectHandler connectCb_;
+    void* connectArg_ = nullptr;
+};
+
+#endif // NATIVE_HAL_ASYNCTCP_H
@@ -0,0 +1,132 @@
+// =================================================================================
+// File:         lib/native_hal/src/DallasTemperature.cpp
+// Description:  Реализация подмножества DallasTemperature поверх OneWire.
+// =================================================================================
+
+#include "DallasTemperature.h"
+
+void DallasTemperature::begin() {
+    uint8_t addr[8];
+    deviceCount_ = 0;
+    bitResolution_ = 9;
+    wire_->reset_search();
+    while (wire_->search(addr)) {
+        if (!validAddress(addr)) continue;
+        deviceCount_++;
+        uint8_t res = getResolution(addr);
+        if (res > bitResolution_) bitResolution_ = res;
+    }
+    wire_->reset_search();
+}
+
+bool DallasTemperature::getAddress(uint8_t* address, uint8_t index) {
+    uint8_t depth = 0;
+    wire_->reset_search();
+    while (depth <= index && wire_->search(address)) {
+        if (depth == index && validAddress(address)) return true;
+        depth++;
+    }
+    return false;
+}
+
+bool DallasTemperature::readScratchPad(const uint8_t* address, uint8_t* scratchPad) {
+    if (wire_->reset() == 0) return false;
+    wire_->select(address);
+    wire_->write(0xBE);
+    for (uint8_t i = 0; i < 9; i++) scratchPad[i] = wire_->read();
+    return wire_->reset() == 1;
+}
+
+bool DallasTemperature::isConnected(const uint8_t* address) {
+    ScratchPad sp;
+    return isConnected(address, sp);
+}
+
+bool DallasTemperature::isConnected(const uint8_t* address, uint8_t* scratchPad) {
+    bool ok = readScratchPad(address, scratchPad);
+    return ok && OneWire::crc8(scratchPad, 8) == scratchPad[8];
+}
+
+void DallasTemperature::setResolution(uint8_t newResolution) {
+    if (newResolution < 9) newResolution = 9;
+    if (newResolution > 12) newResolution = 12;
+    bitResolution_ = newResolution;
+    uint8_t addr[8];
+    wire_->reset_search();
+    while (wire_->search(addr)) {
+        if (validAddress(addr)) setResolution(addr, bitResolution_, true);
+    }
+    wire_->reset_search();
+}
+
+bool DallasTemperature::setResolution(const uint8_t* address, uint8_t newResolution, bool skipGlobalBitResolutionCalculation) {
+    if (newResolution < 9) newResolution = 9;
+    if (newResolution > 12) newResolution = 12;
+    ScratchPad sp;
+    if (!isConnected(address, sp)) return false;
+    uint8_t config = (uint8_t)(((newResolution - 9) << 5) | 0x1F);
+    if (sp[4] != config) {
+        wire_->reset();
+        wire_->select(address);
+        wire_->write(0x4E);
+        wire_->write(sp[2]);
+        wire_->write(sp[3]);
+        wire_->write(config);
+        wire_->reset();
+    }
+    if (!skipGlobalBitResolutionCalculation && newResolution > bitResolution_) bitResolution_ = newResolution;
+    return true;
+}
+
+uint8_t DallasTemperature::getResolution(const uint8_t* address) {
+    ScratchPad sp;
+    if (!isConnected(address, sp)) return 0;
+    return (uint8_t)(9 + ((sp[4] >> 5) & 0x03));
+}
+
+uint16_t DallasTemperature::millisToWaitForConversion(uint8_t bitResolution) {
+    switch (bitResolution) {
+        case 9:  return 94;
+        case 10: return 188;
+        case 11: return 375;
+        default: return 750;
+    }
+}
+
+void DallasTemperature::blockTillConversionComplete(uint8_t bitResolution) {
+    delay(millisToWaitForConversion(bitResolution));
+}
+
+void DallasTemperature::requestTemperatures() {
+    wire_->reset();
+    wire_->skip();
+    wire_->write(0x44);
+    if (waitForConversion_) blockTillConversionComplete(bitResolution_);
+}
+
+bool DallasTemperature::requestTemperaturesByAddress(const uint8_t* address) {
+    uint8_t res = getResolution(address);
+    if (res == 0) return false;
+    wire_->reset();
+    wire_->select(address);
+    wire_->write(0x44);
+    if (waitForConversion_) blockTillConversionComplete(res);
+    return true;
+}
+
+bool DallasTemperature::isConversionComplete() {
+    return wire_->read_bit() == 1;
+}
+
+float DallasTemperature::getTempC(const uint8_t* address) {
+    ScratchPad sp;
+    if (!isConnected(address, sp)) return DEVICE_DISCONNECTED_C;
+    int16_t raw = (int16_t)(((uint16_t)sp[1] << 8) | sp[0]);
+    return rawToCelsius(raw);
+}
+
+float DallasTemperature::getTempCByIndex(uint8_t index) {
+    DeviceAddress addr;
+    if (!getAddress(addr, index)) return DEVICE_DISCONNECTED_C;
+    return getTempC(addr);
+}
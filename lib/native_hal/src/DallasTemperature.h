@@ -0,0 +1,57 @@
+// =================================================================================
+// File:         lib/native_hal/src/DallasTemperature.h
+// Description:  Подмножество DallasTemperature (M. Burton) для [env:native].
+//               Работает по протоколу поверх OneWire, поэтому стоимость
+//               обмена с датчиками в симуляторе такая же, как на шине.
+// =================================================================================
+
+#ifndef NATIVE_HAL_DALLAS_TEMPERATURE_H
+#define NATIVE_HAL_DALLAS_TEMPERATURE_H
+
+#include "OneWire.h"
+
+#define DEVICE_DISCONNECTED_C -127
+#define DEVICE_DISCONNECTED_RAW -7040
+
+typedef uint8_t DeviceAddress[8];
+typedef uint8_t ScratchPad[9];
+
+class DallasTemperature {
+public:
+    explicit DallasTemperature(OneWire* wire) : wire_(wire) {}
+
+    void begin();
+    uint8_t getDeviceCount() const { return deviceCount_; }
+    bool getAddress(uint8_t* address, uint8_t index);
+    bool validAddress(const uint8_t* address) { return OneWire::crc8(address, 7) == address[7]; }
+    bool isConnected(const uint8_t* address);
+    bool isConnected(const uint8_t* address, uint8_t* scratchPad);
+    bool readScratchPad(const uint8_t* address, uint8_t* scratchPad);
+
+    void setResolution(uint8_t newResolution);
+    bool setResolution(const uint8_t* address, uint8_t newResolution, bool skipGlobalBitResolutionCalculation = false);
+    uint8_t getResolution() const { return bitResolution_; }
+    uint8_t getResolution(const uint8_t* address);
+
+    void setWaitForConversion(bool flag) { waitForConversion_ = flag; }
+    bool getWaitForConversion() const { return waitForConversion_; }
+
+    void requestTemperatures();
+    bool requestTemperaturesByAddress(const uint8_t* address);
+    bool isConversionComplete();
+    static uint16_t millisToWaitForConversion(uint8_t bitResolution);
+
+    float getTempC(const uint8_t* address);
+    float getTempCByIndex(uint8_t index);
+    static float rawToCelsius(int16_t raw) { return raw * 0.0625f; }
+
+private:
+    void blockTillConversionComplete(uint8_t bitResolution);
+
+    OneWire* wire_;
+    uint8_t deviceCount_ = 0;
+    uint8_t bitResolution_ = 9;
+    bool waitForConversion_ = true;
+};
+
+#endif // NATIVE_HAL_DALLAS_TEMPERATURE_H
@@ -0,0 +1,285 @@
+// =================================================================================
+// File:         lib/native_hal/src/OneWire.cpp
+// Description:  Эмуляция протокола 1-Wire для DS18B20 на виртуальной шине.
+// =================================================================================
+
+#include "OneWire.h"
+#include "sim_clock.h"
+#include "sim_devices.h"
+
+void OneWire::begin(uint8_t pin) {
+    pin_ = pin;
+    reset_search();
+}
+
+void OneWire::slots(uint32_t n) {
+    sim::OneWireBus& bus = sim::owBus(pin_);
+    uint32_t us = n * sim::cost().owSlotUs;
+    bus.slots += n;
+    bus.busTimeUs += us;
+    sim::advanceUs(us);
+}
+
+void OneWire::settleConversions() {
+    uint64_t now = sim::nowUs();
+    for (sim::Ds18b20* d : sim::owBus(pin_).devices) {
+        if (d->converting && now >= d->conversionEndUs) d->completeConversion();
+    }
+}
+
+uint8_t OneWire::reset() {
+    sim::OneWireBus& bus = sim::owBus(pin_);
+    bus.resets++;
+    bus.busTimeUs += sim::cost().owResetUs;
+    sim::advanceUs(sim::cost().owResetUs);
+    settleConversions();
+    phase_ = PH_ROM_CMD;
+    selected_ = -1;
+    anySelected_ = false;
+    bitCount_ = 0;
+    for (sim::Ds18b20* d : bus.devices) {
+        if (d->connected) return 1;
+    }
+    return 0;
+}
+
+void OneWire::select(const uint8_t rom[8]) {
+    write(0x55);
+    for (int i = 0; i < 8; i++) write(rom[i]);
+}
+
+void OneWire::skip() { write(0xCC); }
+
+void OneWire::write_bytes(const uint8_t* buf, uint16_t count, bool power) {
+    for (uint16_t i = 0; i < count; i++) write(buf[i], power);
+}
+
+void OneWire::write(uint8_t v, uint8_t power) {
+    (void)power;
+    slots(8);
+    handleByte(v);
+}
+
+void OneWire::handleByte(uint8_t v) {
+    sim::OneWireBus& bus = sim::owBus(pin_);
+    switch (phase_) {
+        case PH_ROM_CMD:
+            if (v == 0x55) { phase_ = PH_MATCH_ROM; matchLen_ = 0; }
+            else if (v == 0xCC) { selected_ = -1; anySelected_ = true; phase_ = PH_FUNC_CMD; }
+            else if (v == 0x33) { phase_ = PH_READ_ROM; dataIndex_ = 0; }
+            else phase_ = PH_IDLE;
+            break;
+
+        case PH_MATCH_ROM:
+            matchBuf_[matchLen_++] = v;
+            if (matchLen_ == 8) {
+                selected_ = -2;
+                anySelected_ = false;
+                for (size_t i = 0; i < bus.devices.size(); i++) {
+                    if (bus.devices[i]->connected && memcmp(bus.devices[i]->rom, matchBuf_, 8) == 0) {
+                        selected_ = (int)i;
+                        anySelected_ = true;
+                        break;
+                    }
+                }
+                phase_ = PH_FUNC_CMD;
+            }
+            break;
+
+        case PH_FUNC_CMD:
+            if (!anySelected_) { phase_ = PH_IDLE; break; }
+            if (v == 0x44) {
+                for (size_t i = 0; i < bus.devices.size(); i++) {
+                    if (selected_ == -1 || selected_ == (int)i) {
+                        if (bus.devices[i]->connected) bus.devices[i]->startConversion(sim::nowUs());
+                    }
+                }
+                phase_ = PH_CONVERTING;
+            } else if (v == 0xBE) {
+                settleConversions();
+                phase_ = PH_READ_SCRATCH;
+                dataIndex_ = 0;
+            } else if (v == 0x4E) {
+                phase_ = PH_WRITE_SCRATCH;
+                dataIndex_ = 0;
+            } else if (v == 0xB4) {
+                phase_ = PH_READ_POWER;
+            } else {
+                // 0x48 (copy), 0xB8 (recall) — для модели достаточно игнорировать
+                phase_ = PH_IDLE;
+            }
+            break;
+
+        case PH_WRITE_SCRATCH:
+            for (size_t i = 0; i < bus.devices.size(); i++) {
+                if (selected_ == -1 || selected_ == (int)i) {
+                    sim::Ds18b20* d = bus.devices[i];
+                    d->scratchpad[2 + dataIndex_] = (dataIndex_ == 2) ? (uint8_t)((v & 0x60) | 0x1F) : v;
+                    d->updateCrc();
+                }
+            }
+            if (++dataIndex_ >= 3) phase_ = PH_IDLE;
+            break;
+
+        default:
+            break;
+    }
+}
+
+uint8_t OneWire::read() {
+    slots(8);
+    sim::OneWireBus& bus = sim::owBus(pin_);
+    uint8_t result = 0xFF;
+    switch (phase_) {
+        case PH_READ_SCRATCH:
+            // Несколько устройств отвечают одновременно — "монтажное И"
+            for (size_t i = 0; i < bus.devices.size(); i++) {
+                if ((selected_ == -1 || selected_ == (int)i) && bus.devices[i]->connected && dataIndex_ < 9) {
+                    result &= bus.devices[i]->scratchpad[dataIndex_];
+                }
+            }
+            dataIndex_++;
+            break;
+        case PH_READ_ROM:
+            for (sim::Ds18b20* d : bus.devices) {
+                if (d->connected && dataIndex_ < 8) result &= d->rom[dataIndex_];
+            }
+            dataIndex_++;
+            break;
+        case PH_CONVERTING:
+            settleConversions();
+            for (size_t i = 0; i < bus.devices.size(); i++) {
+                if ((selected_ == -1 || selected_ == (int)i) && bus.devices[i]->converting) result = 0x00;
+            }
+            break;
+        default:
+            break;
+    }
+    return result;
+}
+
+void OneWire::read_bytes(uint8_t* buf, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) buf[i] = read();
+}
+
+void OneWire::write_bit(uint8_t v) {
+    slots(1);
+    bitAccum_ |= (uint8_t)((v & 1) << bitCount_);
+    if (++bitCount_ == 8) {
+        uint8_t b = bitAccum_;
+        bitAccum_ = 0;
+        bitCount_ = 0;
+        handleByte(b);
+    }
+}
+
+uint8_t OneWire::read_bit() {
+    slots(1);
+    if (phase_ == PH_CONVERTING) {
+        settleConversions();
+        sim::OneWireBus& bus = sim::owBus(pin_);
+        for (size_t i = 0; i < bus.devices.size(); i++) {
+            if ((selected_ == -1 || selected_ == (int)i) && bus.devices[i]->converting) return 0;
+        }
+    }
+    return 1;
+}
+
+// --- Поиск ROM (алгоритм Maxim AN187 поверх модели "монтажного И") ---
+
+void OneWire::reset_search() {
+    lastDiscrepancy_ = 0;
+    lastFamilyDiscrepancy_ = 0;
+    lastDeviceFlag_ = false;
+    memset(romNo_, 0, sizeof(romNo_));
+}
+
+void OneWire::target_search(uint8_t family_code) {
+    memset(romNo_, 0, sizeof(romNo_));
+    romNo_[0] = family_code;
+    lastDiscrepancy_ = 64;
+    lastFamilyDiscrepancy_ = 0;
+    lastDeviceFlag_ = false;
+}
+
+bool OneWire::search(uint8_t* newAddr, bool search_mode) {
+    (void)search_mode;
+    if (lastDeviceFlag_) return false;
+    if (!reset()) {
+        reset_search();
+        return false;
+    }
+    slots(8); // Команда SEARCH ROM (0xF0)
+    phase_ = PH_IDLE;
+
+    sim::OneWireBus& bus = sim::owBus(pin_);
+    std::vector<sim::Ds18b20*> participants;
+    for (sim::Ds18b20* d : bus.devices) {
+        if (d->connected) participants.push_back(d);
+    }
+
+    int lastZero = 0;
+    for (int idBitNumber = 1; idBitNumber <= 64; idBitNumber++) {
+        int byteIdx = (idBitNumber - 1) / 8;
+        uint8_t mask = (uint8_t)(1 << ((idBitNumber - 1) % 8));
+
+        int idBit = 1, cmpIdBit = 1;
+        for (sim::Ds18b20* d : participants) {
+            if (d->rom[byteIdx] & mask) cmpIdBit = 0; else idBit = 0;
+        }
+        slots(3); // Два слота чтения (бит и дополнение) + слот записи направления
+
+        if (idBit == 1 && cmpIdBit == 1) {
+            reset_search();
+            return false;
+        }
+
+        int dir;
+        if (idBit != cmpIdBit) {
+            dir = idBit;
+        } else {
+            if (idBitNumber < lastDiscrepancy_) dir = (romNo_[byteIdx] & mask) ? 1 : 0;
+            else dir = (idBitNumber == lastDiscrepancy_) ? 1 : 0;
+            if (dir == 0) {
+                lastZero = idBitNumber;
+                if (lastZero < 9) lastFamilyDiscrepancy_ = lastZero;
+            }
+        }
+        if (dir) romNo_[byteIdx] |= mask; else romNo_[byteIdx] &= (uint8_t)~mask;
+
+        std::vector<sim::Ds18b20*> next;
+        for (sim::Ds18b20* d : participants) {
+            if (((d->rom[byteIdx] & mask) ? 1 : 0) == dir) next.push_back(d);
+        }
+        participants.swap(next);
+    }
+
+    lastDiscrepancy_ = lastZero;
+    if (lastDiscrepancy_ == 0) lastDeviceFlag_ = true;
+    memcpy(newAddr, romNo_, 8);
+    return true;
+}
+
+uint8_t OneWire::crc8(const uint8_t* addr, uint8_t len) {
+    return sim::owCrc8(addr, len);
+}
+
+uint16_t OneWire::crc16(const uint8_t* input, uint16_t len, uint16_t crc) {
+    static const uint8_t oddparity[16] = {0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0};
+    for (uint16_t i = 0; i < len; i++) {
+        uint16_t cdata = input[i];
+        cdata = (cdata ^ crc) & 0xff;
+        crc >>= 8;
+        if (oddparity[cdata & 0x0F] ^ oddparity[cdata >> 4]) crc ^= 0xC001;
+        cdata <<= 6;
+        crc ^= cdata;
+        cdata <<= 1;
+        crc ^= cdata;
+    }
+    return crc;
+}
+
+bool OneWire::check_crc16(const uint8_t* input, uint16_t len, const uint8_t* inverted_crc, uint16_t crc) {
+    crc = ~crc16(input, len, crc);
+    return (crc & 0xFF) == inverted_crc[0] && (crc >> 8) == inverted_crc[1];
+}
@@ -0,0 +1,62 @@
+// =================================================================================
+// File:         lib/native_hal/src/OneWire.h
+// Description:  OneWire (API библиотеки P. Stoffregen) для [env:native].
+//               Команды ROM/функций исполняются эмулированными DS18B20,
+//               каждый сброс и тайм-слот стоят виртуального времени.
+// =================================================================================
+
+#ifndef NATIVE_HAL_ONEWIRE_H
+#define NATIVE_HAL_ONEWIRE_H
+
+#include "Arduino.h"
+
+class OneWire {
+public:
+    OneWire() {}
+    explicit OneWire(uint8_t pin) { begin(pin); }
+    void begin(uint8_t pin);
+
+    uint8_t reset();
+    void select(const uint8_t rom[8]);
+    void skip();
+    void write(uint8_t v, uint8_t power = 0);
+    void write_bytes(const uint8_t* buf, uint16_t count, bool power = 0);
+    uint8_t read();
+    void read_bytes(uint8_t* buf, uint16_t count);
+    void write_bit(uint8_t v);
+    uint8_t read_bit();
+    void depower() {}
+
+    void reset_search();
+    void target_search(uint8_t family_code);
+    bool search(uint8_t* newAddr, bool search_mode = true);
+
+    static uint8_t crc8(const uint8_t* addr, uint8_t len);
+    static uint16_t crc16(const uint8_t* input, uint16_t len, uint16_t crc = 0);
+    static bool check_crc16(const uint8_t* input, uint16_t len, const uint8_t* inverted_crc, uint16_t crc = 0);
+
+private:
+    enum Phase : uint8_t { PH_IDLE, PH_ROM_CMD, PH_MATCH_ROM, PH_FUNC_CMD, PH_WRITE_SCRATCH, PH_READ_SCRATCH, PH_READ_ROM, PH_CONVERTING, PH_READ_POWER };
+
+    void slots(uint32_t n);
+    void settleConversions();
+    void handleByte(uint8_t v);
+
+    uint8_t pin_ = 0;
+    Phase phase_ = PH_IDLE;
+    uint8_t matchBuf_[8];
+    uint8_t matchLen_ = 0;
+    uint8_t dataIndex_ = 0;
+    int selected_ = -1;          // -1: SKIP ROM (все устройства), иначе индекс
+    bool anySelected_ = false;
+    uint8_t bitAccum_ = 0;
+    uint8_t bitCount_ = 0;
+
+    // Состояние алгоритма поиска ROM
+    uint8_t romNo_[8];
+    int lastDiscrepancy_ = 0;
+    int lastFamilyDiscrepancy_ = 0;
+    bool lastDeviceFlag_ = false;
+};
+
+#endif // NATIVE_HAL_ONEWIRE_H
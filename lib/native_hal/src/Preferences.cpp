@@ -0,0 +1,145 @@
+// =================================================================================
+// File:         lib/native_hal/src/Preferences.cpp
+// Description:  Хранилище NVS в ОЗУ для [env:native].
+// =================================================================================
+
+#include "Preferences.h"
+#include "sim_clock.h"
+
+#include <map>
+#include <vector>
+
+namespace {
+
+struct NvsValue {
+    char type;
+    std::vector<uint8_t> data;
+};
+
+typedef std::map<std::string, NvsValue> NvsNamespace;
+
+std::map<std::string, NvsNamespace>& storage() {
+    static std::map<std::string, NvsNamespace> s;
+    return s;
+}
+
+const size_t NVS_KEY_NAME_MAX = 15;
+
+} // namespace
+
+namespace sim {
+NvsStats& nvsStats() {
+    static NvsStats s;
+    return s;
+}
+}
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partition_label) {
+    (void)partition_label;
+    if (started_) return false;
+    if (!name || strlen(name) > NVS_KEY_NAME_MAX) return false;
+    sim::nvsStats().opens++;
+    sim::advanceUs(sim::cost().nvsOpenUs);
+    ns_ = name;
+    readOnly_ = readOnly;
+    started_ = true;
+    if (!readOnly) storage()[ns_];
+    return true;
+}
+
+void Preferences::end() {
+    if (!started_) return;
+    started_ = false;
+}
+
+bool Preferences::clear() {
+    if (!started_ || readOnly_) return false;
+    sim::advanceUs(sim::cost().nvsWriteUs);
+    storage()[ns_].clear();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!started_ || readOnly_ || !key) return false;
+    sim::nvsStats().writes++;
+    sim::advanceUs(sim::cost().nvsWriteUs);
+    return storage()[ns_].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!started_ || !key) return false;
+    sim::nvsStats().reads++;
+    sim::advanceUs(sim::cost().nvsReadUs);
+    auto ns = storage().find(ns_);
+    return ns != storage().end() && ns->second.count(key) > 0;
+}
+
+size_t Preferences::putRaw(const char* key, char type, const void* data, size_t len) {
+    if (!started_ || readOnly_ || !key || strlen(key) > NVS_KEY_NAME_MAX) return 0;
+    sim::nvsStats().writes++;
+    sim::advanceUs(sim::cost().nvsWriteUs);
+    NvsValue& v = storage()[ns_][key];
+    v.type = type;
+    v.data.assign((const uint8_t*)data, (const uint8_t*)data + len);
+    return len;
+}
+
+bool Preferences::getRaw(const char* key, char type, void* out, size_t len) {
+    if (!started_ || !key) return false;
+    sim::nvsStats().reads++;
+    sim::advanceUs(sim::cost().nvsReadUs);
+    auto ns = storage().find(ns_);
+    if (ns == storage().end()) return false;
+    auto it = ns->second.find(key);
+    if (it == ns->second.end() || it->second.type != type || it->second.data.size() != len) return false;
+    memcpy(out, it->second.data.data(), len);
+    return true;
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+    if (!value) return 0;
+    size_t n = putRaw(key, 'z', value, strlen(value) + 1);
+    return n ? n - 1 : 0;
+}
+
+String Preferences::getString(const char* key, String defaultValue) {
+    if (!started_ || !key) return defaultValue;
+    sim::nvsStats().reads++;
+    sim::advanceUs(sim::cost().nvsReadUs);
+    auto ns = storage().find(ns_);
+    if (ns == storage().end()) return defaultValue;
+    auto it = ns->second.find(key);
+    if (it == ns->second.end() || it->second.type != 'z') return defaultValue;
+    return String((const char*)it->second.data.data());
+}
+
+size_t Preferences::getString(const char* key, char* value, size_t maxLen) {
+    String s = getString(key, String());
+    if (!value || maxLen == 0) return s.length() + 1;
+    size_t n = std::min((size_t)s.length(), maxLen - 1);
+    memcpy(value, s.c_str(), n);
+    value[n] = '\0';
+    return n + 1;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!started_ || !key) return 0;
+    sim::nvsStats().reads++;
+    sim::advanceUs(sim::cost().nvsReadUs);
+    auto ns = storage().find(ns_);
+    if (ns == storage().end()) return 0;
+    auto it = ns->second.find(key);
+    return (it == ns->second.end() || it->second.type != 'b') ? 0 : it->second.data.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    if (!started_ || !key || !buf) return 0;
+    sim::nvsStats().reads++;
+    sim::advanceUs(sim::cost().nvsReadUs);
+    auto ns = storage().find(ns_);
+    if (ns == storage().end()) return 0;
+    auto it = ns->second.find(key);
+    if (it == ns->second.end() || it->second.type != 'b' || it->second.data.size() > maxLen) return 0;
+    memcpy(buf, it->second.data.data(), it->second.data.size());
+    return it->second.data.size();
+}
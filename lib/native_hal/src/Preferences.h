@@ -0,0 +1,76 @@
+// =================================================================================
+// File:         lib/native_hal/src/Preferences.h
+// Description:  Preferences (NVS) для [env:native]: пространства имён в ОЗУ
+//               с ограничениями настоящего NVS (ключ <= 15 символов,
+//               типизированные значения) и стоимостью flash-операций.
+// =================================================================================
+
+#ifndef NATIVE_HAL_PREFERENCES_H
+#define NATIVE_HAL_PREFERENCES_H
+
+#include "Arduino.h"
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partition_label = NULL);
+    void end();
+
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+    size_t freeEntries() { return 500; }
+
+    size_t putChar(const char* key, int8_t value) { return putRaw(key, 'c', &value, sizeof(value)); }
+    size_t putUChar(const char* key, uint8_t value) { return putRaw(key, 'C', &value, sizeof(value)); }
+    size_t putShort(const char* key, int16_t value) { return putRaw(key, 's', &value, sizeof(value)); }
+    size_t putUShort(const char* key, uint16_t value) { return putRaw(key, 'S', &value, sizeof(value)); }
+    size_t putInt(const char* key, int32_t value) { return putRaw(key, 'i', &value, sizeof(value)); }
+    size_t putUInt(const char* key, uint32_t value) { return putRaw(key, 'I', &value, sizeof(value)); }
+    size_t putLong(const char* key, int32_t value) { return putRaw(key, 'i', &value, sizeof(value)); }
+    size_t putULong(const char* key, uint32_t value) { return putRaw(key, 'I', &value, sizeof(value)); }
+    size_t putLong64(const char* key, int64_t value) { return putRaw(key, 'l', &value, sizeof(value)); }
+    size_t putULong64(const char* key, uint64_t value) { return putRaw(key, 'L', &value, sizeof(value)); }
+    size_t putFloat(const char* key, float value) { return putRaw(key, 'b', &value, sizeof(value)); }
+    size_t putDouble(const char* key, double value) { return putRaw(key, 'b', &value, sizeof(value)); }
+    size_t putBool(const char* key, bool value) { uint8_t v = value ? 1 : 0; return putRaw(key, 'C', &v, 1); }
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+    size_t putBytes(const char* key, const void* value, size_t len) { return putRaw(key, 'b', value, len); }
+
+    int8_t getChar(const char* key, int8_t defaultValue = 0) { getRaw(key, 'c', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) { getRaw(key, 'C', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    int16_t getShort(const char* key, int16_t defaultValue = 0) { getRaw(key, 's', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    uint16_t getUShort(const char* key, uint16_t defaultValue = 0) { getRaw(key, 'S', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { getRaw(key, 'i', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { getRaw(key, 'I', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    int32_t getLong(const char* key, int32_t defaultValue = 0) { return getInt(key, defaultValue); }
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0) { return getUInt(key, defaultValue); }
+    int64_t getLong64(const char* key, int64_t defaultValue = 0) { getRaw(key, 'l', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    uint64_t getULong64(const char* key, uint64_t defaultValue = 0) { getRaw(key, 'L', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    float getFloat(const char* key, float defaultValue = NAN) { getRaw(key, 'b', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    double getDouble(const char* key, double defaultValue = NAN) { getRaw(key, 'b', &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    bool getBool(const char* key, bool defaultValue = false) { return getUChar(key, defaultValue ? 1 : 0) == 1; }
+    String getString(const char* key, String defaultValue = String());
+    size_t getString(const char* key, char* value, size_t maxLen);
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buf, size_t maxLen);
+
+private:
+    size_t putRaw(const char* key, char type, const void* data, size_t len);
+    bool getRaw(const char* key, char type, void* out, size_t len);
+
+    bool started_ = false;
+    bool readOnly_ = false;
+    std::string ns_;
+};
+
+namespace sim {
+struct NvsStats {
+    uint32_t opens = 0;
+    uint32_t reads = 0;
+    uint32_t writes = 0;
+};
+NvsStats& nvsStats();
+}
+
+#endif // NATIVE_HAL_PREFERENCES_H
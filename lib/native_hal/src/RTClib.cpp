@@ -0,0 +1,117 @@
+// =================================================================================
+// File:         lib/native_hal/src/RTClib.cpp
+// Description:  Реализация DateTime и RTC_DS3231 для [env:native].
+// =================================================================================
+
+#include "RTClib.h"
+
+static const uint8_t DS3231_ADDRESS = 0x68;
+static const uint8_t DS3231_TIME = 0x00;
+static const uint8_t DS3231_STATUSREG = 0x0F;
+static const uint8_t DS3231_TEMPERATUREREG = 0x11;
+
+static const uint8_t daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+static uint8_t bcd2bin(uint8_t val) { return val - 6 * (val >> 4); }
+static uint8_t bin2bcd(uint8_t val) { return val + 6 * (val / 10); }
+
+static uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
+    if (y >= 2000) y -= 2000;
+    uint16_t days = d;
+    for (uint8_t i = 1; i < m; ++i) days += daysInMonth[i - 1];
+    if (m > 2 && y % 4 == 0) ++days;
+    return days + 365 * y + (y + 3) / 4 - 1;
+}
+
+DateTime::DateTime(uint32_t t) {
+    t -= 946684800u;
+    ss_ = t % 60; t /= 60;
+    mm_ = t % 60; t /= 60;
+    hh_ = t % 24;
+    uint16_t days = (uint16_t)(t / 24);
+    uint8_t leap;
+    for (yOff_ = 0;; ++yOff_) {
+        leap = yOff_ % 4 == 0;
+        if (days < 365U + leap) break;
+        days -= 365 + leap;
+    }
+    for (m_ = 1; m_ < 12; ++m_) {
+        uint8_t dim = daysInMonth[m_ - 1];
+        if (leap && m_ == 2) ++dim;
+        if (days < dim) break;
+        days -= dim;
+    }
+    d_ = (uint8_t)(days + 1);
+}
+
+DateTime::DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t min, uint8_t sec) {
+    if (year >= 2000) year -= 2000;
+    yOff_ = (uint8_t)year;
+    m_ = month; d_ = day; hh_ = hour; mm_ = min; ss_ = sec;
+}
+
+uint8_t DateTime::dayOfTheWeek() const {
+    uint16_t day = date2days(yOff_, m_, d_);
+    return (day + 6) % 7; // 2000-01-01 — суббота
+}
+
+uint32_t DateTime::unixtime() const {
+    uint32_t days = date2days(yOff_, m_, d_);
+    return ((days * 24UL + hh_) * 60 + mm_) * 60 + ss_ + 946684800u;
+}
+
+static bool readRegisters(TwoWire* w, uint8_t reg, uint8_t* buf, uint8_t n) {
+    w->beginTransmission(DS3231_ADDRESS);
+    w->write(reg);
+    if (w->endTransmission() != 0) return false;
+    if (w->requestFrom((uint16_t)DS3231_ADDRESS, n) != n) return false;
+    for (uint8_t i = 0; i < n; i++) buf[i] = (uint8_t)w->read();
+    return true;
+}
+
+bool RTC_DS3231::begin(TwoWire* wireInstance) {
+    wire_ = wireInstance;
+    wire_->beginTransmission(DS3231_ADDRESS);
+    return wire_->endTransmission() == 0;
+}
+
+void RTC_DS3231::adjust(const DateTime& dt) {
+    uint8_t buffer[8] = {DS3231_TIME,
+                         bin2bcd(dt.second()),
+                         bin2bcd(dt.minute()),
+                         bin2bcd(dt.hour()),
+                         bin2bcd((uint8_t)(dt.dayOfTheWeek() ? dt.dayOfTheWeek() : 7)),
+                         bin2bcd(dt.day()),
+                         bin2bcd(dt.month()),
+                         bin2bcd((uint8_t)(dt.year() - 2000U))};
+    wire_->beginTransmission(DS3231_ADDRESS);
+    wire_->write(buffer, 8);
+    wire_->endTransmission();
+
+    uint8_t status = 0;
+    if (readRegisters(wire_, DS3231_STATUSREG, &status, 1)) {
+        wire_->beginTransmission(DS3231_ADDRESS);
+        wire_->write(DS3231_STATUSREG);
+        wire_->write((uint8_t)(status & ~0x80));
+        wire_->endTransmission();
+    }
+}
+
+bool RTC_DS3231::lostPower() {
+    uint8_t status = 0;
+    if (!readRegisters(wire_, DS3231_STATUSREG, &status, 1)) return true;
+    return (status >> 7) & 1;
+}
+
+DateTime RTC_DS3231::now() {
+    uint8_t buffer[7];
+    if (!readRegisters(wire_, DS3231_TIME, buffer, 7)) return DateTime((uint32_t)946684800u);
+    return DateTime((uint16_t)(bcd2bin(buffer[6]) + 2000U), bcd2bin(buffer[5] & 0x7F), bcd2bin(buffer[4]),
+                    bcd2bin(buffer[2]), bcd2bin(buffer[1]), bcd2bin(buffer[0] & 0x7F));
+}
+
+float RTC_DS3231::getTemperature() {
+    uint8_t buffer[2];
+    if (!readRegisters(wire_, DS3231_TEMPERATUREREG, buffer, 2)) return NAN;
+    return (float)(int8_t)buffer[0] + (buffer[1] >> 6) * 0.25f;
+}
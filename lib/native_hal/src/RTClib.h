@@ -0,0 +1,59 @@
+// =================================================================================
+// File:         lib/native_hal/src/RTClib.h
+// Description:  Подмножество Adafruit RTClib для [env:native]: DateTime и
+//               RTC_DS3231, который читает регистры эмулированного DS3231
+//               через Wire (адрес 0x68), как настоящая библиотека.
+// =================================================================================
+
+#ifndef NATIVE_HAL_RTCLIB_H
+#define NATIVE_HAL_RTCLIB_H
+
+#include "Arduino.h"
+#include "Wire.h"
+
+class TimeSpan {
+public:
+    TimeSpan(int32_t seconds = 0) : seconds_(seconds) {}
+    TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds)
+        : seconds_((int32_t)days * 86400L + (int32_t)hours * 3600 + (int32_t)minutes * 60 + seconds) {}
+    int32_t totalseconds() const { return seconds_; }
+private:
+    int32_t seconds_;
+};
+
+class DateTime {
+public:
+    DateTime(uint32_t t = 946684800u); // 2000-01-01 00:00:00
+    DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0, uint8_t sec = 0);
+
+    uint16_t year() const { return (uint16_t)(2000 + yOff_); }
+    uint8_t month() const { return m_; }
+    uint8_t day() const { return d_; }
+    uint8_t hour() const { return hh_; }
+    uint8_t minute() const { return mm_; }
+    uint8_t second() const { return ss_; }
+    uint8_t dayOfTheWeek() const; // 0 = воскресенье
+    uint32_t unixtime() const;
+    uint32_t secondstime() const { return unixtime() - 946684800u; }
+
+    DateTime operator+(const TimeSpan& span) const { return DateTime(unixtime() + span.totalseconds()); }
+    DateTime operator-(const TimeSpan& span) const { return DateTime(unixtime() - span.totalseconds()); }
+    bool operator==(const DateTime& o) const { return unixtime() == o.unixtime(); }
+    bool operator<(const DateTime& o) const { return unixtime() < o.unixtime(); }
+
+private:
+    uint8_t yOff_, m_, d_, hh_, mm_, ss_;
+};
+
+class RTC_DS3231 {
+public:
+    bool begin(TwoWire* wireInstance = &Wire);
+    void adjust(const DateTime& dt);
+    bool lostPower();
+    DateTime now();
+    float getTemperature();
+private:
+    TwoWire* wire_ = &Wire;
+};
+
+#endif // NATIVE_HAL_RTCLIB_H
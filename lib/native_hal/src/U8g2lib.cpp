@@ -0,0 +1,157 @@
+// =================================================================================
+// File:         lib/native_hal/src/U8g2lib.cpp
+// Description:  Реализация подмножества U8g2 для [env:native].
+// =================================================================================
+
+#include "U8g2lib.h"
+#include "Wire.h"
+
+const uint8_t u8g2_font_6x10_tf[] = {6, 10};
+const uint8_t u8g2_font_5x7_tf[] = {5, 7};
+const uint8_t u8g2_font_ncenB10_tr[] = {9, 13};
+
+// Размер порции данных в одной I2C-транзакции (как в u8x8_cad_ssd13xx_fast_i2c)
+static const size_t U8G2_I2C_CHUNK = 32;
+
+uint8_t u8x8_byte_arduino_hw_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    switch (msg) {
+        case U8X8_MSG_BYTE_SEND:
+            Wire.write((const uint8_t*)arg_ptr, arg_int);
+            break;
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            // U8x8 HW I2C выставляет свою частоту шины перед каждой передачей
+            Wire.setClock(u8x8->bus_clock);
+            Wire.beginTransmission((uint8_t)(u8x8->i2c_address >> 1));
+            break;
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            Wire.endTransmission();
+            break;
+        default:
+            break;
+    }
+    return 1;
+}
+
+U8G2::U8G2(uint8_t i2cAddress) {
+    memset(buffer_, 0, sizeof(buffer_));
+    u8x8_.byte_cb = u8x8_byte_arduino_hw_i2c;
+    u8x8_.i2c_address = (uint8_t)(i2cAddress << 1);
+    u8x8_.bus_clock = 400000;
+}
+
+// Одна I2C-транзакция: control byte (0x00 - команды, 0x40 - данные) + байты
+void U8G2::transfer(uint8_t dc, const uint8_t* data, size_t n) {
+    u8x8_.byte_cb(&u8x8_, U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    u8x8_.byte_cb(&u8x8_, U8X8_MSG_BYTE_SEND, 1, &dc);
+    u8x8_.byte_cb(&u8x8_, U8X8_MSG_BYTE_SEND, (uint8_t)n, (void*)data);
+    u8x8_.byte_cb(&u8x8_, U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+}
+
+void U8G2::sendCommands(const uint8_t* cmds, size_t n) {
+    transfer(0x00, cmds, n);
+}
+
+bool U8G2::begin() {
+    static const uint8_t initSeq[] = {
+        0xAE, 0xD5, 0xA0, 0xA8, 0x3F, 0xD3, 0x00, 0x40, 0xA1, 0xC8,
+        0xDA, 0x12, 0x81, 0x6F, 0xD9, 0xD3, 0xDB, 0x20, 0xA4, 0xA6,
+        0x20, 0x00
+    };
+    sendCommands(initSeq, sizeof(initSeq));
+    clearDisplay();
+    setPowerSave(0);
+    return true;
+}
+
+void U8G2::clearBuffer() {
+    memset(buffer_, 0, sizeof(buffer_));
+    frameText_.clear();
+}
+
+void U8G2::clearDisplay() {
+    clearBuffer();
+    sendBuffer();
+}
+
+void U8G2::setPowerSave(uint8_t is_enable) {
+    uint8_t cmd = is_enable ? 0xAE : 0xAF;
+    sendCommands(&cmd, 1);
+}
+
+void U8G2::setContrast(uint8_t value) {
+    uint8_t cmds[2] = {0x81, value};
+    sendCommands(cmds, 2);
+}
+
+void U8G2::sendBuffer() {
+    for (uint8_t page = 0; page < 8; page++) {
+        const uint8_t addr[] = {0x21, 0x00, 0x7F, 0x22, page, 0x07};
+        sendCommands(addr, sizeof(addr));
+        for (size_t off = 0; off < 128; off += U8G2_I2C_CHUNK) {
+            transfer(0x40, buffer_ + page * 128 + off, U8G2_I2C_CHUNK);
+        }
+    }
+    sentText_ = frameText_;
+}
+
+void U8G2::firstPage() { clearBuffer(); }
+
+uint8_t U8G2::nextPage() {
+    sendBuffer();
+    return 0;
+}
+
+uint16_t U8G2::getStrWidth(const char* s) const {
+    uint8_t w = font_ ? font_[0] : 6;
+    return (uint16_t)(s ? strlen(s) * w : 0);
+}
+
+uint16_t U8G2::drawStr(int16_t x, int16_t y, const char* s) {
+    if (!s) return 0;
+    uint8_t w = font_ ? font_[0] : 6;
+    uint8_t h = font_ ? font_[1] : 10;
+    // Вместо растеризации шрифта — детерминированный "отпечаток" глифа,
+    // этого достаточно, чтобы содержимое буфера менялось вместе с текстом.
+    int16_t top = (int16_t)(y - h + 1);
+    for (const char* p = s; *p; ++p) {
+        for (uint8_t c = 0; c < w - 1; c++) {
+            int16_t px = (int16_t)(x + (p - s) * w + c);
+            uint8_t bits = (uint8_t)((uint8_t)*p * 31u + c * 7u);
+            for (uint8_t r = 0; r < h && r < 8; r++) {
+                if (bits & (1u << r)) drawPixel(px, (int16_t)(top + r));
+            }
+        }
+    }
+    char line[160];
+    snprintf(line, sizeof(line), "%3d,%2d | %s\n", x, y, s);
+    frameText_ += line;
+    return (uint16_t)(strlen(s) * w);
+}
+
+void U8G2::drawPixel(int16_t x, int16_t y) {
+    if (x < 0 || x >= 128 || y < 0 || y >= 64) return;
+    uint8_t& b = buffer_[(y / 8) * 128 + x];
+    uint8_t m = (uint8_t)(1u << (y % 8));
+    if (drawColor_ == 0) b &= (uint8_t)~m;
+    else if (drawColor_ == 2) b ^= m;
+    else b |= m;
+}
+
+void U8G2::drawHLine(int16_t x, int16_t y, int16_t w) {
+    for (int16_t i = 0; i < w; i++) drawPixel((int16_t)(x + i), y);
+}
+
+void U8G2::drawVLine(int16_t x, int16_t y, int16_t h) {
+    for (int16_t i = 0; i < h; i++) drawPixel(x, (int16_t)(y + i));
+}
+
+void U8G2::drawBox(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int16_t i = 0; i < h; i++) drawHLine(x, (int16_t)(y + i), w);
+}
+
+void U8G2::drawFrame(int16_t x, int16_t y, int16_t w, int16_t h) {
+    drawHLine(x, y, w);
+    drawHLine(x, (int16_t)(y + h - 1), w);
+    drawVLine(x, y, h);
+    drawVLine((int16_t)(x + w - 1), y, h);
+}
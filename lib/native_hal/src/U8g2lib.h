@@ -0,0 +1,96 @@
+// =================================================================================
+// File:         lib/native_hal/src/U8g2lib.h
+// Description:  Подмножество U8g2 для [env:native]: полный буфер 128x64 и
+//               передача кадра в эмулированный SSD1309 по Wire тем же
+//               порядком транзакций, что у U8g2 HW I2C. Текст кадра
+//               доступен симулятору для вывода "снимка" экрана.
+// =================================================================================
+
+#ifndef NATIVE_HAL_U8G2LIB_H
+#define NATIVE_HAL_U8G2LIB_H
+
+#include "Arduino.h"
+#include <vector>
+
+#define U8X8_PIN_NONE 255
+
+// Байтовый уровень u8x8: U8g2 передаёт всё через byte_cb, его можно подменить
+typedef struct u8x8_struct u8x8_t;
+typedef uint8_t (*u8x8_msg_cb)(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+struct u8x8_struct {
+    u8x8_msg_cb byte_cb;
+    uint8_t i2c_address;    // 8-битный (адрес << 1), как в u8x8
+    uint32_t bus_clock;
+};
+#define U8X8_MSG_BYTE_INIT 20
+#define U8X8_MSG_BYTE_SEND 23
+#define U8X8_MSG_BYTE_START_TRANSFER 24
+#define U8X8_MSG_BYTE_END_TRANSFER 25
+#define U8X8_MSG_BYTE_SET_DC 32
+uint8_t u8x8_byte_arduino_hw_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr);
+
+typedef const uint8_t* u8g2_cb_t;
+#define U8G2_R0 ((u8g2_cb_t)0)
+#define U8G2_R2 ((u8g2_cb_t)2)
+
+// Шрифты: [ширина глифа, высота глифа]
+extern const uint8_t u8g2_font_6x10_tf[];
+extern const uint8_t u8g2_font_5x7_tf[];
+extern const uint8_t u8g2_font_ncenB10_tr[];
+
+class U8G2 {
+public:
+    U8G2(uint8_t i2cAddress);
+
+    bool begin();
+    void clearBuffer();
+    void sendBuffer();
+    void firstPage();
+    uint8_t nextPage();
+    void clearDisplay();
+    void setPowerSave(uint8_t is_enable);
+    void setContrast(uint8_t value);
+    void setBusClock(uint32_t clock_speed) { u8x8_.bus_clock = clock_speed; }
+    void setI2CAddress(uint8_t adr) { u8x8_.i2c_address = adr; }
+    u8x8_t* getU8x8() { return &u8x8_; }
+
+    void setFont(const uint8_t* font) { font_ = font; }
+    void setDrawColor(uint8_t color) { drawColor_ = color; }
+    void setFontMode(uint8_t is_transparent) { (void)is_transparent; }
+    uint16_t drawStr(int16_t x, int16_t y, const char* s);
+    uint16_t drawUTF8(int16_t x, int16_t y, const char* s) { return drawStr(x, y, s); }
+    uint16_t getStrWidth(const char* s) const;
+    uint16_t getUTF8Width(const char* s) const { return getStrWidth(s); }
+    int8_t getMaxCharHeight() const { return (int8_t)(font_ ? font_[1] : 8); }
+    void drawPixel(int16_t x, int16_t y);
+    void drawHLine(int16_t x, int16_t y, int16_t w);
+    void drawVLine(int16_t x, int16_t y, int16_t h);
+    void drawBox(int16_t x, int16_t y, int16_t w, int16_t h);
+    void drawFrame(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    uint16_t getDisplayWidth() const { return 128; }
+    uint16_t getDisplayHeight() const { return 64; }
+    uint8_t* getBufferPtr() { return buffer_; }
+
+    // --- Только для симулятора: текст последнего переданного кадра ---
+    std::string simFrameText() const { return sentText_; }
+
+private:
+    void sendCommands(const uint8_t* cmds, size_t n);
+    void transfer(uint8_t dc, const uint8_t* data, size_t n);
+
+    u8x8_t u8x8_;
+    const uint8_t* font_ = nullptr;
+    uint8_t drawColor_ = 1;
+    uint8_t buffer_[128 * 8];
+    std::string frameText_;
+    std::string sentText_;
+};
+
+class U8G2_SSD1309_128X64_NONAME0_F_HW_I2C : public U8G2 {
+public:
+    U8G2_SSD1309_128X64_NONAME0_F_HW_I2C(u8g2_cb_t rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+        : U8G2(0x3C) { (void)rotation; (void)reset; (void)clock; (void)data; }
+};
+
+#endif // NATIVE_HAL_U8G2LIB_H
@@ -0,0 +1,408 @@
+// =================================================================================
+// File:         lib/native_hal/src/WebServer.cpp
+// Description:  Реализация синхронного WebServer для [env:native].
+// =================================================================================
+
+#include "WebServer.h"
+#include "AsyncTCP.h"
+#include "sim_clock.h"
+
+#include <deque>
+#include <strings.h>
+
+namespace sim {
+
+static std::deque<std::shared_ptr<HttpExchange>>& queue() {
+    static std::deque<std::shared_ptr<HttpExchange>> q;
+    return q;
+}
+
+std::shared_ptr<HttpExchange> webEnqueue(const char* method, const char* uri, const char* body,
+                                         const std::vector<std::pair<std::string, std::string>>& headers) {
+    auto ex = std::make_shared<HttpExchange>();
+    ex->method = method ? method : "GET";
+    ex->uri = uri ? uri : "/";
+    ex->body = body ? body : "";
+    ex->requestHeaders = headers;
+    ex->queuedUs = nowUs();
+    queue().push_back(ex);
+    return ex;
+}
+
+std::shared_ptr<HttpExchange> webEnqueueStalled(const char* uri) {
+    auto ex = webEnqueue("GET", uri);
+    ex->stalled = true;
+    return ex;
+}
+
+size_t webPending() { return queue().size(); }
+
+// --- "Браузер" поверх AsyncTCP ---
+
+namespace {
+
+struct BrowserConn {
+    std::shared_ptr<TcpPeer> peer;
+    std::shared_ptr<HttpExchange> ex;   // Текущий запрос; nullptr - соединение свободно
+    size_t consumed = 0;                // Сколько из peer->received уже передано в ex
+    bool stream = false;                // Ответ - text/event-stream
+    bool closeAfter = false;            // Сервер ответил Connection: close
+};
+
+const size_t BROWSER_MAX_CONNS = 6;
+
+std::vector<BrowserConn>& browserConns() {
+    static std::vector<BrowserConn> c;
+    return c;
+}
+
+std::string rawRequest(const HttpExchange& ex) {
+    std::string r = ex.method + " " + ex.uri + " HTTP/1.1\r\n";
+    if (ex.stalled) return r; // Дальше строки запроса клиент не продвинулся
+    r += "Host: 192.168.4.1\r\n";
+    for (auto& h : ex.requestHeaders) r += h.first + ": " + h.second + "\r\n";
+    if (!ex.body.empty()) {
+        r += "Content-Type: application/json\r\nContent-Length: " + std::to_string(ex.body.size()) + "\r\n";
+    }
+    r += "\r\n" + ex.body;
+    return r;
+}
+
+// Разобрать ответ из ex->conn->tx; true - ответ получен (у потока - заголовок).
+// closed - сервер закрыл соединение: тело без длины заканчивается здесь.
+bool parseResponse(BrowserConn& bc, bool closed = false) {
+    HttpExchange& ex = *bc.ex;
+    const std::string& tx = ex.conn->tx;
+    size_t headEnd = tx.find("\r\n\r\n");
+    if (headEnd == std::string::npos) return false;
+    ex.code = atoi(tx.c_str() + 9); // "HTTP/1.1 200"
+    ex.responseHeaders.clear();
+    size_t contentLength = 0;
+    bool lengthKnown = false;
+    bool chunked = false;
+    for (size_t pos = tx.find("\r\n") + 2; pos < headEnd + 2;) {
+        size_t eol = tx.find("\r\n", pos);
+        std::string line = tx.substr(pos, eol - pos);
+        pos = eol + 2;
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+        std::string name = line.substr(0, colon);
+        std::string value = line.substr(line.find_first_not_of(' ', colon + 1));
+        if (strcasecmp(name.c_str(), "Content-Type") == 0) ex.contentType = value;
+        else if (strcasecmp(name.c_str(), "Content-Length") == 0) {
+            contentLength = strtoul(value.c_str(), nullptr, 10);
+            lengthKnown = true;
+        }
+        else if (strcasecmp(name.c_str(), "Connection") == 0) bc.closeAfter = strcasecmp(value.c_str(), "close") == 0;
+        else if (strcasecmp(name.c_str(), "Transfer-Encoding") == 0) chunked = strcasecmp(value.c_str(), "chunked") == 0;
+        else ex.responseHeaders.push_back({name, value});
+    }
+    if (ex.contentType == "text/event-stream") {
+        bc.stream = true;
+        return true;
+    }
+    if (chunked) {
+        // Куски "<hex>\r\n<data>\r\n" до нулевого; ответ готов, когда пришёл весь
+        std::string body;
+        for (size_t pos = headEnd + 4;;) {
+            size_t eol = tx.find("\r\n", pos);
+            if (eol == std::string::npos) return false;
+            size_t n = strtoul(tx.c_str() + pos, nullptr, 16);
+            if (tx.size() < eol + 2 + n + 2) return false;
+            if (n == 0) break;
+            body.append(tx, eol + 2, n);
+            pos = eol + 2 + n + 2;
+        }
+        ex.response = body;
+        return true;
+    }
+    if (!lengthKnown && bc.closeAfter) {
+        if (!closed) return false; // Тело до закрытия соединения
+        contentLength = tx.size() - headEnd - 4;
+    }
+    if (tx.size() < headEnd + 4 + contentLength) return false;
+    ex.response = tx.substr(headEnd + 4, contentLength);
+    return true;
+}
+
+} // namespace
+
+void webPump() {
+    tcpPoll();
+    auto& conns = browserConns();
+
+    for (size_t i = 0; i < conns.size();) {
+        BrowserConn& bc = conns[i];
+        TcpPeer& peer = *bc.peer;
+        if (bc.ex && peer.received.size() > bc.consumed) {
+            bc.ex->conn->tx.append(peer.received, bc.consumed, std::string::npos);
+            bc.ex->conn->writes++;
+        }
+        bc.consumed = peer.received.size();
+
+        if (bc.ex && !bc.ex->done && parseResponse(bc)) {
+            bc.ex->done = true;
+            bc.ex->completedUs = nowUs();
+            if (!bc.stream) {
+                bc.ex->conn->open = false;
+                bc.ex.reset();
+            }
+        }
+        // Поток закрыл сам "браузер" (симулятор сбросил conn->open)
+        if (bc.stream && bc.ex && !bc.ex->conn->open) peer.close();
+
+        if (!peer.open && peer.inFlight.empty()) {
+            if (bc.ex) {
+                bc.ex->conn->open = false;
+                if (!bc.ex->done) {
+                    if (!parseResponse(bc, true)) bc.ex->code = 0; // Закрыто без ответа
+                    bc.ex->done = true;
+                    bc.ex->completedUs = nowUs();
+                }
+            }
+            conns[i] = conns.back();
+            conns.pop_back();
+            continue;
+        }
+        i++;
+    }
+
+    while (!queue().empty() && tcpListening(80)) {
+        BrowserConn* idle = nullptr;
+        for (BrowserConn& bc : conns) {
+            if (!bc.ex && bc.peer->open && !bc.closeAfter) { idle = &bc; break; }
+        }
+        if (!idle) {
+            if (conns.size() >= BROWSER_MAX_CONNS) break;
+            std::shared_ptr<TcpPeer> peer = tcpConnect(80);
+            if (!peer || !peer->open) break; // Пул сервера занят - повтор на следующем шаге
+            BrowserConn bc;
+            bc.peer = peer;
+            conns.push_back(bc);
+            idle = &conns.back();
+        }
+        std::shared_ptr<HttpExchange> ex = queue().front();
+        queue().pop_front();
+        idle->ex = ex;
+        idle->stream = false;
+        idle->consumed = idle->peer->received.size();
+        idle->peer->sendData(rawRequest(*ex));
+    }
+}
+
+} // namespace sim
+
+static const char* statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default:  return "";
+    }
+}
+
+static HTTPMethod parseMethod(const std::string& m) {
+    if (m == "GET") return HTTP_GET;
+    if (m == "HEAD") return HTTP_HEAD;
+    if (m == "POST") return HTTP_POST;
+    if (m == "PUT") return HTTP_PUT;
+    if (m == "PATCH") return HTTP_PATCH;
+    if (m == "DELETE") return HTTP_DELETE;
+    if (m == "OPTIONS") return HTTP_OPTIONS;
+    return HTTP_ANY;
+}
+
+static std::string urlDecode(const std::string& s) {
+    std::string r;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] == '+') r += ' ';
+        else if (s[i] == '%' && i + 2 < s.size()) {
+            r += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+            i += 2;
+        } else r += s[i];
+    }
+    return r;
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction fn) {
+    routes_.push_back(Route{uri.c_str(), method, fn});
+}
+
+void WebServer::handleClient() {
+    if (!listening_ || !WiFi.simApActive() || sim::queue().empty()) return;
+
+    current_ = sim::queue().front();
+    sim::queue().pop_front();
+    sim::advanceUs(sim::cost().httpRequestUs);
+
+    if (current_->stalled) {
+        // Синхронный сервер читает строки запроса с таймаутом Stream - loop() стоит
+        sim::advanceUs(sim::cost().httpStallUs);
+        current_->conn->open = false;
+        current_->done = true;
+        current_->completedUs = sim::nowUs();
+        current_.reset();
+        return;
+    }
+
+    client_ = WiFiClient(current_->conn);
+    method_ = parseMethod(current_->method);
+    args_.clear();
+    pendingHeaders_.clear();
+    contentLength_ = CONTENT_LENGTH_NOT_SET;
+    chunked_ = false;
+
+    std::string uri = current_->uri;
+    size_t q = uri.find('?');
+    if (q != std::string::npos) {
+        std::string query = uri.substr(q + 1);
+        uri = uri.substr(0, q);
+        size_t pos = 0;
+        while (pos <= query.size()) {
+            size_t amp = query.find('&', pos);
+            std::string kv = query.substr(pos, amp == std::string::npos ? std::string::npos : amp - pos);
+            if (!kv.empty()) {
+                size_t eq = kv.find('=');
+                if (eq == std::string::npos) args_.push_back({urlDecode(kv), ""});
+                else args_.push_back({urlDecode(kv.substr(0, eq)), urlDecode(kv.substr(eq + 1))});
+            }
+            if (amp == std::string::npos) break;
+            pos = amp + 1;
+        }
+    }
+    if (!current_->body.empty()) args_.push_back({"plain", current_->body});
+    uri_ = uri;
+
+    bool handled = false;
+    for (Route& r : routes_) {
+        if (r.uri == uri_ && (r.method == HTTP_ANY || r.method == method_)) {
+            r.fn();
+            handled = true;
+            break;
+        }
+    }
+    if (!handled) {
+        if (notFound_) notFound_();
+        else send(404, "text/plain", "Not found");
+    }
+
+    // Обычный ответ (в т.ч. chunked) закрывает соединение; потоковые (SSE)
+    // держат его открытым. Как и настоящий WiFiClient, сокет живёт, пока
+    // обработчик хранит копию server.client() (ссылки: current_->conn,
+    // client_ и копии прошивки).
+    bool retained = current_->conn.use_count() > 2;
+    if (!retained) current_->conn->open = false;
+    current_->done = true;
+    current_->completedUs = sim::nowUs();
+    current_.reset();
+    client_ = WiFiClient();
+}
+
+String WebServer::arg(const String& name) const {
+    for (auto& a : args_) {
+        if (a.first == name.c_str()) return String(a.second.c_str());
+    }
+    return String();
+}
+
+String WebServer::arg(int i) const {
+    return (i >= 0 && i < (int)args_.size()) ? String(args_[i].second.c_str()) : String();
+}
+
+String WebServer::argName(int i) const {
+    return (i >= 0 && i < (int)args_.size()) ? String(args_[i].first.c_str()) : String();
+}
+
+bool WebServer::hasArg(const String& name) const {
+    for (auto& a : args_) {
+        if (a.first == name.c_str()) return true;
+    }
+    return false;
+}
+
+String WebServer::header(const String& name) const {
+    if (!current_) return String();
+    for (auto& h : current_->requestHeaders) {
+        if (strcasecmp(h.first.c_str(), name.c_str()) == 0) return String(h.second.c_str());
+    }
+    return String();
+}
+
+bool WebServer::hasHeader(const String& name) const {
+    if (!current_) return false;
+    for (auto& h : current_->requestHeaders) {
+        if (strcasecmp(h.first.c_str(), name.c_str()) == 0) return true;
+    }
+    return false;
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+    std::pair<std::string, std::string> h(name.c_str(), value.c_str());
+    if (first) pendingHeaders_.insert(pendingHeaders_.begin(), h);
+    else pendingHeaders_.push_back(h);
+}
+
+void WebServer::writeHead(int code, const char* content_type, size_t contentLength) {
+    if (!current_) return;
+    current_->code = code;
+    current_->contentType = content_type ? content_type : "text/html";
+    current_->responseHeaders = pendingHeaders_;
+
+    String head = "HTTP/1.1 " + String(code) + " " + statusText(code) + "\r\n";
+    head += "Content-Type: ";
+    head += current_->contentType.c_str();
+    head += "\r\n";
+    if (contentLength == CONTENT_LENGTH_UNKNOWN) {
+        chunked_ = true;
+        head += "Transfer-Encoding: chunked\r\n";
+    } else {
+        head += "Content-Length: " + String((unsigned long)contentLength) + "\r\n";
+    }
+    for (auto& h : pendingHeaders_) {
+        head += h.first.c_str();
+        head += ": ";
+        head += h.second.c_str();
+        head += "\r\n";
+    }
+    head += "Connection: close\r\n\r\n";
+    pendingHeaders_.clear();
+    client_.write(head.c_str(), head.length());
+}
+
+void WebServer::send(int code, const char* content_type, const String& content) {
+    size_t len = (contentLength_ == CONTENT_LENGTH_NOT_SET) ? content.length() : contentLength_;
+    writeHead(code, content_type, len);
+    if (content.length()) sendContent(content.c_str(), content.length());
+}
+
+void WebServer::send(int code, const char* content_type, const uint8_t* content, size_t contentLength) {
+    writeHead(code, content_type, contentLength);
+    if (contentLength) sendContent((const char*)content, contentLength);
+}
+
+void WebServer::send_P(int code, PGM_P content_type, PGM_P content) {
+    send_P(code, content_type, content, strlen(content));
+}
+
+void WebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength) {
+    writeHead(code, content_type, contentLength);
+    sendContent(content, contentLength);
+}
+
+void WebServer::sendContent(const char* content, size_t contentLength) {
+    if (!current_) return;
+    if (chunked_) {
+        char len[12];
+        snprintf(len, sizeof(len), "%zX\r\n", contentLength);
+        client_.write(len);
+        if (contentLength) client_.write(content, contentLength);
+        client_.write("\r\n");
+    } else {
+        client_.write(content, contentLength);
+    }
+    current_->response.append(content, contentLength);
+}
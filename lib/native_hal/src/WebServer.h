@@ -0,0 +1,118 @@
+// =================================================================================
+// File:         lib/native_hal/src/WebServer.h
+// Description:  Синхронный WebServer (API arduino-esp32) для [env:native].
+//               Запросы ставит в очередь симулятор ("браузер техника"),
+//               handleClient() обслуживает не более одного запроса за вызов,
+//               как и настоящий сервер. Если вместо него слушает AsyncServer
+//               (USE_ASYNC_HTTP), ту же очередь отправляет sim::webPump().
+// =================================================================================
+
+#ifndef NATIVE_HAL_WEBSERVER_H
+#define NATIVE_HAL_WEBSERVER_H
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include <functional>
+#include <memory>
+#include <vector>
+#include <utility>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+namespace sim {
+struct HttpExchange {
+    std::string method;
+    std::string uri;
+    std::string body;
+    std::vector<std::pair<std::string, std::string>> requestHeaders;
+
+    int code = 0;
+    std::string contentType;
+    std::vector<std::pair<std::string, std::string>> responseHeaders;
+    std::string response;       // Тело ответа (после сборки чанков)
+    bool done = false;
+    bool stalled = false;       // Клиент передаёт только строку запроса и замолкает
+    uint64_t queuedUs = 0;
+    uint64_t completedUs = 0;
+    std::shared_ptr<SimConnection> conn = std::make_shared<SimConnection>();
+};
+
+std::shared_ptr<HttpExchange> webEnqueue(const char* method, const char* uri, const char* body = "",
+                                         const std::vector<std::pair<std::string, std::string>>& headers = {});
+// Зависший клиент: запрос так и не дописывается до конца
+std::shared_ptr<HttpExchange> webEnqueueStalled(const char* uri);
+size_t webPending();
+// Если прошивка слушает порт 80 через AsyncTCP - отправить очередь по TCP
+// (keep-alive, до 6 соединений, как браузер) и разобрать ответы
+void webPump();
+}
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80) : port_(port) {}
+
+    void begin() { listening_ = true; }
+    void stop() { listening_ = false; }
+    void close() { stop(); }
+    void handleClient();
+
+    void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction fn);
+    void onNotFound(THandlerFunction fn) { notFound_ = fn; }
+
+    String uri() const { return String(uri_.c_str()); }
+    HTTPMethod method() const { return method_; }
+    String arg(const String& name) const;
+    String arg(int i) const;
+    String argName(int i) const;
+    int args() const { return (int)args_.size(); }
+    bool hasArg(const String& name) const;
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+    void collectHeaders(const char* headerKeys[], size_t headerKeysCount) { (void)headerKeys; (void)headerKeysCount; }
+
+    WiFiClient client() { return client_; }
+
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t contentLength) { contentLength_ = contentLength; }
+    void send(int code, const char* content_type = NULL, const String& content = String());
+    void send(int code, const String& content_type, const String& content) { send(code, content_type.c_str(), content); }
+    void send(int code, const char* content_type, const char* content) { send(code, content_type, String(content)); }
+    void send(int code, const char* content_type, const uint8_t* content, size_t contentLength);
+    void send_P(int code, PGM_P content_type, PGM_P content);
+    void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t contentLength);
+    void sendContent_P(PGM_P content) { sendContent(content, strlen(content)); }
+    void sendContent_P(PGM_P content, size_t size) { sendContent(content, size); }
+
+private:
+    struct Route {
+        std::string uri;
+        HTTPMethod method;
+        THandlerFunction fn;
+    };
+    void writeHead(int code, const char* content_type, size_t contentLength);
+
+    int port_;
+    bool listening_ = false;
+    std::vector<Route> routes_;
+    THandlerFunction notFound_;
+
+    // Текущий запрос
+    std::shared_ptr<sim::HttpExchange> current_;
+    WiFiClient client_;
+    std::string uri_;
+    HTTPMethod method_ = HTTP_ANY;
+    std::vector<std::pair<std::string, std::string>> args_;
+    std::vector<std::pair<std::string, std::string>> pendingHeaders_;
+    size_t contentLength_ = CONTENT_LENGTH_NOT_SET;
+    bool chunked_ = false;
+};
+
+#endif // NATIVE_HAL_WEBSERVER_H
@@ -0,0 +1,28 @@
+// =================================================================================
+// File:         lib/native_hal/src/WiFi.cpp
+// Description:  WiFi и WiFiClient для [env:native].
+// =================================================================================
+
+#include "WiFi.h"
+#include "sim_clock.h"
+
+WiFiClass WiFi;
+
+size_t WiFiClient::write(const uint8_t* buf, size_t n) {
+    if (!connected()) return 0;
+    conn_->tx.append((const char*)buf, n);
+    conn_->writes++;
+    sim::advanceUs((uint64_t)n * sim::cost().httpByteUs);
+    return n;
+}
+
+int WiFiClient::available() { return conn_ ? (int)conn_->rx.size() : 0; }
+
+int WiFiClient::read() {
+    if (!conn_ || conn_->rx.empty()) return -1;
+    int c = (uint8_t)conn_->rx[0];
+    conn_->rx.erase(0, 1);
+    return c;
+}
+
+int WiFiClient::peek() { return (conn_ && !conn_->rx.empty()) ? (uint8_t)conn_->rx[0] : -1; }
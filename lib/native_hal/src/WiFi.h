@@ -0,0 +1,76 @@
+// =================================================================================
+// File:         lib/native_hal/src/WiFi.h
+// Description:  WiFi (режим точки доступа) и WiFiClient для [env:native].
+//               Клиент — буфер в памяти, который читает симулятор.
+// =================================================================================
+
+#ifndef NATIVE_HAL_WIFI_H
+#define NATIVE_HAL_WIFI_H
+
+#include "Arduino.h"
+#include <memory>
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+namespace sim {
+// Соединение с "браузером" симулятора
+struct SimConnection {
+    std::string rx;     // Данные от клиента
+    std::string tx;     // Данные, отправленные прошивкой
+    bool open = true;
+    uint32_t writes = 0;
+};
+}
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    explicit WiFiClient(std::shared_ptr<sim::SimConnection> conn) : conn_(conn) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t n) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override {}
+    uint8_t connected() { return conn_ && conn_->open; }
+    void stop() { if (conn_) conn_->open = false; }
+    void setNoDelay(bool nodelay) { (void)nodelay; }
+    explicit operator bool() const { return conn_ != nullptr; }
+    bool operator==(const WiFiClient& o) const { return conn_ == o.conn_; }
+
+    std::shared_ptr<sim::SimConnection> simConnection() const { return conn_; }
+
+private:
+    std::shared_ptr<sim::SimConnection> conn_;
+};
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t m) { mode_ = m; return true; }
+    wifi_mode_t getMode() const { return mode_; }
+    bool softAPConfig(IPAddress local_ip, IPAddress gateway, IPAddress subnet) {
+        apIP_ = local_ip; (void)gateway; (void)subnet; return true;
+    }
+    bool softAP(const char* ssid, const char* passphrase = NULL) {
+        (void)ssid; (void)passphrase; apActive_ = true; return true;
+    }
+    bool softAPdisconnect(bool wifioff = false) { (void)wifioff; apActive_ = false; return true; }
+    uint8_t softAPgetStationNum() const { return apActive_ ? stations_ : 0; }
+    IPAddress softAPIP() const { return apIP_; }
+
+    // --- Только для симулятора ---
+    bool simApActive() const { return apActive_; }
+    void simSetStations(uint8_t n) { stations_ = n; }
+
+private:
+    wifi_mode_t mode_ = WIFI_OFF;
+    IPAddress apIP_;
+    bool apActive_ = false;
+    uint8_t stations_ = 0;
+};
+
+extern WiFiClass WiFi;
+
+#endif // NATIVE_HAL_WIFI_H
@@ -0,0 +1,95 @@
+// =================================================================================
+// File:         lib/native_hal/src/Wire.cpp
+// Description:  Реализация TwoWire поверх эмулированной шины I2C.
+// =================================================================================
+
+#include "Wire.h"
+#include "sim_clock.h"
+#include "sim_devices.h"
+
+TwoWire Wire;
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    sim::i2cSetPins(sda, scl);
+    if (frequency) sim::cost().i2cClockHz = frequency;
+    return true;
+}
+
+bool TwoWire::end() { return true; }
+
+bool TwoWire::setClock(uint32_t frequency) {
+    sim::cost().i2cClockHz = frequency;
+    return true;
+}
+
+uint32_t TwoWire::getClock() { return sim::cost().i2cClockHz; }
+
+void TwoWire::setTimeOut(uint16_t timeOutMillis) { sim::cost().i2cTimeoutUs = (uint32_t)timeOutMillis * 1000u; }
+
+uint16_t TwoWire::getTimeOut() { return (uint16_t)(sim::cost().i2cTimeoutUs / 1000u); }
+
+void TwoWire::beginTransmission(uint16_t address) {
+    txAddress_ = address;
+    txLength_ = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (txLength_ >= sizeof(txBuffer_)) return 0;
+    txBuffer_[txLength_++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t quantity) {
+    size_t n = 0;
+    while (n < quantity && write(data[n])) n++;
+    return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    (void)sendStop;
+    sim::I2CDevice* dev = sim::i2cFind((uint8_t)txAddress_);
+    if (sim::i2cBusStuck() || (dev && dev->hung)) {
+        if (dev) dev->failedTransactions++;
+        sim::advanceUs(sim::cost().i2cTimeoutUs);
+        return 5;
+    }
+    if (!dev || !dev->online) {
+        if (dev) dev->failedTransactions++;
+        sim::advanceUs(sim::i2cTransferUs(1));
+        return 2;
+    }
+    sim::advanceUs(sim::i2cTransferUs((uint32_t)txLength_ + 1));
+    dev->writeTransactions++;
+    dev->bytesTransferred += (uint32_t)txLength_ + 1;
+    if (txLength_) dev->onWrite(txBuffer_, txLength_);
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint16_t address, uint8_t size, bool sendStop) {
+    (void)sendStop;
+    rxLength_ = 0;
+    rxIndex_ = 0;
+    if (size > sizeof(rxBuffer_)) size = sizeof(rxBuffer_);
+    sim::I2CDevice* dev = sim::i2cFind((uint8_t)address);
+    if (sim::i2cBusStuck() || (dev && dev->hung)) {
+        if (dev) dev->failedTransactions++;
+        sim::advanceUs(sim::cost().i2cTimeoutUs);
+        return 0;
+    }
+    if (!dev || !dev->online) {
+        if (dev) dev->failedTransactions++;
+        sim::advanceUs(sim::i2cTransferUs(1));
+        return 0;
+    }
+    sim::advanceUs(sim::i2cTransferUs((uint32_t)size + 1));
+    dev->readTransactions++;
+    dev->bytesTransferred += (uint32_t)size + 1;
+    rxLength_ = dev->onRead(rxBuffer_, size);
+    return (uint8_t)rxLength_;
+}
+
+int TwoWire::available() { return (int)(rxLength_ - rxIndex_); }
+
+int TwoWire::read() { return rxIndex_ < rxLength_ ? rxBuffer_[rxIndex_++] : -1; }
+
+int TwoWire::peek() { return rxIndex_ < rxLength_ ? rxBuffer_[rxIndex_] : -1; }
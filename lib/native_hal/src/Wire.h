@@ -0,0 +1,51 @@
+// =================================================================================
+// File:         lib/native_hal/src/Wire.h
+// Description:  TwoWire для [env:native]: транзакции уходят в эмулированные
+//               I2C-устройства (sim_devices.h), время обмена списывается с
+//               виртуальных часов по частоте шины.
+// =================================================================================
+
+#ifndef NATIVE_HAL_WIRE_H
+#define NATIVE_HAL_WIRE_H
+
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire : public Stream {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+    bool end();
+    bool setClock(uint32_t frequency);
+    uint32_t getClock();
+    void setTimeOut(uint16_t timeOutMillis);
+    uint16_t getTimeOut();
+
+    void beginTransmission(uint16_t address);
+    void beginTransmission(int address) { beginTransmission((uint16_t)address); }
+    uint8_t endTransmission(bool sendStop = true);
+
+    uint8_t requestFrom(uint16_t address, uint8_t size, bool sendStop = true);
+    uint8_t requestFrom(int address, int size) { return requestFrom((uint16_t)address, (uint8_t)size, true); }
+    uint8_t requestFrom(uint8_t address, uint8_t size) { return requestFrom((uint16_t)address, size, true); }
+
+    size_t write(uint8_t data) override;
+    size_t write(const uint8_t* data, size_t quantity) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override {}
+
+private:
+    uint16_t txAddress_ = 0;
+    uint8_t txBuffer_[I2C_BUFFER_LENGTH];
+    size_t txLength_ = 0;
+    uint8_t rxBuffer_[I2C_BUFFER_LENGTH];
+    size_t rxLength_ = 0;
+    size_t rxIndex_ = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // NATIVE_HAL_WIRE_H
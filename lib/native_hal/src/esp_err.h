@@ -0,0 +1,15 @@
+// =================================================================================
+// File:         lib/native_hal/src/esp_err.h
+// Description:  Коды ошибок ESP-IDF для [env:native].
+// =================================================================================
+
+#ifndef NATIVE_HAL_ESP_ERR_H
+#define NATIVE_HAL_ESP_ERR_H
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+#endif // NATIVE_HAL_ESP_ERR_H
@@ -0,0 +1,99 @@
+// =================================================================================
+// File:         lib/native_hal/src/esp_partition.cpp
+// Description:  Раздел flash в ОЗУ для [env:native].
+// =================================================================================
+
+#include "esp_partition.h"
+#include "sim_clock.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+namespace {
+
+// default.csv: spiffs, data, spiffs, 0x290000, 0x170000
+const esp_partition_t SPIFFS_PARTITION = {
+    ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, 0x290000, 0x170000, "spiffs", false};
+
+std::vector<uint8_t>& image() {
+    static std::vector<uint8_t> img(SPIFFS_PARTITION.size, 0xFF);
+    return img;
+}
+
+std::vector<uint32_t>& sectorErases() {
+    static std::vector<uint32_t> e(SPIFFS_PARTITION.size / SPI_FLASH_SEC_SIZE, 0);
+    return e;
+}
+
+bool inRange(const esp_partition_t* p, size_t offset, size_t size) {
+    return p == &SPIFFS_PARTITION && offset <= p->size && size <= p->size - offset;
+}
+
+} // namespace
+
+namespace sim {
+FlashStats& flashStats() {
+    static FlashStats s;
+    return s;
+}
+
+bool flashLoadImage(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t>& img = image();
+    size_t n = fread(img.data(), 1, img.size(), f);
+    fclose(f);
+    return n == img.size();
+}
+
+bool flashSaveImage(const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    std::vector<uint8_t>& img = image();
+    size_t n = fwrite(img.data(), 1, img.size(), f);
+    fclose(f);
+    return n == img.size();
+}
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    if (type != SPIFFS_PARTITION.type) return nullptr;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != SPIFFS_PARTITION.subtype) return nullptr;
+    if (label && strcmp(label, SPIFFS_PARTITION.label) != 0) return nullptr;
+    return &SPIFFS_PARTITION;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size) {
+    if (!inRange(partition, src_offset, size)) return ESP_ERR_INVALID_ARG;
+    sim::advanceUs(sim::cost().flashReadUs);
+    sim::flashStats().reads++;
+    memcpy(dst, image().data() + src_offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size) {
+    if (!inRange(partition, dst_offset, size)) return ESP_ERR_INVALID_ARG;
+    // NOR: программирование только сбрасывает биты в 0
+    uint8_t* to = image().data() + dst_offset;
+    const uint8_t* from = (const uint8_t*)src;
+    for (size_t i = 0; i < size; i++) to[i] &= from[i];
+    sim::advanceUs((uint64_t)sim::cost().flashPageWriteUs * ((size + 255) / 256));
+    sim::flashStats().writes++;
+    sim::flashStats().bytesWritten += size;
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    if (!inRange(partition, offset, size)) return ESP_ERR_INVALID_ARG;
+    if (offset % SPI_FLASH_SEC_SIZE || size % SPI_FLASH_SEC_SIZE) return ESP_ERR_INVALID_SIZE;
+    memset(image().data() + offset, 0xFF, size);
+    sim::FlashStats& st = sim::flashStats();
+    for (size_t s = offset / SPI_FLASH_SEC_SIZE; s < (offset + size) / SPI_FLASH_SEC_SIZE; s++) {
+        uint32_t n = ++sectorErases()[s];
+        if (n > st.maxSectorErases) st.maxSectorErases = n;
+        st.erases++;
+        sim::advanceUs(sim::cost().flashEraseUs);
+    }
+    return ESP_OK;
+}
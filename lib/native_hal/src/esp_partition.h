@@ -0,0 +1,61 @@
+// =================================================================================
+// File:         lib/native_hal/src/esp_partition.h
+// Description:  Разделы flash (API ESP-IDF 4.x) для [env:native].
+//               Один раздел данных "spiffs" по таблице default.csv, образ
+//               в ОЗУ с поведением NOR: запись только сбрасывает биты,
+//               стирание - сектор 4 КБ в 0xFF. Образ можно загрузить из
+//               файла и сохранить в файл (проверка восстановления после
+//               "отключения питания" между прогонами).
+// =================================================================================
+
+#ifndef NATIVE_HAL_ESP_PARTITION_H
+#define NATIVE_HAL_ESP_PARTITION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_DATA_OTA = 0x00,
+    ESP_PARTITION_SUBTYPE_DATA_NVS = 0x02,
+    ESP_PARTITION_SUBTYPE_DATA_SPIFFS = 0x82,
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+    bool encrypted;
+} esp_partition_t;
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label);
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size);
+
+namespace sim {
+struct FlashStats {
+    uint32_t reads = 0;
+    uint32_t writes = 0;
+    uint32_t bytesWritten = 0;
+    uint32_t erases = 0;          // Стёрто секторов
+    uint32_t maxSectorErases = 0; // Износ самого стёртого сектора
+};
+FlashStats& flashStats();
+
+// Образ раздела: загрузить перед setup() / сохранить в конце прогона
+bool flashLoadImage(const char* path);
+bool flashSaveImage(const char* path);
+}
+
+#endif // NATIVE_HAL_ESP_PARTITION_H
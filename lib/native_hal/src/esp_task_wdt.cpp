@@ -0,0 +1,47 @@
+// =================================================================================
+// File:         lib/native_hal/src/esp_task_wdt.cpp
+// Description:  Учёт сторожевого таймера в виртуальном времени.
+// =================================================================================
+
+#include "esp_task_wdt.h"
+#include "sim_clock.h"
+
+static bool g_subscribed = false;
+static uint64_t g_lastResetUs = 0;
+
+namespace sim {
+WdtStats& wdtStats() {
+    static WdtStats s;
+    return s;
+}
+}
+
+esp_err_t esp_task_wdt_init(uint32_t timeout, bool panic) {
+    (void)panic;
+    sim::wdtStats().timeoutS = timeout;
+    return ESP_OK;
+}
+
+esp_err_t esp_task_wdt_add(TaskHandle_t handle) {
+    (void)handle;
+    g_subscribed = true;
+    g_lastResetUs = sim::nowUs();
+    return ESP_OK;
+}
+
+esp_err_t esp_task_wdt_delete(TaskHandle_t handle) {
+    (void)handle;
+    g_subscribed = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_task_wdt_reset(void) {
+    if (!g_subscribed) return ESP_FAIL;
+    sim::WdtStats& s = sim::wdtStats();
+    uint64_t gap = sim::nowUs() - g_lastResetUs;
+    if (gap > s.maxGapUs) s.maxGapUs = gap;
+    if (s.timeoutS && gap > (uint64_t)s.timeoutS * 1000000u) s.wouldFire++;
+    s.resets++;
+    g_lastResetUs = sim::nowUs();
+    return ESP_OK;
+}
@@ -0,0 +1,31 @@
+// =================================================================================
+// File:         lib/native_hal/src/esp_task_wdt.h
+// Description:  Сторожевой таймер задач (API ESP-IDF 4.x) для [env:native].
+//               Симулятор считает интервалы между сбросами в виртуальном
+//               времени и сообщает, когда на плате сработал бы WDT.
+// =================================================================================
+
+#ifndef NATIVE_HAL_ESP_TASK_WDT_H
+#define NATIVE_HAL_ESP_TASK_WDT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+
+esp_err_t esp_task_wdt_init(uint32_t timeout, bool panic);
+esp_err_t esp_task_wdt_add(TaskHandle_t handle);
+esp_err_t esp_task_wdt_delete(TaskHandle_t handle);
+esp_err_t esp_task_wdt_reset(void);
+
+namespace sim {
+struct WdtStats {
+    uint32_t timeoutS = 0;
+    uint32_t resets = 0;
+    uint32_t wouldFire = 0;   // Сколько раз интервал превысил таймаут
+    uint64_t maxGapUs = 0;    // Наибольший интервал между сбросами
+};
+WdtStats& wdtStats();
+}
+
+#endif // NATIVE_HAL_ESP_TASK_WDT_H
@@ -0,0 +1,38 @@
+// =================================================================================
+// File:         lib/native_hal/src/freertos/FreeRTOS.h
+// Description:  Типы и макросы FreeRTOS для [env:native]. На хосте прошивка
+//               однопоточная (задачи выполняются кооперативно из loop()),
+//               поэтому здесь только то, что нужно для компиляции кода
+//               синхронизации: мьютексы, тики и задержки.
+// =================================================================================
+
+#ifndef NATIVE_HAL_FREERTOS_H
+#define NATIVE_HAL_FREERTOS_H
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define pdFAIL  0
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define configMAX_PRIORITIES 25
+
+// Критические секции: на хосте один поток, вытеснения нет
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+
+#endif // NATIVE_HAL_FREERTOS_H
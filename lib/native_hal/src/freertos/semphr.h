@@ -0,0 +1,19 @@
+// =================================================================================
+// File:         lib/native_hal/src/freertos/semphr.h
+// Description:  Мьютексы FreeRTOS для [env:native]: учёт захватов без
+//               блокировок (на хосте один поток).
+// =================================================================================
+
+#ifndef NATIVE_HAL_SEMPHR_H
+#define NATIVE_HAL_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t m, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t m);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t m, TickType_t wait);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t m);
+
+#endif // NATIVE_HAL_SEMPHR_H
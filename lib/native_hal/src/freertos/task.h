@@ -0,0 +1,16 @@
+// =================================================================================
+// File:         lib/native_hal/src/freertos/task.h
+// Description:  Тики и задержки задач FreeRTOS для [env:native]
+//               (виртуальные часы, 1 тик = 1 мс).
+// =================================================================================
+
+#ifndef NATIVE_HAL_TASK_H
+#define NATIVE_HAL_TASK_H
+
+#include "FreeRTOS.h"
+
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment);
+
+#endif // NATIVE_HAL_TASK_H
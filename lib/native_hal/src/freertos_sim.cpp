@@ -0,0 +1,54 @@
+// =================================================================================
+// File:         lib/native_hal/src/freertos_sim.cpp
+// Description:  Реализация заглушек FreeRTOS для [env:native].
+// =================================================================================
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sim_clock.h"
+
+#include <stdio.h>
+
+namespace {
+struct SimMutex {
+    bool recursive;
+    uint32_t depth;
+};
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new SimMutex{false, 0}; }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new SimMutex{true, 0}; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t m, TickType_t wait) {
+    (void)wait;
+    SimMutex* mx = (SimMutex*)m;
+    if (!mx) return pdFALSE;
+    if (mx->depth && !mx->recursive) {
+        // В одном потоке повторный захват обычного мьютекса - взаимоблокировка на плате
+        fprintf(stderr, "[sim] non-recursive mutex taken twice at %.3f s\n", sim::nowUs() / 1e6);
+        return pdFALSE;
+    }
+    mx->depth++;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t m) {
+    SimMutex* mx = (SimMutex*)m;
+    if (!mx || !mx->depth) return pdFALSE;
+    mx->depth--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t m, TickType_t wait) { return xSemaphoreTake(m, wait); }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t m) { return xSemaphoreGive(m); }
+
+TickType_t xTaskGetTickCount() { return (TickType_t)(sim::nowUs() / 1000u); }
+
+void vTaskDelay(TickType_t ticks) { sim::advanceUs((uint64_t)ticks * 1000u); }
+
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment) {
+    *previousWakeTime += increment;
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(*previousWakeTime - now) > 0) vTaskDelay(*previousWakeTime - now);
+}
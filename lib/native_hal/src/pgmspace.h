@@ -0,0 +1,23 @@
+// =================================================================================
+// File:         lib/native_hal/src/pgmspace.h
+// Description:  PROGMEM на хосте — обычная память.
+// =================================================================================
+
+#ifndef NATIVE_HAL_PGMSPACE_H
+#define NATIVE_HAL_PGMSPACE_H
+
+#include <string.h>
+#include <stdint.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define memcpy_P memcpy
+
+#endif // NATIVE_HAL_PGMSPACE_H
@@ -0,0 +1,47 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_clock.cpp
+// Description:  Реализация виртуальных часов симулятора.
+// =================================================================================
+
+#include "sim_clock.h"
+
+namespace sim {
+
+static SimCostModel g_cost;
+static uint64_t g_nowUs = 0;
+static PlantStepFn g_plantStep = nullptr;
+static uint32_t g_plantStepUs = 100000;
+static uint64_t g_nextPlantUs = 0;
+static bool g_inPlantStep = false;
+
+SimCostModel& cost() { return g_cost; }
+
+uint64_t nowUs() { return g_nowUs; }
+
+void advanceUs(uint64_t us) {
+    uint64_t target = g_nowUs + us;
+    // Шаг модели объекта выполняется на границах stepUs, чтобы длинный
+    // delay() или медленная шина не "перепрыгивали" динамику установки.
+    while (g_plantStep && !g_inPlantStep && g_nextPlantUs <= target) {
+        g_nowUs = (g_nextPlantUs > g_nowUs) ? g_nextPlantUs : g_nowUs;
+        g_inPlantStep = true;
+        g_plantStep(g_nowUs);
+        g_inPlantStep = false;
+        g_nextPlantUs += g_plantStepUs;
+    }
+    g_nowUs = target;
+}
+
+uint32_t i2cTransferUs(uint32_t nBytes) {
+    uint32_t hz = g_cost.i2cClockHz ? g_cost.i2cClockHz : 100000;
+    // 9 тактов SCL на байт (8 бит + ACK)
+    return g_cost.i2cStartStopUs + (uint32_t)((uint64_t)nBytes * 9u * 1000000u / hz);
+}
+
+void setPlantStep(PlantStepFn fn, uint32_t stepUs) {
+    g_plantStep = fn;
+    g_plantStepUs = stepUs ? stepUs : 100000;
+    g_nextPlantUs = g_nowUs;
+}
+
+} // namespace sim
@@ -0,0 +1,55 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_clock.h
+// Description:  Виртуальные часы симулятора (только для [env:native]).
+//               millis()/micros()/delay() работают от этих часов, а не от
+//               системного времени, поэтому сутки работы установки
+//               прогоняются за секунды. Обмен по шинам I2C/1-Wire и
+//               обращения к NVS и flash "стоят" виртуального времени по модели
+//               SimCostModel — так видно реальную цену каждого вызова.
+// =================================================================================
+
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+namespace sim {
+
+// Модель стоимости операций (микросекунды виртуального времени).
+// Значения взяты с порядком величин ESP32 + Arduino-ядро.
+struct SimCostModel {
+    uint32_t i2cClockHz       = 100000; // Текущая частота шины (меняется Wire.setClock)
+    uint32_t i2cStartStopUs   = 10;     // START + STOP
+    uint32_t i2cTimeoutUs     = 50000;  // Таймаут Wire при "зависшем" устройстве (0 = NACK сразу)
+    uint32_t owResetUs        = 960;    // Импульс сброса + presence
+    uint32_t owSlotUs         = 70;     // Один тайм-слот чтения/записи бита
+    uint32_t nvsOpenUs        = 600;    // Preferences::begin()/end()
+    uint32_t nvsReadUs        = 900;    // Чтение ключа из NVS (flash)
+    uint32_t nvsWriteUs       = 6000;   // Запись ключа в NVS (flash, с commit)
+    uint32_t httpByteUs       = 8;      // Передача 1 байта ответа клиенту через softAP
+    uint32_t httpRequestUs    = 2000;   // Приём и разбор заголовков одного запроса
+    uint32_t httpStallUs      = 1000000; // Синхронный сервер ждёт недописанный запрос (таймаут Stream)
+    uint32_t tcpWriteUs       = 40;     // AsyncClient::add(): копия в буфер lwIP
+    uint32_t flashReadUs      = 20;     // esp_partition_read() небольшого блока
+    uint32_t flashPageWriteUs = 800;    // Программирование страницы 256 байт
+    uint32_t flashEraseUs     = 45000;  // Стирание сектора 4 КБ
+};
+
+SimCostModel& cost();
+
+// Текущее виртуальное время
+uint64_t nowUs();
+
+// Продвинуть виртуальное время (вызывает шаг модели объекта)
+void advanceUs(uint64_t us);
+
+// Время I2C-транзакции из nBytes байт (включая байт адреса) на текущей частоте
+uint32_t i2cTransferUs(uint32_t nBytes);
+
+// Хук шага модели объекта, вызывается не реже чем раз в stepUs виртуального времени
+typedef void (*PlantStepFn)(uint64_t nowUs);
+void setPlantStep(PlantStepFn fn, uint32_t stepUs);
+
+} // namespace sim
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,286 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_devices.cpp
+// Description:  Реализация моделей периферии для [env:native].
+// =================================================================================
+
+#include "sim_devices.h"
+#include "sim_clock.h"
+
+#include <string.h>
+#include <math.h>
+#include <map>
+
+namespace sim {
+
+// --- GPIO ---
+
+static uint8_t g_pinMode[64];
+static int8_t g_pinLevel[64];
+static void (*g_pinIsr[64])();
+static int g_pinIsrMode[64];
+static int g_i2cSda = -1, g_i2cScl = -1;
+static uint8_t g_i2cStuckClocks = 0;
+
+void gpioSetMode(uint8_t pin, uint8_t mode) {
+    if (pin >= 64) return;
+    g_pinMode[pin] = mode;
+}
+
+int gpioRead(uint8_t pin) {
+    if (pin >= 64) return 0;
+    if (g_i2cStuckClocks && pin == g_i2cSda) return 0;
+    return g_pinLevel[pin] > 0 ? 1 : 0;
+}
+
+void gpioWrite(uint8_t pin, uint8_t val) {
+    if (pin >= 64) return;
+    // Спад SCL - ещё один такт для ведомого, держащего SDA
+    if (g_i2cStuckClocks && pin == g_i2cScl && g_pinLevel[pin] > 0 && !val) g_i2cStuckClocks--;
+    g_pinLevel[pin] = val ? 1 : 0;
+}
+
+void gpioSetInput(uint8_t pin, int level) {
+    if (pin >= 64) return;
+    int8_t prev = g_pinLevel[pin];
+    g_pinLevel[pin] = level ? 1 : 0;
+    if (!g_pinIsr[pin] || prev == g_pinLevel[pin]) return;
+    bool rising = g_pinLevel[pin] > prev;
+    int mode = g_pinIsrMode[pin];
+    if (mode == 0x03 || (mode == 0x01 && rising) || (mode == 0x02 && !rising)) g_pinIsr[pin]();
+}
+
+void gpioAttachIsr(uint8_t pin, void (*isr)(), int mode) {
+    if (pin >= 64) return;
+    g_pinIsr[pin] = isr;
+    g_pinIsrMode[pin] = mode;
+}
+
+// --- I2C ---
+
+static std::vector<I2CDevice*>& deviceList() {
+    static std::vector<I2CDevice*> list;
+    return list;
+}
+
+void i2cAttach(I2CDevice* dev) { deviceList().push_back(dev); }
+
+I2CDevice* i2cFind(uint8_t addr) {
+    for (I2CDevice* d : deviceList()) {
+        if (d->address() == addr) return d;
+    }
+    return nullptr;
+}
+
+const std::vector<I2CDevice*>& i2cDevices() { return deviceList(); }
+
+void i2cSetPins(int sda, int scl) {
+    g_i2cSda = sda;
+    g_i2cScl = scl;
+    // Подтяжки: свободная шина - обе линии в 1
+    if (sda >= 0) gpioWrite((uint8_t)sda, 1);
+    if (scl >= 0) gpioWrite((uint8_t)scl, 1);
+}
+
+void i2cStickBus(uint8_t clocks) { g_i2cStuckClocks = clocks; }
+
+bool i2cBusStuck() { return g_i2cStuckClocks != 0; }
+
+// --- PCF8574 ---
+
+void Pcf8574::onWrite(const uint8_t* data, size_t n) {
+    if (!n) return;
+    if (latch != data[n - 1]) latchChangedUs = nowUs();
+    latch = data[n - 1];
+}
+
+size_t Pcf8574::onRead(uint8_t* data, size_t n) {
+    // Вывод с записанной "1" подтянут слабо и читает внешний уровень,
+    // вывод с "0" всегда читается как 0.
+    for (size_t i = 0; i < n; i++) data[i] = latch & externalPins;
+    lastReadPort = latch & externalPins;
+    if (intPin >= 0) gpioSetInput((uint8_t)intPin, 1);
+    return n;
+}
+
+void Pcf8574::setExternalPins(uint8_t pins) {
+    externalPins = pins;
+    if (intPin >= 0 && (uint8_t)(latch & externalPins) != lastReadPort) gpioSetInput((uint8_t)intPin, 0);
+}
+
+// --- DS3231 ---
+
+static uint8_t toBcd(int v) { return (uint8_t)(((v / 10) << 4) | (v % 10)); }
+static int fromBcd(uint8_t v) { return (v >> 4) * 10 + (v & 0x0F); }
+
+// Дни от 1970-01-01 для григорианской даты (алгоритм H. Hinnant)
+static int64_t daysFromCivil(int y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned)(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+static void civilFromDays(int64_t z, int& y, unsigned& m, unsigned& d) {
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = (unsigned)(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp + (mp < 10 ? 3 : -9);
+    y = (int)(yoe + era * 400 + (m <= 2));
+}
+
+Ds3231::Ds3231() : I2CDevice(0x68) {
+    memset(regs_, 0, sizeof(regs_));
+    regs_[0x0E] = 0x1C;
+    regs_[0x0F] = 0x80; // OSF: после подачи питания время не установлено
+    regs_[0x11] = 25;   // Температура кристалла, °C
+}
+
+uint32_t Ds3231::unixTime() const {
+    return (uint32_t)((unixAtZeroUs_ + (int64_t)nowUs()) / 1000000);
+}
+
+void Ds3231::setUnixTime(uint32_t t) {
+    unixAtZeroUs_ = (int64_t)t * 1000000 - (int64_t)nowUs();
+    regs_[0x0F] &= ~0x80;
+}
+
+void Ds3231::latchTime() {
+    uint32_t t = unixTime();
+    int64_t days = t / 86400;
+    uint32_t sod = t % 86400;
+    int y; unsigned m, d;
+    civilFromDays(days, y, m, d);
+    regs_[0] = toBcd(sod % 60);
+    regs_[1] = toBcd((sod / 60) % 60);
+    regs_[2] = toBcd(sod / 3600);
+    regs_[3] = toBcd((int)((days + 4) % 7) + 1); // 1970-01-01 — четверг; 1 = воскресенье
+    regs_[4] = toBcd((int)d);
+    regs_[5] = toBcd((int)m) | (y >= 2100 ? 0x80 : 0);
+    regs_[6] = toBcd(y % 100);
+}
+
+void Ds3231::onWrite(const uint8_t* data, size_t n) {
+    if (!n) return;
+    pointer_ = data[0];
+    bool timeWritten = false;
+    for (size_t i = 1; i < n; i++) {
+        if (pointer_ < sizeof(regs_)) {
+            if (pointer_ <= 0x06) timeWritten = true;
+            regs_[pointer_] = data[i];
+        }
+        pointer_++;
+    }
+    if (timeWritten) {
+        int y = 2000 + fromBcd(regs_[6]);
+        int64_t days = daysFromCivil(y, (unsigned)fromBcd(regs_[5] & 0x7F), (unsigned)fromBcd(regs_[4]));
+        int64_t t = days * 86400 + fromBcd(regs_[2] & 0x3F) * 3600 + fromBcd(regs_[1]) * 60 + fromBcd(regs_[0] & 0x7F);
+        unixAtZeroUs_ = t * 1000000 - (int64_t)nowUs();
+    }
+}
+
+size_t Ds3231::onRead(uint8_t* data, size_t n) {
+    if (pointer_ <= 0x06) latchTime();
+    for (size_t i = 0; i < n; i++) {
+        data[i] = (pointer_ < sizeof(regs_)) ? regs_[pointer_] : 0xFF;
+        pointer_++;
+    }
+    return n;
+}
+
+// --- SSD1309 ---
+
+void Ssd1309::onWrite(const uint8_t* data, size_t n) {
+    if (!n) return;
+    if ((data[0] & 0x40) == 0) {
+        // Поток команд: интересуют только включение/выключение панели
+        // и установка адреса (сброс курсора на начало кадра)
+        for (size_t i = 1; i < n; i++) {
+            if (data[i] == 0xAE) panelOn = false;
+            else if (data[i] == 0xAF) panelOn = true;
+            else if (data[i] == 0x21 || data[i] == 0x22) cursor_ = 0;
+        }
+        return;
+    }
+    for (size_t i = 1; i < n; i++) {
+        gddram[cursor_] = data[i];
+        dataBytes++;
+        if (++cursor_ >= sizeof(gddram)) {
+            cursor_ = 0;
+            framesReceived++;
+        }
+    }
+}
+
+// --- 1-Wire / DS18B20 ---
+
+uint8_t owCrc8(const uint8_t* data, uint8_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+        uint8_t inbyte = *data++;
+        for (uint8_t i = 8; i; i--) {
+            uint8_t mix = (crc ^ inbyte) & 0x01;
+            crc >>= 1;
+            if (mix) crc ^= 0x8C;
+            inbyte >>= 1;
+        }
+    }
+    return crc;
+}
+
+Ds18b20::Ds18b20() {
+    memset(rom, 0, sizeof(rom));
+    // Значение после включения питания: +85 °C, 12 бит
+    const uint8_t por[9] = {0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x00};
+    memcpy(scratchpad, por, sizeof(scratchpad));
+    updateCrc();
+}
+
+void Ds18b20::setRom(uint8_t serial) {
+    rom[0] = 0x28;
+    rom[1] = serial;
+    rom[2] = (uint8_t)(serial * 37 + 11);
+    rom[3] = (uint8_t)(serial ^ 0x5A);
+    rom[4] = 0x0B;
+    rom[5] = 0x00;
+    rom[6] = 0x00;
+    rom[7] = owCrc8(rom, 7);
+}
+
+uint8_t Ds18b20::resolution() const {
+    return (uint8_t)(9 + ((scratchpad[4] >> 5) & 0x03));
+}
+
+uint32_t Ds18b20::conversionUs() const {
+    return 93750u << (resolution() - 9);
+}
+
+void Ds18b20::startConversion(uint64_t now) {
+    converting = true;
+    conversionEndUs = now + conversionUs();
+}
+
+void Ds18b20::completeConversion() {
+    converting = false;
+    int raw = (int)lroundf(tempC * 16.0f);
+    raw &= ~((1 << (12 - resolution())) - 1);
+    scratchpad[0] = (uint8_t)(raw & 0xFF);
+    scratchpad[1] = (uint8_t)((raw >> 8) & 0xFF);
+    updateCrc();
+}
+
+void Ds18b20::updateCrc() {
+    scratchpad[8] = owCrc8(scratchpad, 8);
+}
+
+OneWireBus& owBus(uint8_t pin) {
+    static std::map<uint8_t, OneWireBus> buses;
+    return buses[pin];
+}
+
+} // namespace sim
@@ -0,0 +1,148 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_devices.h
+// Description:  Эмуляция периферии платы KC868-A8 для [env:native]:
+//               GPIO, шина I2C (PCF8574, DS3231, SSD1309) и шина 1-Wire
+//               (DS18B20). Драйверы HAL (Wire, OneWire, RTClib, U8g2)
+//               обращаются к этим моделям так же, как к железу — байтами.
+// =================================================================================
+
+#ifndef SIM_DEVICES_H
+#define SIM_DEVICES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace sim {
+
+// --- GPIO ---
+
+void gpioSetMode(uint8_t pin, uint8_t mode);
+int gpioRead(uint8_t pin);
+void gpioWrite(uint8_t pin, uint8_t val);
+void gpioSetInput(uint8_t pin, int level); // Внешний уровень на входе (с вызовом ISR на фронте)
+void gpioAttachIsr(uint8_t pin, void (*isr)(), int mode); // mode: RISING/FALLING/CHANGE
+
+// --- I2C ---
+
+class I2CDevice {
+public:
+    explicit I2CDevice(uint8_t addr) : addr_(addr) {}
+    virtual ~I2CDevice() {}
+    uint8_t address() const { return addr_; }
+
+    // Master -> slave (без байта адреса)
+    virtual void onWrite(const uint8_t* data, size_t n) = 0;
+    // Slave -> master, возвращает число отданных байт
+    virtual size_t onRead(uint8_t* data, size_t n) = 0;
+
+    bool online = true;  // Отвечает ACK на свой адрес
+    bool hung = false;   // "Висит": каждая транзакция стоит полный таймаут Wire
+
+    // Статистика обмена
+    uint32_t writeTransactions = 0;
+    uint32_t readTransactions = 0;
+    uint32_t bytesTransferred = 0;
+    uint32_t failedTransactions = 0;
+
+private:
+    uint8_t addr_;
+};
+
+void i2cAttach(I2CDevice* dev);
+I2CDevice* i2cFind(uint8_t addr);
+const std::vector<I2CDevice*>& i2cDevices();
+
+// Линии шины (задаёт Wire.begin) и "залипание": ведомый, сброшенный
+// посреди чтения, держит SDA в 0, пока не получит недостающие такты SCL.
+// Пока шина залипла, любая транзакция стоит полный таймаут Wire.
+void i2cSetPins(int sda, int scl);
+void i2cStickBus(uint8_t clocks);
+bool i2cBusStuck();
+
+// Квази-двунаправленный расширитель PCF8574
+class Pcf8574 : public I2CDevice {
+public:
+    explicit Pcf8574(uint8_t addr) : I2CDevice(addr) {}
+    void onWrite(const uint8_t* data, size_t n) override;
+    size_t onRead(uint8_t* data, size_t n) override;
+
+    // Уровни, которые подаёт внешняя схема; INT опускается, если порт
+    // отличается от прочитанного последним, и отпускается чтением
+    void setExternalPins(uint8_t pins);
+
+    uint8_t latch = 0xFF;       // Записанный регистр (выходы)
+    uint8_t externalPins = 0xFF; // Уровни, которые внешняя схема подаёт на выводы
+    uint64_t latchChangedUs = 0; // Когда запись последний раз изменила выходы
+    int intPin = -1;            // GPIO, на который заведён INT (-1 - не подключён)
+    uint8_t lastReadPort = 0xFF;
+};
+
+// Часы реального времени DS3231 (регистры 0x00..0x12)
+class Ds3231 : public I2CDevice {
+public:
+    Ds3231();
+    void onWrite(const uint8_t* data, size_t n) override;
+    size_t onRead(uint8_t* data, size_t n) override;
+
+    // Установить время "как при настройке с завода" и снять флаг OSF
+    void setUnixTime(uint32_t unixTime);
+    uint32_t unixTime() const;
+
+private:
+    void latchTime(); // Копирует текущее время в регистры 0x00..0x06
+    uint8_t regs_[0x13];
+    uint8_t pointer_ = 0;
+    int64_t unixAtZeroUs_ = 0; // Unix-время (с) в момент виртуального t=0, * 1e6
+};
+
+// OLED-контроллер SSD1309 128x64 (I2C, control byte 0x00/0x40)
+class Ssd1309 : public I2CDevice {
+public:
+    explicit Ssd1309(uint8_t addr) : I2CDevice(addr) {}
+    void onWrite(const uint8_t* data, size_t n) override;
+    size_t onRead(uint8_t* data, size_t n) override { (void)data; (void)n; return 0; }
+
+    bool panelOn = false;
+    uint32_t framesReceived = 0;
+    uint32_t dataBytes = 0;
+    uint8_t gddram[128 * 8] = {0};
+private:
+    uint16_t cursor_ = 0;
+};
+
+// --- 1-Wire ---
+
+struct Ds18b20 {
+    uint8_t rom[8];
+    float tempC = 20.0f;          // Температура, которую задаёт модель объекта
+    bool connected = true;
+    uint8_t scratchpad[9];
+    uint64_t conversionEndUs = 0; // Окончание текущего преобразования
+    bool converting = false;
+
+    Ds18b20();
+    void setRom(uint8_t serial);
+    uint8_t resolution() const;   // 9..12 бит
+    uint32_t conversionUs() const;
+    void startConversion(uint64_t nowUs);
+    void completeConversion();    // Защёлкивает tempC в scratchpad
+    void updateCrc();
+};
+
+class OneWireBus {
+public:
+    std::vector<Ds18b20*> devices;
+    uint32_t resets = 0;
+    uint32_t slots = 0;           // Тайм-слотов по одному биту
+    uint64_t busTimeUs = 0;       // Суммарное время занятости шины
+};
+
+OneWireBus& owBus(uint8_t pin);
+
+// CRC 1-Wire (полином X^8+X^5+X^4+1)
+uint8_t owCrc8(const uint8_t* data, uint8_t len);
+
+} // namespace sim
+
+#endif // SIM_DEVICES_H
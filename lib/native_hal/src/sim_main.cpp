@@ -0,0 +1,402 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_main.cpp
+// Description:  Точка входа [env:native]. Запускает настоящие setup()/loop()
+//               из src/main.cpp на виртуальных часах против модели объекта
+//               и печатает стоимость итерации loop(): по реальному времени
+//               хоста и по виртуальному времени (модели шин и NVS).
+//
+//               Параметры:
+//                 --days N / --hours N   длительность симуляции (по умолчанию 1 сутки)
+//                 --step-ms N            простой между итерациями loop() (10 мс)
+//                 --report-hours N       период строки состояния (1 ч, 0 = выкл.)
+//                 --web                  техник с открытой страницей (AP + /api/live,
+//                                        опросы - пока канал не подключён)
+//                 --web-poll             то же, но страница только опрашивает (без /api/live)
+//                 --stall-every SEC      (с --web) раз в SEC с зависший клиент: шлёт
+//                                        строку запроса и замолкает
+//                 --history FILE         (с --web) в конце выгрузить /api/history в FILE
+//                                        и события (kind=events) в FILE.events,
+//                                        журнал во flash (/api/flashlog) в FILE.flashlog,
+//                                        журнал событий (/api/events, все страницы) в FILE.journal
+//                 --flash-image FILE     образ раздела журнала: загрузить перед setup()
+//                                        (если есть) и сохранить в конце - повторный
+//                                        запуск = включение после отключения питания
+//                 --offline 0xAA[@SEC]   I2C-устройство не отвечает (с момента SEC)
+//                 --hang 0xAA[@SEC]      I2C-устройство "вешает" шину (таймауты)
+//                 --restore 0xAA@SEC     устройство снова в порядке с момента SEC
+//                 --stuck-bus SEC        с момента SEC ведомый держит SDA в 0 (до тактов SCL)
+//                 --dry-run C@SEC        сухой ход контура C с момента SEC
+//                 --unplug VAR@SEC       отключить датчик VAR с момента SEC
+//                 --screen               печатать снимок OLED в строке состояния
+//                 --perf                 в конце отправить в Serial команду "perf"
+//                                        (таблица профилировщика этапов)
+//                 --verbose              не глушить Serial прошивки
+// =================================================================================
+
+#include "Arduino.h"
+#include "WebServer.h"
+#include "U8g2lib.h"
+#include "Preferences.h"
+#include "esp_task_wdt.h"
+#include "esp_partition.h"
+#include "sim_clock.h"
+#include "sim_devices.h"
+#include "sim_plant.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+extern U8G2_SSD1309_128X64_NONAME0_F_HW_I2C u8g2;
+
+namespace {
+
+// Логарифмическая гистограмма (корзины по степеням двойки)
+struct LogHistogram {
+    uint64_t buckets[48] = {0};
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t maxValue = 0;
+
+    void add(uint64_t v) {
+        int b = 0;
+        while ((v >> b) > 1 && b < 46) b++;
+        buckets[v ? b + 1 : 0]++; // Корзина i: [2^(i-1), 2^i)
+        count++;
+        total += v;
+        if (v > maxValue) maxValue = v;
+    }
+
+    // Верхняя граница корзины, в которую попадает перцентиль p
+    uint64_t percentile(double p) const {
+        uint64_t target = (uint64_t)(count * p);
+        uint64_t acc = 0;
+        for (int i = 0; i < 48; i++) {
+            acc += buckets[i];
+            if (acc > target) return i == 0 ? 0 : (1ull << i);
+        }
+        return maxValue;
+    }
+};
+
+struct TimedEvent {
+    uint64_t atUs;
+    std::string kind;
+    std::string arg;
+    bool done;
+};
+
+const uint64_t US_PER_S = 1000000ull;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double hours = 24.0;
+    uint32_t stepMs = 10;
+    double reportHours = 1.0;
+    bool web = false;
+    bool webPollOnly = false;
+    double stallEveryS = 0;
+    bool screen = false;
+    bool verbose = false;
+    bool perf = false;
+    std::string historyFile;
+    std::string flashImage;
+    std::vector<std::pair<std::string, uint8_t>> i2cFaults;
+    std::vector<TimedEvent> events;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : "0"; };
+        if (a == "--days") hours = atof(next()) * 24.0;
+        else if (a == "--hours") hours = atof(next());
+        else if (a == "--step-ms") stepMs = (uint32_t)atoi(next());
+        else if (a == "--report-hours") reportHours = atof(next());
+        else if (a == "--web") web = true;
+        else if (a == "--web-poll") { web = true; webPollOnly = true; }
+        else if (a == "--stall-every") stallEveryS = atof(next());
+        else if (a == "--history") historyFile = next();
+        else if (a == "--flash-image") flashImage = next();
+        else if (a == "--screen") screen = true;
+        else if (a == "--verbose") verbose = true;
+        else if (a == "--perf") perf = true;
+        else if (a == "--offline" || a == "--hang" || a == "--restore") {
+            std::string v = next();
+            size_t at = v.find('@');
+            if (at == std::string::npos) i2cFaults.push_back({a, (uint8_t)strtol(v.c_str(), nullptr, 0)});
+            else events.push_back({(uint64_t)(atof(v.c_str() + at + 1) * US_PER_S), a, v.substr(0, at), false});
+        }
+        else if (a == "--stuck-bus") events.push_back({(uint64_t)(atof(next()) * US_PER_S), a, "", false});
+        else if (a == "--dry-run" || a == "--unplug") {
+            std::string v = next();
+            size_t at = v.find('@');
+            uint64_t t = (at == std::string::npos) ? 0 : (uint64_t)(atof(v.c_str() + at + 1) * US_PER_S);
+            events.push_back({t, a, v.substr(0, at), false});
+        } else {
+            fprintf(stderr, "unknown option: %s\n", a.c_str());
+            return 2;
+        }
+    }
+    if (stepMs == 0) stepMs = 1;
+    if (!flashImage.empty() && sim::flashLoadImage(flashImage.c_str())) printf("flash image    : loaded %s\n", flashImage.c_str());
+
+    Serial.simSetMuted(!verbose);
+
+    sim::PlantConfig cfg;
+    sim::plantInit(cfg);
+    for (auto& f : i2cFaults) {
+        sim::I2CDevice* d = sim::i2cFind(f.second);
+        if (!d) continue;
+        if (f.first == "--offline") d->online = false;
+        else if (f.first == "--hang") d->hung = true;
+    }
+
+    const uint64_t endUs = (uint64_t)(hours * 3600.0 * US_PER_S);
+    const uint64_t stepUs = (uint64_t)stepMs * 1000u;
+    const uint64_t reportUs = (uint64_t)(reportHours * 3600.0 * US_PER_S);
+    uint64_t nextReportUs = reportUs;
+    uint64_t nextPollUs = 0;
+    uint64_t nextPageLoadUs = 0;
+    std::string pageEtag;   // ETag страницы из кэша браузера
+    std::shared_ptr<sim::HttpExchange> pageLoad;
+    std::shared_ptr<sim::HttpExchange> liveSub;             // Текущая подписка /api/live
+    std::vector<std::shared_ptr<sim::HttpExchange>> liveAll; // Для подсчёта байт и событий
+    uint64_t nextLiveRetryUs = 0;
+    uint64_t nextStallUs = 0;
+    uint64_t stalledSent = 0, stalledClosed = 0;
+    std::vector<std::shared_ptr<sim::HttpExchange>> stalled;
+    uint64_t buttonReleaseUs = 0;
+
+    LogHistogram wallNs;   // Стоимость loop() на хосте
+    LogHistogram virtUs;   // Стоимость loop() в виртуальном времени (шины, NVS, задержки)
+    uint64_t webRequests = 0, webBytes = 0;
+    uint64_t pageLoads200 = 0, pageLoads304 = 0;
+    std::vector<std::shared_ptr<sim::HttpExchange>> inflight;
+
+    auto wallStart = std::chrono::steady_clock::now();
+    uint64_t setupStartUs = sim::nowUs();
+    setup();
+    uint64_t setupUs = sim::nowUs() - setupStartUs;
+
+    while (sim::nowUs() < endUs) {
+        uint64_t now = sim::nowUs();
+
+        for (TimedEvent& e : events) {
+            if (e.done || now < e.atUs) continue;
+            e.done = true;
+            if (e.kind == "--dry-run") sim::plantSetDryRun(atoi(e.arg.c_str()), true);
+            else if (e.kind == "--stuck-bus") sim::i2cStickBus(7);
+            else if (e.kind == "--offline" || e.kind == "--hang" || e.kind == "--restore") {
+                sim::I2CDevice* d = sim::i2cFind((uint8_t)strtol(e.arg.c_str(), nullptr, 0));
+                if (!d) continue;
+                d->online = (e.kind != "--offline");
+                d->hung = (e.kind == "--hang");
+            }
+            else sim::plantSetSensorConnected(e.arg.c_str(), false);
+        }
+
+        if (web) {
+            // Техник удерживает кнопку 5+ с, когда точка доступа выключена
+            if (!WiFi.simApActive() && buttonReleaseUs == 0) {
+                sim::gpioSetInput(cfg.buttonPin, 1);
+                buttonReleaseUs = now + 5500 * 1000ull;
+            }
+            if (buttonReleaseUs && now >= buttonReleaseUs) {
+                sim::gpioSetInput(cfg.buttonPin, 0);
+                buttonReleaseUs = 0;
+            }
+            WiFi.simSetStations(1);
+            // Страница: первая загрузка, затем перезагрузка раз в минуту с If-None-Match
+            if (WiFi.simApActive() && now >= nextPageLoadUs && !pageLoad) {
+                nextPageLoadUs = now + 60 * US_PER_S;
+                std::vector<std::pair<std::string, std::string>> hdrs;
+                if (!pageEtag.empty()) hdrs.push_back({"If-None-Match", pageEtag});
+                pageLoad = sim::webEnqueue("GET", "/", "", hdrs);
+                inflight.push_back(pageLoad);
+            }
+            if (pageLoad && pageLoad->done) {
+                for (auto& h : pageLoad->responseHeaders) if (h.first == "ETag") pageEtag = h.second;
+                if (pageLoad->code == 200) pageLoads200++;
+                else if (pageLoad->code == 304) pageLoads304++;
+                pageLoad.reset();
+            }
+            // EventSource: подписка и переподключение через retry (3 с)
+            if (liveSub && liveSub->done && !liveSub->conn->open) liveSub.reset();
+            if (!webPollOnly && WiFi.simApActive() && !liveSub && now >= nextLiveRetryUs) {
+                nextLiveRetryUs = now + 3 * US_PER_S;
+                liveSub = sim::webEnqueue("GET", "/api/live");
+                liveAll.push_back(liveSub);
+            }
+            bool liveActive = liveSub && liveSub->done && liveSub->conn->open &&
+                              liveSub->conn->tx.find("event: full") != std::string::npos;
+            if (stallEveryS > 0 && WiFi.simApActive() && now >= nextStallUs) {
+                nextStallUs = now + (uint64_t)(stallEveryS * US_PER_S);
+                stalled.push_back(sim::webEnqueueStalled("/api/main/status"));
+                stalledSent++;
+            }
+            if (WiFi.simApActive() && now >= nextPollUs && !liveActive) {
+                nextPollUs = now + 2 * US_PER_S;
+                static const char* const polls[] = {
+                    "/api/main/status", "/api/vars/status", "/api/ow/status",
+                    "/api/contour/profile?cont=1", "/api/system/status"};
+                for (const char* uri : polls) inflight.push_back(sim::webEnqueue("GET", uri));
+            }
+        }
+
+        sim::webPump();
+
+        auto w0 = std::chrono::steady_clock::now();
+        loop();
+        auto w1 = std::chrono::steady_clock::now();
+        uint64_t spent = sim::nowUs() - now;
+        wallNs.add((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(w1 - w0).count());
+        virtUs.add(spent);
+        if (spent < stepUs) sim::advanceUs(stepUs - spent);
+
+        if (!WiFi.simApActive() && liveSub) {
+            liveSub->conn->open = false; // Точка доступа выключена - соединение потеряно
+            liveSub.reset();
+        }
+
+        for (size_t i = 0; i < inflight.size();) {
+            if (inflight[i]->done) {
+                webRequests++;
+                webBytes += inflight[i]->conn->tx.size();
+                inflight[i] = inflight.back();
+                inflight.pop_back();
+            } else {
+                i++;
+            }
+        }
+
+        for (size_t i = 0; i < stalled.size();) {
+            if (stalled[i]->done) {
+                stalledClosed++;
+                stalled[i] = stalled.back();
+                stalled.pop_back();
+            } else {
+                i++;
+            }
+        }
+
+        if (reportUs && sim::nowUs() >= nextReportUs) {
+            nextReportUs += reportUs;
+            sim::plantPrintStatus(stdout);
+            if (screen) printf("%s", u8g2.simFrameText().c_str());
+        }
+    }
+
+    double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double simS = sim::nowUs() / 1e6;
+    const sim::NvsStats& nvs = sim::nvsStats();
+    sim::WdtStats& wdt = sim::wdtStats();
+
+    printf("\n===== native simulation summary =====\n");
+    printf("simulated      : %.1f h in %.2f s wall (x%.0f)\n", simS / 3600.0, wallS, wallS > 0 ? simS / wallS : 0.0);
+    printf("setup()        : %.1f ms virtual\n", setupUs / 1000.0);
+    printf("loop() calls   : %llu (idle step %u ms)\n", (unsigned long long)virtUs.count, stepMs);
+    printf("loop() host    : mean %.0f ns, p99 <= %llu ns, max %llu ns\n",
+           wallNs.count ? (double)wallNs.total / wallNs.count : 0.0,
+           (unsigned long long)wallNs.percentile(0.99), (unsigned long long)wallNs.maxValue);
+    printf("loop() virtual : mean %.1f us, p99 <= %llu us, p99.9 <= %llu us, max %llu us\n",
+           virtUs.count ? (double)virtUs.total / virtUs.count : 0.0,
+           (unsigned long long)virtUs.percentile(0.99), (unsigned long long)virtUs.percentile(0.999),
+           (unsigned long long)virtUs.maxValue);
+    printf("busy share     : %.2f %% of virtual time spent inside loop()\n", simS > 0 ? 100.0 * virtUs.total / 1e6 / simS : 0.0);
+    printf("NVS            : %u opens, %u reads, %u writes\n", nvs.opens, nvs.reads, nvs.writes);
+    const sim::FlashStats& fl = sim::flashStats();
+    printf("flash          : %u reads, %u writes (%u bytes), %u sector erases, max %u per sector\n",
+           fl.reads, fl.writes, fl.bytesWritten, fl.erases, fl.maxSectorErases);
+    for (sim::I2CDevice* d : sim::i2cDevices()) {
+        printf("I2C 0x%02X       : %u writes, %u reads, %u bytes, %u failed\n", d->address(),
+               d->writeTransactions, d->readTransactions, d->bytesTransferred, d->failedTransactions);
+    }
+    sim::OneWireBus& bus = sim::owBus(cfg.owPin);
+    printf("1-Wire         : %u resets, %u slots, bus busy %.1f s (%.2f %%)\n",
+           bus.resets, bus.slots, bus.busTimeUs / 1e6, simS > 0 ? 100.0 * bus.busTimeUs / 1e6 / simS : 0.0);
+    printf("web            : %llu requests, %llu bytes\n", (unsigned long long)webRequests, (unsigned long long)webBytes);
+    printf("web page /     : %llu full (200), %llu revalidated (304)\n", (unsigned long long)pageLoads200, (unsigned long long)pageLoads304);
+    uint64_t liveBytes = 0, liveEvents = 0;
+    for (auto& ex : liveAll) {
+        const std::string& tx = ex->conn->tx;
+        liveBytes += tx.size();
+        for (size_t p = tx.find("event: "); p != std::string::npos; p = tx.find("event: ", p + 1)) liveEvents++;
+    }
+    printf("web live       : %zu subscriptions, %llu events, %llu bytes\n", liveAll.size(),
+           (unsigned long long)liveEvents, (unsigned long long)liveBytes);
+    if (stallEveryS > 0) {
+        printf("web stalled    : %llu clients, %llu dropped by server\n",
+               (unsigned long long)stalledSent, (unsigned long long)stalledClosed);
+    }
+    printf("watchdog       : %u resets, max gap %.1f ms, would fire %u times\n",
+           wdt.resets, wdt.maxGapUs / 1000.0, wdt.wouldFire);
+    sim::plantPrintEvents(stdout);
+
+    // Выгрузка истории в конце прогона: тело приходит до закрытия соединения
+    auto download = [&](const char* uri, const std::string& path, const char* mode = "wb", bool report = true) {
+        std::shared_ptr<sim::HttpExchange> ex = sim::webEnqueue("GET", uri);
+        uint64_t startUs = sim::nowUs();
+        uint64_t maxLoopUs = 0;
+        while ((!ex->done || ex->conn->open) && sim::nowUs() - startUs < 600 * US_PER_S) {
+            sim::webPump();
+            uint64_t now = sim::nowUs();
+            loop();
+            uint64_t spent = sim::nowUs() - now;
+            if (spent > maxLoopUs) maxLoopUs = spent;
+            if (spent < stepUs) sim::advanceUs(stepUs - spent);
+        }
+        const std::string& tx = ex->conn->tx;
+        size_t bodyAt = tx.find("\r\n\r\n");
+        std::string body = (bodyAt == std::string::npos) ? std::string() : tx.substr(bodyAt + 4);
+        if (!ex->response.empty()) body = ex->response; // Ответ chunked - уже собранный
+        FILE* f = fopen(path.c_str(), mode);
+        if (f) {
+            fwrite(body.data(), 1, body.size(), f);
+            fclose(f);
+        }
+        size_t rows = 0;
+        for (char ch : body) if (ch == '\n') rows++;
+        if (report) printf("history        : %s -> %s: code %d, %zu lines, %zu bytes in %.1f s, loop() max %.1f ms\n",
+               uri, path.c_str(), ex->code, rows, body.size(), (sim::nowUs() - startUs) / 1e6, maxLoopUs / 1000.0);
+        return body;
+    };
+    // Журнал событий: страницы по курсору "next", пока more=true
+    auto downloadJournal = [&](const std::string& path) {
+        remove(path.c_str());
+        std::string cursor;
+        size_t pages = 0, events = 0;
+        while (pages < 1000) {
+            std::string uri = "/api/events?limit=200" + (cursor.empty() ? std::string() : "&cursor=" + cursor);
+            std::string body = download(uri.c_str(), path, "ab", false);
+            pages++;
+            for (size_t at = body.find("\"code\""); at != std::string::npos; at = body.find("\"code\"", at + 1)) events++;
+            size_t n = body.find("\"next\":\"");
+            if (n == std::string::npos || body.find("\"more\":true") == std::string::npos) break;
+            n += 8;
+            cursor = body.substr(n, body.find('"', n) - n);
+        }
+        printf("journal        : %zu pages, %zu events\n", pages, events);
+    };
+    if (!historyFile.empty() && web) {
+        download("/api/history", historyFile);
+        download("/api/history?kind=events", historyFile + ".events");
+        download("/api/flashlog", historyFile + ".flashlog");
+        downloadJournal(historyFile + ".journal");
+    }
+    if (!flashImage.empty()) sim::flashSaveImage(flashImage.c_str());
+    if (perf) {
+        // Команда техника из Serial: ответ печатает задание "console" задачи ui
+        printf("\n");
+        fflush(stdout);
+        Serial.simSetMuted(false);
+        Serial.simInject("perf\n");
+        for (uint64_t endAt = sim::nowUs() + 200000; sim::nowUs() < endAt;) {
+            uint64_t now = sim::nowUs();
+            loop();
+            uint64_t spent = sim::nowUs() - now;
+            if (spent < stepUs) sim::advanceUs(stepUs - spent);
+        }
+        Serial.simSetMuted(!verbose);
+    }
+    return 0;
+}
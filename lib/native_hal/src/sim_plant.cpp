@@ -0,0 +1,244 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_plant.cpp
+// Description:  Модель теплового пункта для [env:native].
+// =================================================================================
+
+#include "sim_plant.h"
+#include "sim_clock.h"
+#include "sim_devices.h"
+#include "Preferences.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace sim {
+
+// Разводка платы (совпадает с прошивкой): реле активны низким уровнем
+struct ContourWiring {
+    uint8_t relayValveMinus, relayValvePlus, relayPumpA, relayPumpB;
+    uint8_t inMode, inDryRun, inFeedbackA, inFeedbackB;
+    const char* tSupply[2];   // Переменные подачи (профили СО и ГВП)
+    const char* tReturn[2];   // Переменные обратки
+};
+
+static const ContourWiring WIRING[2] = {
+    {1, 2, 3, 4, 0, 1, 2, 3, {"T11", "T31"}, {"T21", "T41"}},
+    {5, 6, 7, 0, 4, 5, 6, 7, {"T12", "T32"}, {"T22", "T42"}},
+};
+
+static const char* const VARS[] = {"Tn", "T1", "T2", "T11", "T12", "T21", "T22", "T31", "T41", "T32", "T42"};
+static const size_t VAR_COUNT = sizeof(VARS) / sizeof(VARS[0]);
+
+static const float AMBIENT_C = 22.0f;
+static const uint32_t PUMP_SPINUP_US = 2000000;
+static const uint64_t DAY_US = 86400ull * 1000000ull;
+
+struct ContourState {
+    float valve = 0.3f;
+    float tSupply = AMBIENT_C;
+    float tReturn = AMBIENT_C;
+    uint64_t pumpOnSinceUs[2] = {0, 0};
+    bool pumpOn[2] = {false, false};
+    bool dryRun = false;
+    uint64_t dryRunSinceUs = 0;
+    int64_t dryRunReactionUs = -1;    // От начала сухого хода до отключения обоих насосов
+};
+
+static PlantConfig g_cfg;
+static Pcf8574 g_relays(0x24);
+static Pcf8574 g_inputs(0x22);
+static Ssd1309 g_oled(0x3C);
+static Ds3231 g_rtc;
+static Ds18b20 g_probes[VAR_COUNT];
+static ContourState g_contours[2];
+static uint64_t g_lastStepUs = 0;
+static float g_tn = 0.0f, g_t1 = 0.0f, g_t2 = 0.0f;
+static uint32_t g_noise = 12345;
+
+static float noise() {
+    g_noise = g_noise * 1103515245u + 12345u;
+    return ((int)((g_noise >> 16) & 0xFF) - 128) / 2560.0f; // ±0.05 °C
+}
+
+static Ds18b20* probe(const char* var) {
+    for (size_t i = 0; i < VAR_COUNT; i++) {
+        if (strcmp(VARS[i], var) == 0) return &g_probes[i];
+    }
+    return nullptr;
+}
+
+static void romToString(const uint8_t rom[8], char* buf) {
+    snprintf(buf, 24, "%02X-%02X-%02X-%02X-%02X-%02X-%02X-%02X",
+             rom[0], rom[1], rom[2], rom[3], rom[4], rom[5], rom[6], rom[7]);
+}
+
+static void seedNvs() {
+    Preferences p;
+    p.begin("owmap", false);
+    for (size_t i = 0; i < VAR_COUNT; i++) {
+        char rom[24];
+        romToString(g_probes[i].rom, rom);
+        p.putString(VARS[i], rom);
+    }
+    p.end();
+
+    p.begin("profiles", false);
+    p.putString("c1.profile", "CO_1");
+    p.putString("c2.profile", "GVP_2");
+    p.end();
+
+    p.begin("params", false);
+    p.putFloat("Tr", 1.0f);
+    p.putFloat("Tr4", 55.0f);
+    p.end();
+
+    p.begin("general", false);
+    p.putUChar("pumpEnableMask", 0b1111);
+    p.putString("curvePoints", "[{\"x\":-20,\"y\":85},{\"x\":-10,\"y\":70},{\"x\":0,\"y\":57},{\"x\":10,\"y\":45},{\"x\":20,\"y\":30}]");
+    p.putFloat("summerCutoff", 18.0f);
+    p.putFloat("pi1_Kp", 0.8f);
+    p.putFloat("pi1_Ki", 0.02f);
+    p.putFloat("pi1_Ti", 15.0f);
+    p.putFloat("pi2_Kp", 1.0f);
+    p.putFloat("pi2_Ki", 0.03f);
+    p.putFloat("pi2_Ti", 10.0f);
+    p.putString("comfort1", "{\"enabled\":true,\"intervals\":[{\"start\":\"00:00\",\"end\":\"05:00\",\"reduct\":-3},{\"start\":\"23:00\",\"end\":\"00:00\",\"reduct\":-3}],\"days\":[0,1,2,3,4,5,6]}");
+    p.putString("comfort2", "{\"enabled\":false,\"intervals\":[],\"days\":[]}");
+    p.putBool("timeWasSet", true);
+    p.end();
+}
+
+void plantInit(const PlantConfig& cfg) {
+    g_cfg = cfg;
+
+    i2cAttach(&g_inputs);
+    i2cAttach(&g_relays);
+    i2cAttach(&g_oled);
+    i2cAttach(&g_rtc);
+    g_rtc.setUnixTime(cfg.startUnixTime);
+
+    OneWireBus& bus = owBus(cfg.owPin);
+    for (size_t i = 0; i < VAR_COUNT; i++) {
+        g_probes[i].setRom((uint8_t)(0x10 + i * 7));
+        bus.devices.push_back(&g_probes[i]);
+    }
+
+    gpioSetInput(cfg.buttonPin, 0);
+    g_inputs.intPin = cfg.inputIntPin;
+    if (cfg.inputIntPin >= 0) gpioSetInput((uint8_t)cfg.inputIntPin, 1);
+    if (cfg.commissioned) seedNvs();
+
+    setPlantStep(plantStep, 100000);
+}
+
+void plantSetDryRun(int contour, bool dry) {
+    if (contour < 1 || contour > 2) return;
+    ContourState& s = g_contours[contour - 1];
+    s.dryRun = dry;
+    s.dryRunSinceUs = nowUs();
+    s.dryRunReactionUs = -1;
+    plantStep(nowUs()); // Входы PCF8574 меняются сразу, а не на следующем шаге модели
+}
+
+void plantSetSensorConnected(const char* var, bool connected) {
+    Ds18b20* p = probe(var);
+    if (p) p->connected = connected;
+}
+
+void plantStep(uint64_t nowUs) {
+    float dt = (nowUs - g_lastStepUs) / 1e6f;
+    g_lastStepUs = nowUs;
+    if (dt <= 0.0f) dt = 0.1f;
+
+    // Уличная температура: минимум в 03:00, максимум в 15:00
+    double hour = fmod((double)g_cfg.startUnixTime / 3600.0 + nowUs / 3.6e9, 24.0);
+    g_tn = g_cfg.outdoorMeanC - g_cfg.outdoorAmplitudeC * (float)cos((hour - 3.0) * M_PI / 12.0);
+    g_t1 = fminf(110.0f, fmaxf(65.0f, 70.0f - 1.3f * g_tn));
+    g_t2 = g_t1 - 25.0f;
+
+    uint8_t inputs = 0;
+    for (int c = 0; c < 2; c++) {
+        const ContourWiring& w = WIRING[c];
+        ContourState& s = g_contours[c];
+        uint8_t relays = g_relays.latch;
+
+        // Клапан: импульсы "+" открывают, "-" закрывают
+        float stroke = dt / (float)g_cfg.valveStrokeS;
+        if (!bitRead(relays, w.relayValvePlus)) s.valve += stroke;
+        if (!bitRead(relays, w.relayValveMinus)) s.valve -= stroke;
+        s.valve = fminf(1.0f, fmaxf(0.0f, s.valve));
+
+        // Насосы: обратная связь появляется после разгона
+        const uint8_t pumpRelay[2] = {w.relayPumpA, w.relayPumpB};
+        bool flow = false;
+        for (int p = 0; p < 2; p++) {
+            bool on = !bitRead(relays, pumpRelay[p]) && !s.dryRun;
+            if (on && !s.pumpOn[p]) s.pumpOnSinceUs[p] = nowUs;
+            s.pumpOn[p] = on;
+            bool fb = on && (nowUs - s.pumpOnSinceUs[p] >= PUMP_SPINUP_US);
+            flow |= fb;
+            if (fb) inputs |= (uint8_t)(1u << (p == 0 ? w.inFeedbackA : w.inFeedbackB));
+        }
+        inputs |= (uint8_t)(1u << w.inMode);
+        if (!s.dryRun) inputs |= (uint8_t)(1u << w.inDryRun);
+        if (s.dryRun && s.dryRunReactionUs < 0 && bitRead(relays, w.relayPumpA) && bitRead(relays, w.relayPumpB)) {
+            uint64_t offAt = g_relays.latchChangedUs > s.dryRunSinceUs ? g_relays.latchChangedUs : s.dryRunSinceUs;
+            s.dryRunReactionUs = (int64_t)(offAt - s.dryRunSinceUs);
+        }
+
+        // Тепловая часть: первый порядок для подачи и обратки
+        float load;
+        if (c == 0) {
+            load = fminf(25.0f, fmaxf(2.0f, 0.5f * (20.0f - g_tn)));
+        } else {
+            double dayPhase = fmod(hour, 24.0);
+            bool peak = (dayPhase >= 6.0 && dayPhase < 9.0) || (dayPhase >= 18.0 && dayPhase < 22.0);
+            load = peak ? 15.0f : 5.0f;
+        }
+        float supplyTarget = flow ? s.tReturn + s.valve * (g_t1 - s.tReturn) : AMBIENT_C;
+        float returnTarget = flow ? fmaxf(AMBIENT_C, s.tSupply - load) : AMBIENT_C;
+        s.tSupply += (supplyTarget - s.tSupply) * fminf(1.0f, dt / (flow ? 60.0f : 900.0f));
+        s.tReturn += (returnTarget - s.tReturn) * fminf(1.0f, dt / (flow ? 300.0f : 900.0f));
+
+        for (int k = 0; k < 2; k++) {
+            probe(w.tSupply[k])->tempC = s.tSupply + noise();
+            probe(w.tReturn[k])->tempC = s.tReturn + noise();
+        }
+    }
+    g_inputs.setExternalPins(inputs);
+
+    probe("Tn")->tempC = g_tn + noise();
+    probe("T1")->tempC = g_t1 + noise();
+    probe("T2")->tempC = g_t2 + noise();
+}
+
+void plantPrintEvents(FILE* out) {
+    for (int c = 0; c < 2; c++) {
+        const ContourState& s = g_contours[c];
+        if (!s.dryRun) continue;
+        if (s.dryRunReactionUs >= 0) {
+            fprintf(out, "dry-run c%d     : pumps off %.1f ms after loss of water\n", c + 1, s.dryRunReactionUs / 1000.0);
+        } else {
+            fprintf(out, "dry-run c%d     : pumps still on\n", c + 1);
+        }
+    }
+}
+
+void plantPrintStatus(FILE* out) {
+    uint64_t now = nowUs();
+    uint32_t t = g_rtc.unixTime();
+    fprintf(out, "[sim %3llud %02u:%02u] Tn=%5.1f T1=%5.1f",
+            (unsigned long long)(now / DAY_US), (t / 3600) % 24, (t / 60) % 60, g_tn, g_t1);
+    for (int c = 0; c < 2; c++) {
+        const ContourState& s = g_contours[c];
+        fprintf(out, " | c%d valve=%3.0f%% sup=%5.1f ret=%5.1f pump=%c%c%s", c + 1,
+                s.valve * 100.0f, s.tSupply, s.tReturn,
+                s.pumpOn[0] ? 'A' : '-', s.pumpOn[1] ? 'B' : '-', s.dryRun ? " DRY" : "");
+    }
+    OneWireBus& bus = owBus(g_cfg.owPin);
+    fprintf(out, " | relayW=%u inR=%u oledB=%u owBus=%.1fs\n",
+            g_relays.writeTransactions, g_inputs.readTransactions, g_oled.bytesTransferred,
+            bus.busTimeUs / 1e6);
+}
+
+} // namespace sim
@@ -0,0 +1,40 @@
+// =================================================================================
+// File:         lib/native_hal/src/sim_plant.h
+// Description:  Модель теплового пункта для [env:native]: уличная температура
+//               с суточным ходом, тепловая сеть, два контура с
+//               трёхходовыми клапанами и сдвоенными насосами. Модель читает
+//               выходы реле (PCF8574 0x24), выставляет входы (PCF8574 0x22)
+//               и температуры DS18B20 на шине 1-Wire.
+// =================================================================================
+
+#ifndef SIM_PLANT_H
+#define SIM_PLANT_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace sim {
+
+struct PlantConfig {
+    float outdoorMeanC = -5.0f;       // Средняя уличная температура за сутки
+    float outdoorAmplitudeC = 5.0f;   // Полуразмах суточного хода
+    uint32_t startUnixTime = 1765152000u; // 2025-12-08 00:00:00 (понедельник)
+    uint32_t valveStrokeS = 120;      // Полный ход клапана
+    bool commissioned = true;         // Заполнить NVS как на настроенном объекте
+    uint8_t owPin = 14;
+    uint8_t buttonPin = 34;
+    int inputIntPin = 35;             // INT входного PCF8574 (-1 - не подключён)
+};
+
+void plantInit(const PlantConfig& cfg);
+void plantStep(uint64_t nowUs);
+void plantPrintStatus(FILE* out);
+void plantPrintEvents(FILE* out); // Итоги нарушений (время реакции) для сводки
+
+// Нарушения, которые можно включить из командной строки
+void plantSetDryRun(int contour, bool dry);
+void plantSetSensorConnected(const char* var, bool connected);
+
+} // namespace sim
+
+#endif // SIM_PLANT_H
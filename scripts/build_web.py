@@ -0,0 +1,103 @@
+# =================================================================================
+# File:         scripts/build_web.py
+# Description:  Сборка веб-интерфейса: web/index.html -> минификация -> gzip ->
+#               include/web_ui_gz.h (массив байт в PROGMEM + ETag по хешу).
+#               Подключён в platformio.ini как pre-скрипт и выполняется перед
+#               каждой сборкой; файл переписывается только при изменении.
+#               Запуск вручную: python3 scripts/build_web.py
+# =================================================================================
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - определён PlatformIO (SCons)
+    ROOT = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SRC = os.path.join(ROOT, "web", "index.html")
+OUT = os.path.join(ROOT, "include", "web_ui_gz.h")
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{};:,>])\s*", r"\1", css)
+    return css.replace(";}", "}").strip()
+
+
+def minify_js(js):
+    # Консервативно: без переименований и склейки строк (ASI), только
+    # отступы, пустые строки и комментарии на всю строку
+    out = []
+    for line in js.split("\n"):
+        s = line.strip()
+        if not s or s.startswith("//"):
+            continue
+        out.append(s)
+    return "\n".join(out)
+
+
+def minify_html(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    parts = re.split(r"(<style[^>]*>.*?</style>|<script[^>]*>.*?</script>)", html, flags=re.S | re.I)
+    out = []
+    for part in parts:
+        m = re.match(r"(<(style|script)[^>]*>)(.*?)(</\2>)", part, flags=re.S | re.I)
+        if m:
+            body = minify_css(m.group(3)) if m.group(2).lower() == "style" else minify_js(m.group(3))
+            out.append(m.group(1) + body + m.group(4))
+        else:
+            text = re.sub(r">\s+<", "><", part)
+            text = re.sub(r"\s+", " ", text)
+            out.append(text)
+    return "".join(out).strip()
+
+
+def build():
+    with open(SRC, "r", encoding="utf-8") as f:
+        html = f.read()
+    mini = minify_html(html).encode("utf-8")
+    gz = gzip.compress(mini, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(mini).hexdigest()[:16]
+
+    lines = []
+    for i in range(0, len(gz), 16):
+        lines.append("  " + ",".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    text = (
+        "// =================================================================================\n"
+        "// File:         include/web_ui_gz.h\n"
+        "// Description:  СГЕНЕРИРОВАН scripts/build_web.py из web/index.html - не править.\n"
+        "//               Исходник %d Б, после минификации %d Б, gzip %d Б.\n"
+        "//               Подключается только из web_interface.cpp.\n"
+        "// =================================================================================\n"
+        "\n"
+        "#ifndef WEB_UI_GZ_H\n"
+        "#define WEB_UI_GZ_H\n"
+        "\n"
+        "#include <pgmspace.h>\n"
+        "\n"
+        "#define WEB_UI_ETAG \"\\\"%s\\\"\"\n"
+        "\n"
+        "static const size_t WEB_UI_GZ_LEN = %d;\n"
+        "static const uint8_t WEB_UI_GZ[] PROGMEM = {\n"
+        "%s\n"
+        "};\n"
+        "\n"
+        "#endif // WEB_UI_GZ_H\n"
+    ) % (len(html.encode("utf-8")), len(mini), len(gz), etag, len(gz), "\n".join(lines))
+
+    old = None
+    if os.path.exists(OUT):
+        with open(OUT, "r", encoding="utf-8") as f:
+            old = f.read()
+    if old != text:
+        with open(OUT, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print("build_web: %s (%d -> %d -> %d bytes, ETag %s)" % (OUT, len(html.encode("utf-8")), len(mini), len(gz), etag))
+
+
+build()
@@ -0,0 +1,142 @@
+// =================================================================================
+// File:         src/comfort.cpp
+// Description:  Расписание комфортного режима и минутный такт часов RTC.
+// =================================================================================
+
+#include "comfort.h"
+#include "tasks.h"
+#include "hardware.h"
+
+// --- Локальное состояние модуля ---
+static bool clockValid = false;
+static uint16_t clockMinuteOfDay = 0;
+static uint8_t clockDayOfWeek = 0;
+static uint32_t clockUnix = 0;           // Время UNIX на момент чтения RTC
+static unsigned long clockReadTime = 0;  // millis() того же чтения
+static unsigned long nextRtcReadTime = 0;
+static bool resyncPending = true;
+
+struct ComfortState {
+    bool active = false;
+    float reduction = 0.0f;
+};
+static ComfortState comfortStates[CONTOUR_COUNT];
+
+// "HH:MM" -> минуты от полуночи, -1 при ошибке формата; "24:00" - конец суток (1440)
+static int parseHhMm(const char* s) {
+    if (!s || !isdigit(s[0]) || !isdigit(s[1]) || s[2] != ':' || !isdigit(s[3]) || !isdigit(s[4])) return -1;
+    int h = (s[0] - '0') * 10 + (s[1] - '0');
+    int m = (s[3] - '0') * 10 + (s[4] - '0');
+    if (h == 24 && m == 0) return 1440;
+    if (h > 23 || m > 59) return -1;
+    return h * 60 + m;
+}
+
+void comfortCompile(const String& json, ComfortSchedule& out) {
+    out.enabled = false;
+    out.dayMask = 0;
+    out.count = 0;
+
+    StaticJsonDocument<512> doc;
+    if (deserializeJson(doc, json)) return;
+
+    out.enabled = doc["enabled"] | false;
+
+    JsonArray days = doc["days"];
+    for (int day : days) {
+        if (day >= 0 && day <= 6) out.dayMask |= (uint8_t)(1 << day);
+    }
+
+    JsonArray intervals = doc["intervals"];
+    for (JsonObject interval : intervals) {
+        if (out.count >= COMFORT_MAX_INTERVALS) break;
+        int startMins = parseHhMm(interval["start"] | "00:00");
+        int endMins = parseHhMm(interval["end"] | "00:00");
+        if (startMins < 0 || endMins < 0) continue;
+        if (endMins == 0 && startMins > 0) endMins = 1440;
+        if (endMins <= startMins) continue;
+
+        ComfortInterval& iv = out.iv[out.count++];
+        iv.startMin = (uint16_t)startMins;
+        iv.endMin = (uint16_t)endMins;
+        iv.reduct = interval["reduct"] | 0.0f;
+    }
+}
+
+static void evaluate(const ComfortSchedule& sched, ComfortState& state) {
+    state.active = false;
+    state.reduction = 0.0f;
+    if (!clockValid || !appSettings.timeWasSet || !sched.enabled) return;
+    if (!(sched.dayMask & (1 << clockDayOfWeek))) return;
+
+    for (uint8_t i = 0; i < sched.count; i++) {
+        const ComfortInterval& iv = sched.iv[i];
+        if (clockMinuteOfDay >= iv.startMin && clockMinuteOfDay < iv.endMin) {
+            state.active = true;
+            state.reduction = iv.reduct;
+            return;
+        }
+    }
+}
+
+uint32_t comfortTick() {
+    unsigned long now = millis();
+    bool changed = false;
+
+    if (!isRtcAvailable) {
+        if (clockValid) { clockValid = false; changed = true; }
+        resyncPending = true;
+    } else if (resyncPending || (long)(now - nextRtcReadTime) >= 0) {
+        DateTime dt;
+        if (!rtcRead(dt)) {
+            resyncPending = true; // Повтор через секунду; offline - решает менеджер шины
+            return 1000;
+        }
+        clockMinuteOfDay = (uint16_t)(dt.hour() * 60 + dt.minute());
+        clockDayOfWeek = dt.dayOfTheWeek();
+        clockUnix = dt.unixtime();
+        clockReadTime = now;
+        clockValid = true;
+        resyncPending = false;
+        // Следующее чтение - сразу после смены минуты
+        nextRtcReadTime = now + (60UL - dt.second()) * 1000UL + 20;
+        changed = true;
+    }
+
+    if (changed) {
+        MutexLock lock(settingsMutex);
+        for (uint8_t c = 0; c < CONTOUR_COUNT; c++) evaluate(appSettings.comfortSched[c], comfortStates[c]);
+    }
+
+    if (!isRtcAvailable || resyncPending) return 1000; // Ждём RTC или пересчёта после comfortInvalidate()
+    long left = (long)(nextRtcReadTime - millis());
+    return left > 0 ? (uint32_t)left : 0;
+}
+
+void comfortInvalidate() {
+    resyncPending = true;
+}
+
+bool comfortActive(uint8_t cont, float& reduction) {
+    if (!isContour(cont)) {
+        reduction = 0.0f;
+        return false;
+    }
+    const ComfortState& state = comfortStates[cont - 1];
+    reduction = state.reduction;
+    return state.active;
+}
+
+bool comfortClock(uint8_t& hour, uint8_t& minute, uint8_t& dayOfWeek) {
+    if (!clockValid) return false;
+    hour = clockMinuteOfDay / 60;
+    minute = clockMinuteOfDay % 60;
+    dayOfWeek = clockDayOfWeek;
+    return true;
+}
+
+bool comfortUnixTime(uint32_t& unixTime) {
+    if (!clockValid || !appSettings.timeWasSet) return false;
+    unixTime = clockUnix + (uint32_t)((millis() - clockReadTime) / 1000UL);
+    return true;
+}
@@ -25,6 +25,22 @@ const char* OW_VARS[OW_VAR_COUNT] = {
 // Проверка времени компиляции, чтобы убедиться, что константа соответствует размеру
 static_assert(sizeof(OW_VARS)/sizeof(OW_VARS[0]) == OW_VAR_COUNT, "OW_VAR_COUNT mismatch!");
 
+// Порядок как в OW_VARS. Подача ГВП (T31/T32) - быстро и грубее,
+// улица (Tn) - медленно и точно. Время преобразования: 9 бит 94 мс ... 12 бит 750 мс.
+const OwVarTiming OW_VAR_TIMING[OW_VAR_COUNT] = {
+  { 12, 10000 }, // Tn
+  { 11,  2000 }, // T1
+  { 11,  2000 }, // T2
+  { 11,  2000 }, // T11
+  { 11,  2000 }, // T12
+  { 11,  2000 }, // T21
+  { 11,  2000 }, // T22
+  {  9,   500 }, // T31
+  { 10,  1000 }, // T41
+  {  9,   500 }, // T32
+  { 10,  1000 }  // T42
+};
+
 
 // --- Секция 2: Определение глобальных объектов и переменных (НОВЫЙ КОД) ---
 
@@ -35,20 +51,25 @@ Preferences prefsProfiles;
 Preferences prefsGeneral;
 
 // Глобальные объекты устройств
-RTC_DS3231 rtc;
 U8G2_SSD1309_128X64_NONAME0_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
 
 // Глобальные объекты для логики
-PIDController pidController1;
-PIDController pidController2;
+PIDController pidControllers[CONTOUR_COUNT];
+ContourPumpLogic pumpLogic[CONTOUR_COUNT];
 
-ContourPumpLogic pumpLogic1;
-ContourPumpLogic pumpLogic2;
+#if USE_ASYNC_HTTP
+HttpServer server(80);
+#else
+WebServer server(80);
+#endif
 
-WebServer server(80); // <-- ДОБАВИТЬ
+SemaphoreHandle_t ioMutex = nullptr;
+SemaphoreHandle_t settingsMutex = nullptr;
+SemaphoreHandle_t owMutex = nullptr;
 
 // --- Глобальные переменные состояния ---
-uint8_t globalPumpEnableMask = 0b1111;
+uint8_t globalPumpEnableMask = PUMP_ENABLE_ALL;
+AppSettings appSettings;
 
 // UI and Mode State // <-- ДОБАВИТЬ ЭТОТ БЛОК
 bool displayOn = false;
@@ -64,22 +85,8 @@ bool isInputExpanderAvailable = false;
 bool isRtcAvailable = false;
 
 // Состояние реле и таймеры импульсов
-uint8_t relayStates = 0xFF; // Изначально все реле выключены (логика инверсная)
-unsigned long pulseEndTimes[8] = {0};
-
-// Стабильные (отфильтрованные) состояния входов
-int contour1_mode_stable = 0, contour1_mode_last = 0, contour1_mode_count = 0;
-int dry_run_state_stable = 1, dry_run_state_last = 1, dry_run_state_count = 0;
-int pump1_state_stable = 0, pump1_state_last = 0, pump1_state_count = 0;
-int pump2_state_stable = 0, pump2_state_last = 0, pump2_state_count = 0;
-int contour2_mode_stable = 0, contour2_mode_last = 0, contour2_mode_count = 0;
-int dry_run_state_2_stable = 1, dry_run_state_2_last = 1, dry_run_state_2_count = 0;
-int pump3_state_stable = 0, pump3_state_last = 0, pump3_state_count = 0;
-int pump4_state_stable = 0, pump4_state_last = 0, pump4_state_count = 0;
-
-// Переменные для отслеживания предыдущего состояния режима
-bool wasInAutoModeContour1 = false;
-bool wasInAutoModeContour2 = false;
+uint32_t relayStates = 0; // Изначально все реле выключены
+unsigned long pulseEndTimes[RELAY_COUNT] = {0};
 
 // --- Константы --- // <-- ДОБАВИТЬ ЭТОТ БЛОК
 const unsigned long displayTimeout = 300000; // 5 минут
@@ -0,0 +1,371 @@
+// =================================================================================
+// File:         src/display.cpp
+// Description:  Реализация OLED-экранов: снимок состояния, таблицы строк
+//               экранов и передача кадра только при изменении содержимого.
+// =================================================================================
+
+#include "display.h"
+#include "utils.h"
+#include "sensors.h"
+#include "pid_control.h"
+#include "comfort.h"
+#include "inputs.h"
+#include "i2c_bus.h"
+
+// Откуда берутся данные контуров
+
+// --- Модель кадра ---
+// Экран сначала собирается в модель (OledView) - готовые строки, которые видны
+// на дисплее. Кадр рисуется и передаётся по I2C (1 КБ), только если модель
+// отличается от последней переданной. Модель заполняется целиком через memset,
+// поэтому её можно сравнивать memcmp.
+
+#define OLED_VIEW_LINES 5
+#define OLED_LINE_LEN 24
+
+struct OledView {
+    char title[14];             // Заголовок (ncenB10)
+    char page[8];               // Номер страницы в правом верхнем углу ("" - нет)
+    uint8_t lineCount;
+    uint8_t lineY[OLED_VIEW_LINES];
+    char lines[OLED_VIEW_LINES][OLED_LINE_LEN];
+};
+
+static OledView oledShown;          // Последний переданный кадр
+static bool oledShownValid = false; // false - передать следующий кадр безусловно
+static bool oledTransferFailed = false;
+
+// Транспорт U8g2 через менеджер шины: байты передачи копятся в буфере и
+// уходят одной транзакцией. Частоту шины U8g2 не трогает (его HW I2C
+// выставлял 400 кГц и расширителям PCF8574). Результат каждой транзакции
+// кадра проверяется здесь, отдельный "пинг" дисплея перед кадром не нужен;
+// с дисплеем в offline кадр отклоняется, не занимая шину.
+static int8_t oledDev = -1;
+static uint8_t oledTx[I2C_BUFFER_LENGTH];
+static uint8_t oledTxLen = 0;
+
+static uint8_t oledByteCb(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    (void)u8x8;
+    switch (msg) {
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            oledTxLen = 0;
+            break;
+        case U8X8_MSG_BYTE_SEND:
+            if (oledTxLen + arg_int > sizeof(oledTx)) {
+                oledTransferFailed = true;
+                break;
+            }
+            memcpy(oledTx + oledTxLen, arg_ptr, arg_int);
+            oledTxLen += arg_int;
+            break;
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            if (i2cWrite(oledDev, oledTx, oledTxLen) != I2C_OK) oledTransferFailed = true;
+            break;
+        default:
+            break;
+    }
+    return 1;
+}
+
+void displayInit() {
+    oledDev = i2cRegister(OLED_ADDR, "oled", 400000, 10);
+    u8g2.getU8x8()->byte_cb = oledByteCb;
+}
+
+bool displayLinkOnline() {
+    return i2cOnline(oledDev);
+}
+
+void displayInvalidate() {
+    oledShownValid = false;
+}
+
+// --- Снимок ---
+
+static void collectSnapshot(DisplaySnapshot& s) {
+    s.relayBoardOk = isRelayExpanderAvailable;
+    s.inputBoardOk = isInputExpanderAvailable;
+    s.clockValid = isRtcAvailable && comfortClock(s.hh, s.mm, s.dow);
+    s.tn = getTempByVar("Tn", s.tnAlarm);
+    s.t1 = getTempByVar("T1", s.t1Alarm);
+    s.t2 = getTempByVar("T2", s.t2Alarm);
+    s.anyDryRun = false;
+    s.apClients = apModeActive ? WiFi.softAPgetStationNum() : 0;
+
+    for (uint8_t i = 0; i < CONTOUR_COUNT; i++) {
+        DisplayContourSnapshot& c = s.contour[i];
+        const ContourPumpLogic& logic = pumpLogic[i];
+        uint8_t tileIdx = getProfileIndex(i + 1);
+        const TileDef& tile = getTile(tileIdx);
+        strncpy(c.profileId, tile.id, sizeof(c.profileId) - 1);
+        c.profileId[sizeof(c.profileId) - 1] = '\0';
+        c.tsup = getTempByVar(tile.TPOD, c.tsupAlarm);
+        c.tret = getTempByVar(tile.TINV, c.tretAlarm);
+        c.comfort = false;
+        c.comfortReduction = 0.0f;
+        c.tset = calculateSetpoint(i + 1, c.comfort, c.comfortReduction);
+        c.summer = logic.summer_mode_active;
+        c.pumpsAlarm = (logic.state == S_ALL_PUMPS_ALARM);
+        c.pump[0] = logic.pumps[0].status;
+        c.pump[1] = logic.pumps[1].status;
+        c.dryRunOk = inputGet(CONTOURS[i].dryRunInput);
+        if (!c.dryRunOk) s.anyDryRun = true;
+    }
+}
+
+// --- Форматирование полей ---
+// Строка экрана: функция пишет текст в buf и возвращает false, если строку
+// на этом кадре показывать не нужно. cont - индекс контура (для экранов контура).
+
+typedef bool (*LineFmt)(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len);
+
+struct ScreenLine {
+    uint8_t y;
+    LineFmt fmt;
+};
+
+struct ScreenDef {
+    LineFmt title;
+    const ScreenLine* lines;
+    uint8_t lineCount;
+};
+
+// Температура: "AL" при аварии датчика, иначе с одним знаком
+static const char* fmtTemp(char* buf, size_t len, float t, bool alarm, const char* unit) {
+    if (alarm) snprintf(buf, len, "AL");
+    else snprintf(buf, len, "%.1f%s", t, unit);
+    return buf;
+}
+
+static const char* pumpStatusText(PumpStatus status) {
+    switch (status) {
+        case S_WORKING: return "WORK";
+        case S_ALARM:   return "ALARM";
+        case S_REPAIR:  return "REPAIR";
+        case S_OK:
+        default:        return "OK";
+    }
+}
+
+static bool fmtContourTitle(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len) {
+    snprintf(buf, len, "%s", s.contour[cont].profileId);
+    return true;
+}
+
+static bool fmtTsup(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len) {
+    char t[12];
+    const DisplayContourSnapshot& c = s.contour[cont];
+    snprintf(buf, len, "Tsup: %s", fmtTemp(t, sizeof(t), c.tsup, c.tsupAlarm, " C"));
+    return true;
+}
+
+static bool fmtTret(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len) {
+    char t[12];
+    const DisplayContourSnapshot& c = s.contour[cont];
+    snprintf(buf, len, "Tret: %s", fmtTemp(t, sizeof(t), c.tret, c.tretAlarm, " C"));
+    return true;
+}
+
+static bool fmtTset(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len) {
+    const DisplayContourSnapshot& c = s.contour[cont];
+    char t[8];
+    if (isnan(c.tset)) snprintf(t, sizeof(t), "--.-");
+    else snprintf(t, sizeof(t), "%.1f", c.tset);
+    if (c.summer) snprintf(buf, len, "Tset: SUMMER");
+    else if (c.comfort) snprintf(buf, len, "Tset: %sC(%.1f)", t, c.comfortReduction);
+    else snprintf(buf, len, "Tset: %s C", t);
+    return true;
+}
+
+static bool fmtPumps(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len) {
+    const DisplayContourSnapshot& c = s.contour[cont];
+    if (c.pumpsAlarm) snprintf(buf, len, "PUMPS: ALARM");
+    else snprintf(buf, len, "P1:%s  P2:%s", pumpStatusText(c.pump[0]), pumpStatusText(c.pump[1]));
+    return true;
+}
+
+static bool fmtDryRun(const DisplaySnapshot& s, uint8_t cont, char* buf, size_t len) {
+    snprintf(buf, len, "DryRun: %s", s.contour[cont].dryRunOk ? "OK" : "ALARM");
+    return true;
+}
+
+static bool fmtSystemTitle(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "System");
+    return true;
+}
+
+static bool fmtClock(const DisplaySnapshot& s, uint8_t, char* buf, size_t len) {
+    static const char* days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    if (s.clockValid) snprintf(buf, len, "Time: %02d:%02d (%s)", s.hh, s.mm, days[s.dow % 7]);
+    else snprintf(buf, len, "TIME: OFFLINE");
+    return true;
+}
+
+static bool fmtOutdoor(const DisplaySnapshot& s, uint8_t, char* buf, size_t len) {
+    char t[12];
+    snprintf(buf, len, "T out: %s", fmtTemp(t, sizeof(t), s.tn, s.tnAlarm, " C"));
+    return true;
+}
+
+static bool fmtNetwork(const DisplaySnapshot& s, uint8_t, char* buf, size_t len) {
+    char a[12], b[12];
+    snprintf(buf, len, "T net: %s / %s C", fmtTemp(a, sizeof(a), s.t1, s.t1Alarm, ""), fmtTemp(b, sizeof(b), s.t2, s.t2Alarm, ""));
+    return true;
+}
+
+static bool fmtDryRunAlarm(const DisplaySnapshot& s, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "ALARM: DRY RUN");
+    return s.anyDryRun;
+}
+
+static bool fmtApTitle(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "Wi-Fi AP");
+    return true;
+}
+
+static bool fmtApMode(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "SETUP MODE");
+    return true;
+}
+
+static bool fmtApSsid(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "SSID: %s", AP_SSID);
+    return true;
+}
+
+static bool fmtApIp(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "IP: %u.%u.%u.%u", apIP[0], apIP[1], apIP[2], apIP[3]);
+    return true;
+}
+
+static bool fmtApClients(const DisplaySnapshot& s, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "Clients: %d", s.apClients);
+    return true;
+}
+
+// Экраны аварии I2C: строки фиксированные, cont не используется
+static bool fmtAlarmTitle(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "SYSTEM ALARM");
+    return true;
+}
+
+static bool fmtI2CTag(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "(I2C)");
+    return true;
+}
+
+static bool fmtRelayFault(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "RELAY BOARD FAULT");
+    return true;
+}
+
+static bool fmtRelayFaultAction(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "CONTROL STOPPED");
+    return true;
+}
+
+static bool fmtInputFault(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "INPUT BOARD FAULT");
+    return true;
+}
+
+static bool fmtInputFaultAction(const DisplaySnapshot&, uint8_t, char* buf, size_t len) {
+    snprintf(buf, len, "BLIND MODE ACTIVE");
+    return true;
+}
+
+// --- Таблицы экранов ---
+
+static const ScreenLine CONTOUR_LINES[] = {
+    { 24, fmtTsup }, { 34, fmtTret }, { 44, fmtTset }, { 54, fmtPumps }, { 64, fmtDryRun }
+};
+static const ScreenLine SYSTEM_LINES[] = {
+    { 26, fmtClock }, { 40, fmtOutdoor }, { 52, fmtNetwork }, { 64, fmtDryRunAlarm }
+};
+static const ScreenLine AP_LINES[] = {
+    { 24, fmtApMode }, { 40, fmtApSsid }, { 52, fmtApIp }, { 64, fmtApClients }
+};
+static const ScreenLine RELAY_FAULT_LINES[] = {
+    { 32, fmtRelayFault }, { 48, fmtI2CTag }, { 62, fmtRelayFaultAction }
+};
+static const ScreenLine INPUT_FAULT_LINES[] = {
+    { 32, fmtInputFault }, { 48, fmtI2CTag }, { 62, fmtInputFaultAction }
+};
+
+#define SCREEN(title, lines) { title, lines, sizeof(lines) / sizeof(lines[0]) }
+
+static const ScreenDef CONTOUR_SCREEN = SCREEN(fmtContourTitle, CONTOUR_LINES);
+static const ScreenDef AP_SCREEN = SCREEN(fmtApTitle, AP_LINES);
+static const ScreenDef RELAY_FAULT_SCREEN = SCREEN(fmtAlarmTitle, RELAY_FAULT_LINES);
+static const ScreenDef INPUT_FAULT_SCREEN = SCREEN(fmtAlarmTitle, INPUT_FAULT_LINES);
+
+// Общие страницы - листаются после страниц контуров
+static const ScreenDef COMMON_PAGES[] = {
+    SCREEN(fmtSystemTitle, SYSTEM_LINES)
+};
+static const uint8_t COMMON_PAGE_COUNT = sizeof(COMMON_PAGES) / sizeof(COMMON_PAGES[0]);
+
+int displayPageCount() {
+    return CONTOUR_COUNT + COMMON_PAGE_COUNT;
+}
+
+// --- Построение и передача кадра ---
+
+static void buildView(OledView& v, const ScreenDef& screen, const DisplaySnapshot& s, uint8_t cont, int page) {
+    memset(&v, 0, sizeof(v));
+    screen.title(s, cont, v.title, sizeof(v.title));
+    if (page > 0) snprintf(v.page, sizeof(v.page), "%u/%u", (uint8_t)page, (uint8_t)displayPageCount());
+    for (uint8_t i = 0; i < screen.lineCount && v.lineCount < OLED_VIEW_LINES; i++) {
+        if (screen.lines[i].fmt(s, cont, v.lines[v.lineCount], OLED_LINE_LEN)) {
+            v.lineY[v.lineCount++] = screen.lines[i].y;
+        } else {
+            memset(v.lines[v.lineCount], 0, OLED_LINE_LEN);
+        }
+    }
+}
+
+static void drawView(const OledView& v) {
+    u8g2.clearBuffer();
+    u8g2.setFont(u8g2_font_ncenB10_tr);
+    u8g2.drawStr(0, 12, v.title);
+    u8g2.setFont(u8g2_font_6x10_tf);
+    if (v.page[0]) u8g2.drawStr(110, 10, v.page);
+    for (uint8_t i = 0; i < v.lineCount; i++) {
+        u8g2.drawStr(0, v.lineY[i], v.lines[i]);
+    }
+}
+
+void updateDisplay() {
+    if (!isDisplayAvailable || !displayOn) return;
+
+    DisplaySnapshot snap;
+    collectSnapshot(snap);
+
+    OledView view;
+    if (!snap.relayBoardOk) {
+        buildView(view, RELAY_FAULT_SCREEN, snap, 0, 0);
+    } else if (!snap.inputBoardOk) {
+        buildView(view, INPUT_FAULT_SCREEN, snap, 0, 0);
+    } else if (currentScreen == SCREEN_WIFI_AP) {
+        buildView(view, AP_SCREEN, snap, 0, 0);
+    } else if (currentScreen >= 1 && currentScreen <= CONTOUR_COUNT) {
+        buildView(view, CONTOUR_SCREEN, snap, currentScreen - 1, currentScreen);
+    } else if (currentScreen > CONTOUR_COUNT && currentScreen <= displayPageCount()) {
+        buildView(view, COMMON_PAGES[currentScreen - CONTOUR_COUNT - 1], snap, 0, currentScreen);
+    } else {
+        return;
+    }
+
+    if (oledShownValid && memcmp(&view, &oledShown, sizeof(view)) == 0) return; // На экране то же самое
+
+    drawView(view);
+    oledTransferFailed = false;
+    u8g2.sendBuffer();
+    if (oledTransferFailed) {
+        // Кадр мог дойти частично - повторить при следующем вызове
+        oledShownValid = false;
+        return;
+    }
+    oledShown = view;
+    oledShownValid = true;
+}
@@ -0,0 +1,286 @@
+// =================================================================================
+// File:         src/event_log.cpp
+// Description:  Реализация журнала событий: кольцо без блокировок на
+//               несколько писателей и одного читателя (задача ui), перенос
+//               во flash и постраничный запрос /api/events.
+//
+//               Слот кольца хранит номер круга: писатель занимает номер
+//               позиции compare-exchange и помечает слот записанным только
+//               после копирования полей, читатель освобождает слот для
+//               следующего круга. Все счётчики - нулевые при старте, поэтому
+//               eventLog() можно звать до любой инициализации.
+// =================================================================================
+
+#include "event_log.h"
+#include "flash_log.h"
+#include "utils.h"
+#include "comfort.h"
+#include "json_writer.h"
+#include <atomic>
+
+#define EVT_RING_MASK (EVT_RING_SIZE - 1)
+#define EVT_PAYLOAD_BYTES 16                // unix u32, uptime u32, code, contour, arg u16, value u32
+#define EVT_QUERY_LIMIT 200
+#define EVT_QUERY_PAGES 32                  // Страниц flash на один запрос
+static_assert((EVT_RING_SIZE & EVT_RING_MASK) == 0, "EVT_RING_SIZE must be a power of two!");
+
+// Слот свободен для позиции pos, когда seq == круг(pos); записан - круг(pos) + 1
+struct EventSlot {
+    std::atomic<uint32_t> seq;
+    uint32_t ms;
+    uint8_t code;
+    uint8_t contour;
+    uint16_t arg;
+    uint32_t value;
+};
+
+static EventSlot ring[EVT_RING_SIZE];
+static std::atomic<uint32_t> writePos(0);
+static uint32_t readPos = 0;                // Только задача ui
+static std::atomic<uint32_t> loggedCount(0);
+static std::atomic<uint32_t> droppedCount(0);
+static uint32_t storedCount = 0;
+
+static const char* const EVT_NAMES[EVT_CODE_COUNT] = {
+    nullptr, "pump_state", "pump_alarm", "dry_run", "i2c_offline", "i2c_online", "valve_pulse", "valve", "suppressed",
+    "i2c_recovery"
+};
+
+static inline uint32_t lap(uint32_t pos) {
+    return pos & ~(uint32_t)EVT_RING_MASK;
+}
+
+void eventLog(EventCode code, uint8_t contour, uint16_t arg, uint32_t value) {
+    uint32_t pos = writePos.load(std::memory_order_relaxed);
+    EventSlot* slot;
+    while (true) {
+        slot = &ring[pos & EVT_RING_MASK];
+        int32_t diff = (int32_t)(slot->seq.load(std::memory_order_acquire) - lap(pos));
+        if (diff == 0) {
+            if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // Слот прошлого круга ещё не прочитан - кольцо полно
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = writePos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->ms = millis();
+    slot->code = code;
+    slot->contour = contour;
+    slot->arg = arg;
+    slot->value = value;
+    slot->seq.store(lap(pos) + 1, std::memory_order_release);
+    loggedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+static bool pop(EventSlot& out) {
+    EventSlot& slot = ring[readPos & EVT_RING_MASK];
+    if (slot.seq.load(std::memory_order_acquire) != lap(readPos) + 1) return false;
+    out.ms = slot.ms;
+    out.code = slot.code;
+    out.contour = slot.contour;
+    out.arg = slot.arg;
+    out.value = slot.value;
+    slot.seq.store(lap(readPos) + EVT_RING_SIZE, std::memory_order_release);
+    readPos++;
+    return true;
+}
+
+// --- Перенос во flash (задача ui) ---
+
+static void store(uint32_t unixTime, uint32_t uptime, uint8_t code, uint8_t contour, uint16_t arg, uint32_t value) {
+    uint8_t rec[EVT_PAYLOAD_BYTES];
+    putU32(rec, unixTime);
+    putU32(rec + 4, uptime);
+    rec[8] = code;
+    rec[9] = contour;
+    putU16(rec + 10, arg);
+    putU32(rec + 12, value);
+    if (flashLogAppend(FLOG_REC_EVENT, rec, sizeof(rec))) storedCount++;
+}
+
+// Сводка импульсов клапана контура за окно
+struct ValveWindow {
+    uint8_t opens, closes;
+    uint32_t openMs, closeMs;
+};
+static ValveWindow valves[CONTOUR_COUNT];
+static uint32_t valveWindowStart = 0;
+
+// Бюджет записи во flash (секунды - uptimeSeconds())
+static uint32_t tokens = EVT_FLASH_BURST;
+static uint32_t refillS = 0;
+static uint32_t suppressedPending = 0;
+static uint32_t suppressedCount = 0;
+static uint32_t lastSyncS = 0;
+static bool synced = false;
+
+static bool takeToken() {
+    if (!tokens) return false;
+    tokens--;
+    return true;
+}
+
+static void storeValveWindows(uint32_t unixTime, uint32_t uptime) {
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        ValveWindow& v = valves[c];
+        if (!v.opens && !v.closes) continue;
+        uint32_t openUnits = (v.openMs / 100 > 0xFFFF) ? 0xFFFF : v.openMs / 100;
+        uint32_t closeUnits = (v.closeMs / 100 > 0xFFFF) ? 0xFFFF : v.closeMs / 100;
+        store(unixTime, uptime, EVT_VALVE_SUMMARY, c + 1, (uint16_t)((v.opens << 8) | v.closes), (openUnits << 16) | closeUnits);
+        v = ValveWindow();
+    }
+}
+
+void eventLogDrain() {
+    uint32_t nowMs = millis();
+    uint32_t uptime = uptimeSeconds();
+    uint32_t unixNow = 0;
+    bool haveUnix = comfortUnixTime(unixNow);
+    bool sync = false;
+
+    uint32_t gained = (uptime - refillS) / EVT_FLASH_REFILL_S;
+    if (gained) {
+        tokens = (tokens + gained > EVT_FLASH_BURST) ? EVT_FLASH_BURST : tokens + gained;
+        refillS += gained * EVT_FLASH_REFILL_S;
+    }
+
+    EventSlot e;
+    while (pop(e)) {
+        if (e.code == EVT_VALVE_PULSE) {
+            if (e.contour < 1 || e.contour > CONTOUR_COUNT) continue;
+            ValveWindow& v = valves[e.contour - 1];
+            if (e.arg) { if (v.opens < 0xFF) v.opens++; v.openMs += e.value; }
+            else { if (v.closes < 0xFF) v.closes++; v.closeMs += e.value; }
+            continue;
+        }
+        if (!takeToken()) {
+            suppressedPending++;
+            suppressedCount++;
+            continue;
+        }
+        // Метка времени - по возрасту события относительно "сейчас"
+        uint32_t ageS = (nowMs - e.ms) / 1000;
+        uint32_t unixTime = (haveUnix && unixNow > ageS) ? unixNow - ageS : 0;
+        store(unixTime, uptime > ageS ? uptime - ageS : 0, e.code, e.contour, e.arg, e.value);
+        if (e.code == EVT_PUMP_ALARM || (e.code == EVT_DRY_RUN && e.arg) ||
+            (e.code == EVT_PUMP_STATE && e.arg == S_ALL_PUMPS_ALARM)) sync = true;
+    }
+
+    if (uptime - valveWindowStart >= EVT_VALVE_WINDOW_S) {
+        storeValveWindows(haveUnix ? unixNow : 0, uptime);
+        if (suppressedPending) {
+            store(haveUnix ? unixNow : 0, uptime, EVT_SUPPRESSED, 0, 0, suppressedPending);
+            suppressedPending = 0;
+        }
+        valveWindowStart = uptime;
+    }
+    // Аварии - во flash сразу, не дожидаясь заполнения страницы
+    if (sync && (!synced || uptime - lastSyncS >= EVT_SYNC_MIN_S)) {
+        flashLogSync();
+        lastSyncS = uptime;
+        synced = true;
+    }
+}
+
+EventLogInfo eventLogInfo() {
+    EventLogInfo info;
+    info.logged = loggedCount.load(std::memory_order_relaxed);
+    info.dropped = droppedCount.load(std::memory_order_relaxed);
+    info.stored = storedCount;
+    info.suppressed = suppressedCount;
+    return info;
+}
+
+// --- Запрос (задача web) ---
+
+static FlashLogCursor query;
+
+// Коды из списка "pump_alarm,dry_run" в битовую маску; 0 - неизвестное имя
+static uint32_t parseCodes(const String& csv) {
+    uint32_t mask = 0;
+    int start = 0;
+    while (start >= 0) {
+        int comma = csv.indexOf(',', start);
+        String tok = (comma < 0) ? csv.substring(start) : csv.substring(start, comma);
+        tok.trim();
+        uint8_t code = 1;
+        while (code < EVT_CODE_COUNT && tok != EVT_NAMES[code]) code++;
+        if (code == EVT_CODE_COUNT) return 0;
+        mask |= 1UL << code;
+        if (comma < 0) break;
+        start = comma + 1;
+    }
+    return mask;
+}
+
+void handleEvents() {
+    bool ranged = server.hasArg("from") || server.hasArg("to");
+    uint32_t from = (uint32_t)server.arg("from").toInt();
+    uint32_t to = server.hasArg("to") ? (uint32_t)server.arg("to").toInt() : UINT32_MAX;
+    uint32_t codeMask = server.hasArg("code") ? parseCodes(server.arg("code")) : UINT32_MAX;
+    int contour = server.hasArg("contour") ? server.arg("contour").toInt() : -1;
+    long limit = server.hasArg("limit") ? server.arg("limit").toInt() : 50;
+    if (limit < 1) limit = 1;
+    if (limit > EVT_QUERY_LIMIT) limit = EVT_QUERY_LIMIT;
+    if (from > to || !codeMask) {
+        server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad query\"}");
+        return;
+    }
+
+    if (server.hasArg("cursor")) {
+        unsigned long seq;
+        unsigned page, pos;
+        if (sscanf(server.arg("cursor").c_str(), "%lu.%u.%u", &seq, &page, &pos) != 3 ||
+            page >= FLOG_SEG_PAGES || pos >= FLOG_PAGE_BYTES) {
+            server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad cursor\"}");
+            return;
+        }
+        query.seq = seq;
+        query.page = (uint8_t)page;
+        query.pos = (uint16_t)pos;
+        query.loaded = false;
+    } else {
+        flashLogRewind(query);
+    }
+    query.pagesRead = 0;
+
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.beginArray("events");
+    long count = 0;
+    bool more = true;
+    uint8_t type, len;
+    const uint8_t* d;
+    while (count < limit && query.pagesRead < EVT_QUERY_PAGES) {
+        if (!flashLogNext(query, type, d, len)) {
+            more = false;
+            break;
+        }
+        if (type != FLOG_REC_EVENT || len != EVT_PAYLOAD_BYTES) continue;
+        uint32_t unixTime = getU32(d);
+        uint8_t code = d[8];
+        if (code >= EVT_CODE_COUNT || !(codeMask & (1UL << code))) continue;
+        if (contour >= 0 && d[9] != contour) continue;
+        if (ranged && (unixTime == 0 || unixTime < from || unixTime > to)) continue;
+        w.beginObject();
+        w.field("t", (unsigned long)unixTime);
+        w.field("up", (unsigned long)getU32(d + 4));
+        w.field("boot", (unsigned)query.boot);
+        w.field("code", EVT_NAMES[code]);
+        w.field("contour", (unsigned)d[9]);
+        w.field("arg", (unsigned)getU16(d + 10));
+        w.field("value", (unsigned long)getU32(d + 12));
+        w.endObject();
+        count++;
+    }
+    w.endArray();
+    char next[32];
+    snprintf(next, sizeof(next), "%lu.%u.%u", (unsigned long)query.seq, (unsigned)query.page, (unsigned)query.pos);
+    w.field("next", next);
+    w.field("more", more);
+    w.endObject();
+}
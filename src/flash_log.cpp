@@ -0,0 +1,379 @@
+// =================================================================================
+// File:         src/flash_log.cpp
+// Description:  Реализация журнала во flash: страница в ОЗУ, запись целыми
+//               страницами по кругу сегментов, восстановление хвоста при
+//               включении и потоковая выгрузка /api/flashlog (задача web).
+//               Позиция записи и страница в ОЗУ меняются под спинлоком
+//               flogMux; выгрузка читает из flash только уже записанные
+//               страницы, а текущую копирует из ОЗУ.
+// =================================================================================
+
+#include "flash_log.h"
+#include "utils.h"
+#include "tasks.h"
+#include "sensors.h"
+#include "pid_control.h"
+#include "comfort.h"
+#include "stream_export.h"
+#include <esp_partition.h>
+
+#define FLOG_MAGIC 0x4C57                   // "WL"
+#define FLOG_HDR_BYTES 10                   // magic u16, boot u16, seq u32, crc16
+#define FLOG_REC_OVERHEAD 4                 // len, type, crc16
+#define FLOG_NONE TEMP_NONE
+#define FLOG_ROW_MAX 200                    // Самая длинная строка CSV
+#define FLOG_SNAPSHOT_BYTES (8 + 2 * OW_VAR_COUNT + 4 * CONTOUR_COUNT)
+static_assert(FLOG_SNAPSHOT_BYTES + FLOG_REC_OVERHEAD <= FLOG_PAGE_BYTES - FLOG_HDR_BYTES, "Snapshot does not fit a page!");
+static_assert(FLOG_PAGE_BYTES * FLOG_SEG_PAGES == SPI_FLASH_SEC_SIZE, "Segment must be one flash sector!");
+
+static const esp_partition_t* part = nullptr;
+static uint32_t segCount = 0;
+static uint16_t bootId = 0;
+static portMUX_TYPE flogMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Позиция записи (под flogMux): страница в ОЗУ ляжет в сегмент curSeq,
+// на место curPage. Номера сегментов растут, сектор - seq % segCount.
+static uint32_t curSeq = 0;
+static uint8_t curPage = 0;
+static uint8_t ramPage[FLOG_PAGE_BYTES];
+static uint16_t ramLen = 0;
+
+static FlashLogInfo stats = {};
+
+// --- Разметка страницы ---
+
+// CRC-16/CCITT-FALSE
+static uint16_t crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+static bool parseHeader(const uint8_t* page, uint16_t& boot, uint32_t& seq) {
+    if (getU16(page) != FLOG_MAGIC || getU16(page + 8) != crc16(page, 8)) return false;
+    boot = getU16(page + 2);
+    seq = getU32(page + 4);
+    return seq != 0;
+}
+
+static bool isErased(const uint8_t* p, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+static size_t pageOffset(uint32_t seq, uint8_t page) {
+    return (size_t)(seq % segCount) * SPI_FLASH_SEC_SIZE + (size_t)page * FLOG_PAGE_BYTES;
+}
+
+// Новая страница в ОЗУ: заголовок текущей позиции, остальное - "стёрто" (под flogMux)
+static void ramReset() {
+    memset(ramPage, 0xFF, sizeof(ramPage));
+    putU16(ramPage, FLOG_MAGIC);
+    putU16(ramPage + 2, bootId);
+    putU32(ramPage + 4, curSeq);
+    putU16(ramPage + 8, crc16(ramPage, 8));
+    ramLen = FLOG_HDR_BYTES;
+}
+
+// --- Запись (задача ui) ---
+
+void flashLogInit() {
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, NULL);
+    if (!part || part->size < 2 * SPI_FLASH_SEC_SIZE) {
+        part = nullptr;
+        Serial.println("[FLOG] Раздел данных не найден, журнал во flash отключён");
+        return;
+    }
+    segCount = part->size / SPI_FLASH_SEC_SIZE;
+
+    // Хвост: старший номер сегмента по заголовкам первых страниц секторов
+    uint8_t page[FLOG_PAGE_BYTES];
+    uint32_t headSeq = 0;
+    uint16_t maxBoot = 0;
+    uint16_t boot;
+    uint32_t seq;
+    for (uint32_t s = 0; s < segCount; s++) {
+        if (esp_partition_read(part, (size_t)s * SPI_FLASH_SEC_SIZE, page, FLOG_HDR_BYTES) != ESP_OK) continue;
+        if (!parseHeader(page, boot, seq) || seq % segCount != s) continue;
+        if (seq > headSeq) headSeq = seq;
+        if (boot > maxBoot) maxBoot = boot;
+    }
+
+    if (headSeq == 0) {
+        curSeq = 1;
+        curPage = 0;
+    } else {
+        // Первая чистая страница сегмента; недописанная (питание пропало во
+        // время записи) считается занятой - её записи отсеет CRC
+        curSeq = headSeq;
+        curPage = FLOG_SEG_PAGES;
+        for (uint8_t p = 1; p < FLOG_SEG_PAGES; p++) {
+            if (esp_partition_read(part, pageOffset(headSeq, p), page, sizeof(page)) != ESP_OK) continue;
+            if (isErased(page, sizeof(page))) {
+                curPage = p;
+                break;
+            }
+            if (parseHeader(page, boot, seq) && boot > maxBoot) maxBoot = boot;
+        }
+        if (curPage == FLOG_SEG_PAGES) {
+            curSeq++;
+            curPage = 0;
+        }
+    }
+    bootId = maxBoot + 1;
+    ramReset();
+
+    stats.available = true;
+    stats.bootId = bootId;
+    stats.segments = segCount;
+    Serial.printf("[FLOG] Журнал: %u сегментов, загрузка %u, запись с сегмента %lu страницы %u\n",
+                  (unsigned)segCount, (unsigned)bootId, (unsigned long)curSeq, (unsigned)curPage);
+}
+
+// Страница в ОЗУ - во flash (заполнена или flashLogSync()); первая страница
+// сегмента сначала стирает его сектор
+static void flushPage() {
+    size_t offset = pageOffset(curSeq, curPage);
+    if (curPage == 0) {
+        if (esp_partition_erase_range(part, offset, SPI_FLASH_SEC_SIZE) == ESP_OK) stats.erases++;
+        else stats.errors++;
+    }
+    if (esp_partition_write(part, offset, ramPage, sizeof(ramPage)) == ESP_OK) stats.pagesWritten++;
+    else stats.errors++;
+
+    portENTER_CRITICAL(&flogMux);
+    if (++curPage == FLOG_SEG_PAGES) {
+        curSeq++;
+        curPage = 0;
+    }
+    ramReset();
+    portEXIT_CRITICAL(&flogMux);
+}
+
+bool flashLogAppend(uint8_t type, const uint8_t* data, uint8_t len) {
+    if (!part || len == 0xFF || len + FLOG_REC_OVERHEAD > FLOG_PAGE_BYTES - FLOG_HDR_BYTES) return false;
+    if (ramLen + len + FLOG_REC_OVERHEAD > FLOG_PAGE_BYTES) flushPage();
+
+    uint8_t rec[FLOG_PAGE_BYTES];
+    rec[0] = len;
+    rec[1] = type;
+    memcpy(rec + 2, data, len);
+    putU16(rec + 2 + len, crc16(rec, 2 + len));
+
+    portENTER_CRITICAL(&flogMux);
+    memcpy(ramPage + ramLen, rec, len + FLOG_REC_OVERHEAD);
+    ramLen += len + FLOG_REC_OVERHEAD;
+    portEXIT_CRITICAL(&flogMux);
+    stats.records++;
+    return true;
+}
+
+void flashLogSync() {
+    if (part && ramLen > FLOG_HDR_BYTES) flushPage();
+}
+
+// Снимок: unix u32, uptime u32, температуры i16 (1/16 °C), по контуру -
+// уставка i16, состояние u8, флаги u8 (активный насос, лето, статусы p1/p2)
+void flashLogTick() {
+    if (!part) return;
+    uint8_t rec[FLOG_SNAPSHOT_BYTES];
+    uint8_t* p = rec;
+    uint32_t unixTime = 0;
+    comfortUnixTime(unixTime);
+    putU32(p, unixTime); p += 4;
+    putU32(p, uptimeSeconds()); p += 4;
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+        bool alarm;
+        float t = getTempByVar(OW_VARS[i], alarm);
+        putU16(p, (uint16_t)(alarm ? FLOG_NONE : quantizeTemp(t))); p += 2;
+    }
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        bool comfort;
+        float reduction;
+        putU16(p, (uint16_t)quantizeTemp(calculateSetpoint(c + 1, comfort, reduction))); p += 2;
+        const ContourPumpLogic& logic = pumpLogic[c];
+        *p++ = (uint8_t)logic.state;
+        *p++ = (uint8_t)((logic.activePumpIndex ? 0x01 : 0) | (logic.summer_mode_active ? 0x02 : 0) |
+                         (((uint8_t)logic.pumps[0].status & 0x03) << 2) | (((uint8_t)logic.pumps[1].status & 0x03) << 4));
+    }
+    flashLogAppend(FLOG_REC_SNAPSHOT, rec, sizeof(rec));
+}
+
+FlashLogInfo flashLogInfo() {
+    portENTER_CRITICAL(&flogMux);
+    FlashLogInfo info = stats;
+    info.headSeq = curSeq;
+    portEXIT_CRITICAL(&flogMux);
+    return info;
+}
+
+// --- Чтение (задача web) ---
+
+void flashLogRewind(FlashLogCursor& c) {
+    portENTER_CRITICAL(&flogMux);
+    c.seq = curSeq >= segCount ? curSeq - segCount + 1 : 1;
+    portEXIT_CRITICAL(&flogMux);
+    c.page = 0;
+    c.pos = 0;
+    c.loaded = false;
+    c.pagesRead = 0;
+}
+
+static void nextPage(FlashLogCursor& c) {
+    if (++c.page == FLOG_SEG_PAGES) {
+        c.seq++;
+        c.page = 0;
+    }
+    c.pos = 0;
+    c.loaded = false;
+}
+
+// Страница курсора в c.buf: записанная - из flash, текущая - копия из ОЗУ.
+// false - курсор дошёл до позиции записи и страница ОЗУ уже прочитана.
+static bool loadPage(FlashLogCursor& c) {
+    while (true) {
+        portENTER_CRITICAL(&flogMux);
+        if (c.seq + segCount <= curSeq) {
+            // Сегмент затёрт, пока курсор ждал, - продолжить с самого старого
+            c.seq = curSeq - segCount + 1;
+            c.page = 0;
+            c.pos = 0;
+        }
+        bool ahead = c.seq > curSeq || (c.seq == curSeq && c.page > curPage);
+        bool current = c.seq == curSeq && c.page == curPage;
+        if (current) memcpy(c.buf, ramPage, sizeof(c.buf));
+        portEXIT_CRITICAL(&flogMux);
+        if (ahead) return false;
+
+        if (!current) {
+            c.pagesRead++;
+            if (esp_partition_read(part, pageOffset(c.seq, c.page), c.buf, sizeof(c.buf)) != ESP_OK) {
+                nextPage(c);
+                continue;
+            }
+        }
+        uint32_t hdrSeq;
+        if (!parseHeader(c.buf, c.boot, hdrSeq) || hdrSeq != c.seq) {
+            // Сегмент не дописан или затёрт новым - пропускаем целиком
+            if (c.page == 0) c.page = FLOG_SEG_PAGES - 1;
+            nextPage(c);
+            continue;
+        }
+        c.fromRam = current;
+        c.loaded = true;
+        if (c.pos < FLOG_HDR_BYTES) c.pos = FLOG_HDR_BYTES;
+        return true;
+    }
+}
+
+bool flashLogNext(FlashLogCursor& c, uint8_t& type, const uint8_t*& data, uint8_t& len) {
+    if (!part) return false;
+    while (true) {
+        if (!c.loaded && !loadPage(c)) return false;
+        uint16_t pos = c.pos;
+        bool end = pos + FLOG_REC_OVERHEAD > FLOG_PAGE_BYTES || c.buf[pos] == 0xFF;
+        if (!end) {
+            uint8_t recLen = c.buf[pos];
+            if (pos + recLen + FLOG_REC_OVERHEAD > FLOG_PAGE_BYTES ||
+                getU16(c.buf + pos + 2 + recLen) != crc16(c.buf + pos, 2 + recLen)) {
+                // Длине битой записи верить нельзя - остаток страницы пропускается
+                portENTER_CRITICAL(&flogMux);
+                stats.crcErrors++;
+                portEXIT_CRITICAL(&flogMux);
+                end = true;
+            } else {
+                type = c.buf[pos + 1];
+                data = c.buf + pos + 2;
+                len = recLen;
+                c.pos = pos + recLen + FLOG_REC_OVERHEAD;
+                return true;
+            }
+        }
+        if (c.fromRam) {
+            // Конец записанного: позиция остаётся, новые записи дочитаются потом
+            c.loaded = false;
+            return false;
+        }
+        nextPage(c);
+    }
+}
+
+// --- Выгрузка снимков (задача web) ---
+
+struct FlogExport {
+    bool header;                    // Строка заголовка CSV ещё не выдана
+    bool ranged;                    // Заданы from/to
+    uint32_t from, to;
+    FlashLogCursor cur;
+};
+static FlogExport xfer;
+
+static void writeTemp(char* buf, size_t cap, size_t& len, const uint8_t* p) {
+    int16_t v = (int16_t)getU16(p);
+    if (v == FLOG_NONE) exportAppend(buf, cap, len, ",");
+    else exportAppend(buf, cap, len, ",%.2f", v / 16.0f);
+}
+
+static void writeSnapshot(char* buf, size_t cap, size_t& len, const uint8_t* d) {
+    uint32_t unixTime = getU32(d);
+    if (xfer.ranged && (unixTime == 0 || unixTime < xfer.from || unixTime > xfer.to)) return;
+    exportAppend(buf, cap, len, "%lu,%lu,%u", (unsigned long)unixTime, (unsigned long)getU32(d + 4), (unsigned)xfer.cur.boot);
+    const uint8_t* p = d + 8;
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++, p += 2) writeTemp(buf, cap, len, p);
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++, p += 4) {
+        writeTemp(buf, cap, len, p);
+        uint8_t flags = p[3];
+        exportAppend(buf, cap, len, ",%u,%u,%u,%u,%u", (unsigned)p[2], (unsigned)(flags & 0x01),
+                     (unsigned)((flags >> 1) & 0x01), (unsigned)((flags >> 2) & 0x03), (unsigned)((flags >> 4) & 0x03));
+    }
+    exportAppend(buf, cap, len, "\n");
+}
+
+static bool fill(char* buf, size_t cap, size_t& len) {
+    if (xfer.header) {
+        xfer.header = false;
+        exportAppend(buf, cap, len, "unix,uptime,boot");
+        for (uint8_t i = 0; i < OW_VAR_COUNT; i++) exportAppend(buf, cap, len, ",%s", OW_VARS[i]);
+        for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) {
+            exportAppend(buf, cap, len, ",c%u.tzavd,c%u.state,c%u.active,c%u.summer,c%u.p1,c%u.p2",
+                         c, c, c, c, c, c);
+        }
+        exportAppend(buf, cap, len, "\n");
+    }
+    uint8_t type, recLen;
+    const uint8_t* data;
+    while (len + FLOG_ROW_MAX < cap) {
+        if (!flashLogNext(xfer.cur, type, data, recLen)) return true;
+        if (type == FLOG_REC_SNAPSHOT && recLen == FLOG_SNAPSHOT_BYTES) writeSnapshot(buf, cap, len, data);
+    }
+    return false;
+}
+
+void handleFlashLog() {
+    if (!part) {
+        server.send(503, "application/json", "{\"ok\":false,\"err\":\"no_partition\"}");
+        return;
+    }
+    if (!exportAvailable()) return;
+    xfer.ranged = server.hasArg("from") || server.hasArg("to");
+    xfer.from = (uint32_t)server.arg("from").toInt();
+    xfer.to = server.hasArg("to") ? (uint32_t)server.arg("to").toInt() : UINT32_MAX;
+    if (xfer.from > xfer.to) {
+        server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad range\"}");
+        return;
+    }
+
+    flashLogRewind(xfer.cur);
+    xfer.header = true;
+
+    char head[160];
+    size_t len = 0;
+    exportAppend(head, sizeof(head), len, "HTTP/1.1 200 OK\r\nContent-Type: text/csv\r\nCache-Control: no-cache\r\n"
+                 "X-Flog-Boot: %u\r\n", (unsigned)bootId);
+    exportBegin(head, fill);
+}
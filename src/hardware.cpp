@@ -1,22 +1,36 @@
 // =================================================================================
 // File:         src/hardware.cpp
 // Description:  Реализация функций для работы с аппаратной частью.
-//               Управление реле, чтение входов, работа с дисплеем и RTC.
+//               Образ реле, часы DS3231, кнопка, реакция на
+//               пропадание и возврат I2C-устройств (шина - i2c_bus.h).
+//               Экраны OLED - в display.cpp.
 // =================================================================================
 
 #include "config.h"
 #include "hardware.h"
 #include "definitions.h"
+#include "sensors.h"
+#include "pid_control.h"
+#include "pump_control.h"
+#include "utils.h"
+#include "settings.h"
+#include "comfort.h"
+#include "tasks.h"
+#include "scheduler.h"
+#include "inputs.h"
+#include "display.h"
+#include "i2c_bus.h"
+#include "io_expanders.h"
 
 // --- Глобальные переменные ---
-uint8_t displayErrorCounter = 0;
-uint8_t relayErrorCounter = 0;
-uint8_t inputErrorCounter = 0;
-uint8_t rtcErrorCounter = 0;
-const uint8_t I2C_ERROR_THRESHOLD = 5;
+static int8_t rtcDev = -1;
 
-unsigned long lastI2CRecoveryAttempt = 0;
-const unsigned long I2C_RECOVERY_INTERVAL = 15000; // 15 секунд
+// Логический образ реле. relayStates - теневой регистр: setRelay() и импульсы
+// меняют только его, а commitRelays() в конце такта задачи control
+// раскладывает его по платам (RELAY_MAP) и пишет каждую изменившуюся плату
+// одной транзакцией.
+static uint16_t relayCommitted[IO_BOARD_COUNT];
+static bool relayCommitValid[IO_BOARD_COUNT]; // false - записать при следующем commit (старт, восстановление, ошибка)
 
 // Для кнопки
 int buttonState = LOW;
@@ -26,36 +40,40 @@ unsigned long debounceDelay = 50;
 unsigned long buttonPressStartTime = 0;
 bool longPressTriggered = false;
 
-// Прототипы функций, которые используются только внутри этого файла
-void drawI2CFaultScreen(const char* line1, const char* line2, const char* line3);
-void drawContour1Screen();
-void drawContour2Screen();
-void drawSystemScreen();
-void drawWifiAPScreen();
-
 // --- Функции ---
 
 void setRelay(int relayIndex, bool on) {
+    if (relayIndex < 0 || relayIndex >= RELAY_COUNT) return;
+    MutexLock lock(ioMutex);
+    uint32_t prev = relayStates;
     if (on) {
-        bitClear(relayStates, relayIndex);
+        relayStates |= 1UL << relayIndex;
     } else {
-        bitSet(relayStates, relayIndex);
+        relayStates &= ~(1UL << relayIndex);
+    }
+    if (relayStates != prev) tasksWakeRelays();
+}
+
+// Все ли платы с реле отвечают
+static bool relayBoardsOnline() {
+    for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) {
+        if (IO_BOARDS[b].outputs && !ioBoardOnline(b)) return false;
     }
-    updateRelays();
+    return true;
 }
 
 void initializeHardware() {
     pinMode(BUTTON_PIN, INPUT_PULLDOWN);
-    Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
-    
-    Serial.println("Scanning I2C bus...");
-    Wire.beginTransmission(PCF8574_INPUTS_ADDR);
-    if (Wire.endTransmission() == 0) { isInputExpanderAvailable = true; Serial.println("Input Expander (0x22) ... ONLINE"); } else { Serial.println("Input Expander (0x22) ... OFFLINE"); }
-    Wire.beginTransmission(RELAY_I2C_ADDR);
-    if (Wire.endTransmission() == 0) { isRelayExpanderAvailable = true; Serial.println("Relay Expander (0x24) ... ONLINE"); } else { Serial.println("Relay Expander (0x24) ... OFFLINE"); }
-    Wire.beginTransmission(OLED_ADDR);
-    if (Wire.endTransmission() == 0) { isDisplayAvailable = true; Serial.println("OLED Display (0x3C) ... ONLINE"); } else { Serial.println("OLED Display (0x3C) ... OFFLINE"); }
-    if (rtc.begin()) { isRtcAvailable = true; Serial.println("RTC DS3231 ... ONLINE"); } else { Serial.println("RTC DS3231 ... OFFLINE"); }
+    // Устройства шины: таймаут - с запасом на самую длинную транзакцию
+    ioBoardsInit();
+    inputsInit();
+    rtcDev = i2cRegister(RTC_I2C_ADDR, "rtc", 400000, 5);
+    displayInit();
+    i2cBusInit();
+    isInputExpanderAvailable = inputsOnline();
+    isRelayExpanderAvailable = relayBoardsOnline();
+    isDisplayAvailable = displayLinkOnline();
+    isRtcAvailable = i2cOnline(rtcDev);
 
     if (isDisplayAvailable) {
         u8g2.begin();
@@ -74,45 +92,71 @@ void initializeHardware() {
         delay(2000);
     }
 
-    updateRelays(); // Устанавливаем начальное состояние реле
+    commitRelays(); // Устанавливаем начальное состояние реле
 }
 
 void loadNvsSettings() {
-    prefs.begin("owmap", false);
-    prefsProfiles.begin("profiles", false);
-    prefsParams.begin("params", false);
-    prefsGeneral.begin("general", false);
-    globalPumpEnableMask = prefsGeneral.getUChar("pumpEnableMask", 0b1111);
+    settingsLoad();
 }
 
+// Ошибки, offline и пробы с паузой ведёт менеджер шины; здесь - реакция
+// остальной прошивки на смену доступности устройства
 void manageI2CDevices() {
-    if (isDisplayAvailable && displayErrorCounter >= I2C_ERROR_THRESHOLD) isDisplayAvailable = false;
-    if (isRelayExpanderAvailable && relayErrorCounter >= I2C_ERROR_THRESHOLD) isRelayExpanderAvailable = false;
-    if (isInputExpanderAvailable && inputErrorCounter >= I2C_ERROR_THRESHOLD) isInputExpanderAvailable = false;
-    if (isRtcAvailable && rtcErrorCounter >= I2C_ERROR_THRESHOLD) isRtcAvailable = false;
-    
-    if ((!isDisplayAvailable || !isRelayExpanderAvailable || !isInputExpanderAvailable || !isRtcAvailable) && (millis() - lastI2CRecoveryAttempt > I2C_RECOVERY_INTERVAL)) {
-        lastI2CRecoveryAttempt = millis();
-        if (!isDisplayAvailable) {
-            Wire.beginTransmission(OLED_ADDR);
-            if (Wire.endTransmission() == 0) { isDisplayAvailable = true; displayErrorCounter = 0; u8g2.begin(); }
+    i2cBusTick();
+
+    bool display = displayLinkOnline();
+    if (display != isDisplayAvailable) {
+        isDisplayAvailable = display;
+        if (display) {
+            u8g2.begin();
+            displayInvalidate(); // begin() очищает экран
         }
-        if (!isRelayExpanderAvailable) {
-            Wire.beginTransmission(RELAY_I2C_ADDR);
-            if (Wire.endTransmission() == 0) {
-                isRelayExpanderAvailable = true; relayErrorCounter = 0;
-                pidController1.integralSum = 0; pidController2.integralSum = 0;
-                pumpLogic1.state = S_IDLE; pumpLogic2.state = S_IDLE;
+    }
+    bool relays = relayBoardsOnline();
+    if (relays != isRelayExpanderAvailable) {
+        if (relays) {
+            MutexLock lock(ioMutex);
+            // Состояние выходов после сбоя неизвестно - перезаписать
+            for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) relayCommitValid[b] = false;
+            // pidControllers и pumpLogic меняет только задача control - через запросы
+            for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) {
+                pidRequestReset(c);
+                pumpLogicRequestIdle(c);
             }
         }
-        if (!isInputExpanderAvailable) {
-            Wire.beginTransmission(PCF8574_INPUTS_ADDR);
-            if (Wire.endTransmission() == 0) { isInputExpanderAvailable = true; inputErrorCounter = 0; }
-        }
-        if (!isRtcAvailable) {
-            if (rtc.begin()) { isRtcAvailable = true; rtcErrorCounter = 0; }
-        }
+        isRelayExpanderAvailable = relays;
+        if (relays) tasksWakeRelays();
     }
+    isInputExpanderAvailable = inputsOnline();
+    isRtcAvailable = i2cOnline(rtcDev);
+}
+
+// --- Часы DS3231 ---
+
+static uint8_t bcd2bin(uint8_t v) { return v - 6 * (v >> 4); }
+static uint8_t bin2bcd(uint8_t v) { return v + 6 * (v / 10); }
+
+bool rtcRead(DateTime& dt) {
+    const uint8_t reg = 0x00;
+    uint8_t r[7];
+    if (i2cTransfer(rtcDev, &reg, 1, r, sizeof(r)) != I2C_OK) return false;
+    dt = DateTime((uint16_t)(bcd2bin(r[6]) + 2000U), bcd2bin(r[5] & 0x7F), bcd2bin(r[4]),
+                  bcd2bin(r[2]), bcd2bin(r[1]), bcd2bin(r[0] & 0x7F));
+    return true;
+}
+
+bool rtcAdjust(const DateTime& dt) {
+    uint8_t dow = dt.dayOfTheWeek();
+    const uint8_t time[8] = { 0x00, bin2bcd(dt.second()), bin2bcd(dt.minute()), bin2bcd(dt.hour()),
+                              bin2bcd(dow ? dow : 7), bin2bcd(dt.day()), bin2bcd(dt.month()),
+                              bin2bcd((uint8_t)(dt.year() - 2000U)) };
+    if (i2cWrite(rtcDev, time, sizeof(time)) != I2C_OK) return false;
+    // Снять OSF (0x0F, бит 7): время установлено
+    const uint8_t statusReg = 0x0F;
+    uint8_t status;
+    if (i2cTransfer(rtcDev, &statusReg, 1, &status, 1) != I2C_OK) return false;
+    const uint8_t clear[2] = { statusReg, (uint8_t)(status & ~0x80) };
+    return i2cWrite(rtcDev, clear, sizeof(clear)) == I2C_OK;
 }
 
 void handleButton() {
@@ -136,7 +180,7 @@ void handleButton() {
                             currentScreen = 1;
                         } else {
                             currentScreen++;
-                            if (currentScreen > 3) {
+                            if (currentScreen > displayPageCount()) {
                                 currentScreen = 1;
                             }
                         }
@@ -149,16 +193,16 @@ void handleButton() {
     if (buttonState == HIGH && !longPressTriggered && (millis() - buttonPressStartTime > 5000)) {
         longPressTriggered = true;
         if (!apModeActive) {
-            apModeActive = true;
             WiFi.softAPConfig(apIP, apGW, apMASK);
             WiFi.softAP(AP_SSID, AP_PASS);
             server.begin();
+            apModeStartTime = millis();
+            apModeActive = true; // Флаг - последним: задача web начинает обслуживать сервер
             if (isDisplayAvailable) {
                 displayOn = true;
                 u8g2.setPowerSave(0);
             }
-            currentScreen = 4;
-            apModeStartTime = millis();
+            currentScreen = SCREEN_WIFI_AP;
             lastDisplayActivityTime = millis();
         }
     }
@@ -184,253 +228,73 @@ void checkDisplayTimeout() {
     }
 }
 
-void updateRelays() {
-    if (!isRelayExpanderAvailable) return;
-    Wire.beginTransmission(RELAY_I2C_ADDR);
-    Wire.write(relayStates);
-    if (Wire.endTransmission() != 0) {
-        if (relayErrorCounter < 255) relayErrorCounter++;
-    } else {
-        relayErrorCounter = 0;
+// Уровни выходов платы b для образа реле image
+static uint16_t relayLevels(uint8_t b, uint32_t image) {
+    const IoBoardDef& def = IO_BOARDS[b];
+    uint16_t levels = def.activeLow & def.outputs; // Все выключены
+    for (uint8_t r = 0; r < RELAY_COUNT; r++) {
+        if (RELAY_MAP[r].board == b && ((image >> r) & 1)) levels ^= (uint16_t)(1u << RELAY_MAP[r].bit);
     }
+    return levels;
 }
 
-void triggerRelayPulse(int relayIndex, unsigned long duration) {
-    if (relayIndex < 0 || relayIndex > 7) return;
-    int partnerIndex = relayIndex ^ 1;
-    if ((pulseEndTimes[partnerIndex] > 0 && (long)(millis() - pulseEndTimes[partnerIndex]) < 0) || (pulseEndTimes[relayIndex] > 0 && (long)(millis() - pulseEndTimes[relayIndex]) < 0)) {
-        return;
+bool commitRelays() {
+    MutexLock lock(ioMutex);
+    uint32_t image = relayStates;
+    bool ok = true;
+    for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) {
+        if (!IO_BOARDS[b].outputs) continue;
+        // Перезапись платы в offline - после восстановления в manageI2CDevices()
+        if (!ioBoardOnline(b)) continue;
+        uint16_t levels = relayLevels(b, image);
+        if (relayCommitValid[b] && levels == relayCommitted[b]) continue;
+
+        // Запись и обратное чтение одной транзакцией (io_expanders.h)
+        relayCommitValid[b] = ioBoardWrite(b, levels);
+        if (relayCommitValid[b]) relayCommitted[b] = levels;
+        else ok = false;
     }
-    bitClear(relayStates, relayIndex);
-    updateRelays();
-    pulseEndTimes[relayIndex] = millis() + duration;
+    return ok;
 }
 
-void checkRelayPulses() {
-    bool relaysChanged = false;
-    for (int i = 0; i < 8; i++) {
-        if (pulseEndTimes[i] != 0 && (long)(millis() - pulseEndTimes[i]) >= 0) {
-            bitSet(relayStates, i);
-            pulseEndTimes[i] = 0;
-            relaysChanged = true;
-        }
-    }
-    static uint8_t lastRelayStates = 0xFF;
-    if (relayStates != lastRelayStates || relaysChanged) {
-        updateRelays();
-        lastRelayStates = relayStates;
+// Реле другого направления того же клапана (-1 - реле не клапанное)
+static int valvePartner(int relayIndex) {
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        if (CONTOURS[c].valveOpenRelay == relayIndex) return CONTOURS[c].valveCloseRelay;
+        if (CONTOURS[c].valveCloseRelay == relayIndex) return CONTOURS[c].valveOpenRelay;
     }
+    return -1;
 }
 
-// --- Функции отрисовки для OLED ---
-// (Они остаются здесь, т.к. тесно связаны с железом - дисплеем)
-
-const char* getPumpStatusStringOLED(PumpStatus status) {
-    switch (status) {
-        case S_WORKING: return "WORK";
-        case S_ALARM:   return "ALARM";
-        case S_REPAIR:  return "REPAIR";
-        case S_OK:      
-        default:        return "OK";
-    }
-}
-
-void drawI2CFaultScreen(const char* line1, const char* line2, const char* line3) {
-    u8g2.firstPage();
-    do {
-        u8g2.setFont(u8g2_font_ncenB10_tr);
-        u8g2.drawStr(0, 12, "SYSTEM ALARM");
-        u8g2.setFont(u8g2_font_6x10_tf);
-        u8g2.drawStr(0, 32, line1);
-        u8g2.drawStr(0, 48, line2);
-        u8g2.drawStr(0, 62, line3);
-    } while (u8g2.nextPage());
-}
-
-void drawContour1Screen() {
-    char buffer[32];
-    u8g2.firstPage();
-    do {
-        String profileId = getProfileId(1);
-        int tileIdx = tileIndexById(profileId);
-        if(tileIdx < 0) tileIdx = TILE_CUSTOM_6;
-        
-        u8g2.setFont(u8g2_font_ncenB10_tr);
-        u8g2.drawStr(0, 12, profileId.substring(0, 5).c_str());
-
-        u8g2.setFont(u8g2_font_6x10_tf);
-        u8g2.drawStr(110, 10, "1/3");
-
-        const TileDef& tile = getTile(tileIdx);
-        bool tpod_al, tinv_al;
-        float tpod = getTempByVar(tile.TPOD, tpod_al);
-        float tinv = getTempByVar(tile.TINV, tinv_al);
-        
-        bool isComfort = false;
-        float comfortReduction = 0.0f;
-        float tzad = calculateSetpoint(1, isComfort, comfortReduction);
-
-        sprintf(buffer, "Tsup: %s%s", tpod_al ? "AL" : String(tpod, 1).c_str(), tpod_al ? "" : " C");
-        u8g2.drawStr(0, 24, buffer);
-        sprintf(buffer, "Tret: %s%s", tinv_al ? "AL" : String(tinv, 1).c_str(), tinv_al ? "" : " C");
-        u8g2.drawStr(0, 34, buffer);
-
-        if (pumpLogic1.summer_mode_active) {
-            sprintf(buffer, "Tset: SUMMER");
-        } else if (isComfort) {
-            sprintf(buffer, "Tset: %sC(%.1f)", isnan(tzad) ? "--.-" : String(tzad, 1).c_str(), comfortReduction);
-        } else {
-            sprintf(buffer, "Tset: %s C", isnan(tzad) ? "--.-" : String(tzad, 1).c_str());
-        }
-        u8g2.drawStr(0, 44, buffer);
-        
-        const char* p1_status = getPumpStatusStringOLED(pumpLogic1.pumps[0].status);
-        const char* p2_status = getPumpStatusStringOLED(pumpLogic1.pumps[1].status);
-        if (pumpLogic1.state == S_ALL_PUMPS_ALARM) {
-             sprintf(buffer, "PUMPS: ALARM");
-        } else {
-             sprintf(buffer, "P1:%s  P2:%s", p1_status, p2_status);
-        }
-        u8g2.drawStr(0, 54, buffer);
-        
-        sprintf(buffer, "DryRun: %s", dry_run_state_stable ? "OK" : "ALARM");
-        u8g2.drawStr(0, 64, buffer);
-
-    } while (u8g2.nextPage());
+static bool pulseActive(int relayIndex) {
+    return pulseEndTimes[relayIndex] > 0 && (long)(millis() - pulseEndTimes[relayIndex]) < 0;
 }
 
-
-void drawContour2Screen() {
-    char buffer[32];
-    u8g2.firstPage();
-    do {
-        String profileId = getProfileId(2);
-        int tileIdx = tileIndexById(profileId);
-        if(tileIdx < 0) tileIdx = TILE_CUSTOM_6;
-
-        u8g2.setFont(u8g2_font_ncenB10_tr);
-        u8g2.drawStr(0, 12, profileId.substring(0, 5).c_str());
-
-        u8g2.setFont(u8g2_font_6x10_tf);
-        u8g2.drawStr(110, 10, "2/3");
-
-        const TileDef& tile = getTile(tileIdx);
-        bool tpod_al, tinv_al;
-        float tpod = getTempByVar(tile.TPOD, tpod_al);
-        float tinv = getTempByVar(tile.TINV, tinv_al);
-        
-        bool isComfort = false;
-        float comfortReduction = 0.0f;
-        float tzad = calculateSetpoint(2, isComfort, comfortReduction);
-
-        sprintf(buffer, "Tsup: %s%s", tpod_al ? "AL" : String(tpod, 1).c_str(), tpod_al ? "" : " C");
-        u8g2.drawStr(0, 24, buffer);
-        sprintf(buffer, "Tret: %s%s", tinv_al ? "AL" : String(tinv, 1).c_str(), tinv_al ? "" : " C");
-        u8g2.drawStr(0, 34, buffer);
-        
-        if (pumpLogic2.summer_mode_active) {
-            sprintf(buffer, "Tset: SUMMER");
-        } else if (isComfort) {
-            sprintf(buffer, "Tset: %sC(%.1f)", isnan(tzad) ? "--.-" : String(tzad, 1).c_str(), comfortReduction);
-        } else {
-            sprintf(buffer, "Tset: %s C", isnan(tzad) ? "--.-" : String(tzad, 1).c_str());
-        }
-        u8g2.drawStr(0, 44, buffer);
-
-        const char* p1_status = getPumpStatusStringOLED(pumpLogic2.pumps[0].status);
-        const char* p2_status = getPumpStatusStringOLED(pumpLogic2.pumps[1].status);
-        if (pumpLogic2.state == S_ALL_PUMPS_ALARM) {
-             sprintf(buffer, "PUMPS: ALARM");
-        } else {
-             sprintf(buffer, "P1:%s  P2:%s", p1_status, p2_status);
-        }
-        u8g2.drawStr(0, 54, buffer);
-
-        sprintf(buffer, "DryRun: %s", dry_run_state_2_stable ? "OK" : "ALARM");
-        u8g2.drawStr(0, 64, buffer);
-        
-    } while (u8g2.nextPage());
+void triggerRelayPulse(int relayIndex, unsigned long duration) {
+    if (relayIndex < 0 || relayIndex >= RELAY_COUNT) return;
+    MutexLock lock(ioMutex); // Вызывается и из задачи control, и из веб-обработчика
+    int partnerIndex = valvePartner(relayIndex);
+    if (pulseActive(relayIndex) || (partnerIndex >= 0 && pulseActive(partnerIndex))) return;
+    relayStates |= 1UL << relayIndex;
+    pulseEndTimes[relayIndex] = millis() + duration;
+    tasksWakeRelays(); // Запись и окончание импульса - в задаче control
 }
 
-void drawSystemScreen() {
-    char buffer[32];
-    u8g2.firstPage();
-    do {
-        u8g2.setFont(u8g2_font_ncenB10_tr);
-        u8g2.drawStr(0, 12, "System");
-
-        u8g2.setFont(u8g2_font_6x10_tf);
-        u8g2.drawStr(110, 10, "3/3");
-        
-        if (isRtcAvailable) {
-            DateTime now = rtc.now();
-            const char* days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-            sprintf(buffer, "Time: %02d:%02d (%s)", now.hour(), now.minute(), days[now.dayOfTheWeek()]);
-            u8g2.drawStr(0, 26, buffer);
-        } else {
-            u8g2.drawStr(0, 26, "TIME: OFFLINE");
-        }
-        
-        bool tn_al, t1_al, t2_al;
-        float tn = getTempByVar("Tn", tn_al);
-        float t1 = getTempByVar("T1", t1_al);
-        float t2 = getTempByVar("T2", t2_al);
-        
-        sprintf(buffer, "T out: %s%s", tn_al ? "AL" : String(tn, 1).c_str(), tn_al ? "" : " C");
-        u8g2.drawStr(0, 40, buffer);
-        
-        sprintf(buffer, "T net: %s / %s C", t1_al ? "AL" : String(t1, 1).c_str(), t2_al ? "AL" : String(t2, 1).c_str());
-        u8g2.drawStr(0, 52, buffer);
-        
-        if (!dry_run_state_stable || !dry_run_state_2_stable) {
-            u8g2.drawStr(0, 64, "ALARM: DRY RUN");
+uint32_t checkRelayPulses() {
+    MutexLock lock(ioMutex);
+    for (int i = 0; i < RELAY_COUNT; i++) {
+        if (pulseEndTimes[i] != 0 && (long)(millis() - pulseEndTimes[i]) >= 0) {
+            relayStates &= ~(1UL << i);
+            pulseEndTimes[i] = 0;
         }
-
-    } while (u8g2.nextPage());
-}
-
-void drawWifiAPScreen() {
-    char buffer[32];
-    u8g2.firstPage();
-    do {
-        u8g2.setFont(u8g2_font_ncenB10_tr);
-        u8g2.drawStr(0, 12, "Wi-Fi AP");
-        u8g2.setFont(u8g2_font_6x10_tf);
-        u8g2.drawStr(0, 24, "SETUP MODE");
-        sprintf(buffer, "SSID: %s", AP_SSID);
-        u8g2.drawStr(0, 40, buffer);
-        sprintf(buffer, "IP: %s", apIP.toString().c_str());
-        u8g2.drawStr(0, 52, buffer);
-        sprintf(buffer, "Clients: %d", WiFi.softAPgetStationNum());
-        u8g2.drawStr(0, 64, buffer);
-    } while (u8g2.nextPage());
-}
-
-void updateDisplay() {
-    if (!isDisplayAvailable || !displayOn) return;
-
-    Wire.beginTransmission(OLED_ADDR);
-    if (Wire.endTransmission() != 0) {
-        if (displayErrorCounter < 255) displayErrorCounter++;
-        return;
-    } else {
-        displayErrorCounter = 0;
     }
-    
-    if (!isRelayExpanderAvailable) {
-        drawI2CFaultScreen("RELAY BOARD FAULT", "(I2C)", "CONTROL STOPPED");
-        return;
-    }
-    if (!isInputExpanderAvailable) {
-        drawI2CFaultScreen("INPUT BOARD FAULT", "(I2C)", "BLIND MODE ACTIVE");
-        return;
-    }
-    
-    switch(currentScreen) {
-        case 1: drawContour1Screen(); break;
-        case 2: drawContour2Screen(); break;
-        case 3: drawSystemScreen(); break;
-        case 4: drawWifiAPScreen(); break;
-        default: break;
+
+    uint32_t nextEnd = SCHED_NEVER;
+    for (int i = 0; i < RELAY_COUNT; i++) {
+        if (pulseEndTimes[i] == 0) continue;
+        long left = (long)(pulseEndTimes[i] - millis());
+        uint32_t ms = left > 0 ? (uint32_t)left : 0;
+        if (ms < nextEnd) nextEnd = ms;
     }
+    return nextEnd;
 }
@@ -0,0 +1,62 @@
+// =================================================================================
+// File:         src/heating_curve.cpp
+// Description:  Подготовка и расчёт отопительного графика.
+// =================================================================================
+
+#include "heating_curve.h"
+
+bool curveCompile(const String& json, HeatingCurve& out) {
+    out.count = 0;
+
+    StaticJsonDocument<JSON_ARRAY_SIZE(CURVE_MAX_POINTS) + CURVE_MAX_POINTS * JSON_OBJECT_SIZE(2) + 64> doc;
+    if (deserializeJson(doc, json)) return false;
+    JsonArray array = doc.as<JsonArray>();
+    if (array.size() < 2 || array.size() > CURVE_MAX_POINTS) return false;
+
+    const float tMin = CURVE_LUT_MIN_T;
+    const float tMax = CURVE_LUT_MIN_T + CURVE_LUT_SIZE - 1;
+    float x[CURVE_MAX_POINTS], y[CURVE_MAX_POINTS];
+    uint8_t n = 0;
+    for (JsonObject p : array) {
+        if (!p["x"].is<float>() || !p["y"].is<float>()) return false;
+        float px = p["x"], py = p["y"];
+        if (isnan(px) || isnan(py) || px < tMin || px > tMax) return false;
+
+        // Вставка с сохранением порядка по Tн
+        uint8_t i = n;
+        while (i > 0 && x[i - 1] > px) { x[i] = x[i - 1]; y[i] = y[i - 1]; i--; }
+        if (i > 0 && x[i - 1] == px) return false;
+        x[i] = px; y[i] = py;
+        n++;
+    }
+
+    for (uint8_t i = 0; i < n; i++) { out.x[i] = x[i]; out.y[i] = y[i]; }
+    for (uint8_t i = 0; i + 1 < n; i++) {
+        out.slope[i] = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+    }
+    out.slope[n - 1] = 0.0f;
+
+    // Для каждого целого градуса - последний отрезок, начинающийся не правее него
+    uint8_t seg = 0;
+    for (int b = 0; b < CURVE_LUT_SIZE; b++) {
+        float t = (float)(CURVE_LUT_MIN_T + b);
+        while (seg + 2 < n && x[seg + 1] <= t) seg++;
+        out.segByDegree[b] = seg;
+    }
+
+    out.count = n;
+    return true;
+}
+
+float curveEvaluate(const HeatingCurve& c, float tn) {
+    if (c.count < 2 || isnan(tn)) return NAN;
+    if (tn <= c.x[0]) return c.y[0];
+    if (tn >= c.x[c.count - 1]) return c.y[c.count - 1];
+
+    // tn внутри графика, значит и внутри таблицы (см. проверку в curveCompile)
+    int b = (int)floorf(tn) - CURVE_LUT_MIN_T;
+    uint8_t i = c.segByDegree[b];
+    // В одном градусе может оказаться несколько точек - дошагиваем
+    while (i + 2 < c.count && tn > c.x[i + 1]) i++;
+    return c.y[i] + (tn - c.x[i]) * c.slope[i];
+}
@@ -0,0 +1,752 @@
+// =================================================================================
+// File:         src/historian.cpp
+// Description:  Реализация журнала истории: кольцо сжатых блоков, запись
+//               отсчётов и событий (задача control) и потоковая выгрузка
+//               /api/history (задача web). Блоки меняются под спинлоком
+//               histMux; выгрузка копирует блок целиком и разбирает копию,
+//               поэтому запись не ждёт медленного клиента.
+// =================================================================================
+
+#include "historian.h"
+#include "utils.h"
+#include "scheduler.h"
+#include "tasks.h"
+#include "sensors.h"
+#include "pid_control.h"
+#include "pump_control.h"
+#include "stream_export.h"
+
+#define HIST_NONE TEMP_NONE
+// Самый длинный вывод одной записи: строка CSV отсчёта или строки клапанов
+#define HIST_ROW_MAX (2 * CONTOUR_COUNT * 48 > 160 ? 2 * CONTOUR_COUNT * 48 : 160)
+static const uint32_t HIST_SAMPLE_S = HIST_SAMPLE_MS / 1000;
+static const uint8_t HIST_CONTOUR_BITS = CONTOUR_COUNT > 2 ? 2 : 1; // Номер контура - 1
+static_assert(CONTOUR_COUNT <= (1 << HIST_CONTOUR_BITS), "HIST_CONTOUR_BITS too small for CONTOUR_COUNT");
+
+enum HistRecType : uint8_t { REC_SAMPLE, REC_PUMP };
+
+// Импульсы клапана контура за период отсчёта, длительности - по 100 мс
+struct HistValve {
+    uint8_t opens, closes;
+    uint32_t openUnits, closeUnits;
+};
+
+// Блок кольца. Опорные значения и времена - состояние кодировщика на момент
+// открытия блока, поэтому блок разбирается без предыдущих.
+struct HistBlock {
+    uint32_t seq;                   // Номер блока, 0 - пустой
+    uint32_t t0;                    // Время прошлого отсчёта
+    uint32_t tLast0;                // Время прошлой записи
+    uint32_t tEnd;                  // Время последней записи блока
+    uint16_t bytes;                 // Занято байт в data (блок записи - без хвоста кодера)
+    uint16_t samples;
+    uint16_t events;
+    int16_t key[HIST_CHANNELS];     // Прошлый отсчёт каналов
+    uint8_t data[HIST_BLOCK_BYTES - 22 - 2 * HIST_CHANNELS];
+};
+static_assert(sizeof(HistBlock) == HIST_BLOCK_BYTES, "HistBlock size mismatch!");
+
+// Запись журнала (отсчёт или событие) в разобранном виде
+struct HistRec {
+    HistRecType type;
+    uint32_t t;
+    int16_t v[HIST_CHANNELS];       // REC_SAMPLE
+    HistValve valve[CONTOUR_COUNT]; // REC_SAMPLE: импульсы с прошлого отсчёта
+    uint8_t contour;                // REC_PUMP: 1..CONTOUR_COUNT
+    uint8_t state, p1, p2, active;
+};
+
+// --- Арифметический кодер ---
+
+// Двоичный интервальный кодер (как в LZMA): вероятность нуля - 12 бит,
+// после каждого бита сдвигается к нему на 1/16 оставшегося.
+#define PROB_BITS 12
+#define PROB_INIT (1 << (PROB_BITS - 1))
+#define PROB_SHIFT 4
+#define RANGE_TOP (1u << 24)
+
+struct RangeEncoder {
+    uint8_t* buf;
+    uint16_t cap;
+    uint16_t pos;
+    bool ok;
+    uint64_t low;
+    uint32_t range;
+    uint8_t cache;
+    uint16_t cacheSize;             // Отложенные байты: cache и cacheSize - 1 байт 0xFF
+
+    void begin(uint8_t* data, uint16_t size) {
+        buf = data;
+        cap = size;
+        pos = 0;
+        ok = true;
+        low = 0;
+        range = 0xFFFFFFFF;
+        cache = 0;
+        cacheSize = 1;
+    }
+
+    void out(uint8_t b) {
+        if (pos >= cap) { ok = false; return; }
+        buf[pos++] = b;
+    }
+
+    // Старший байт low уходит в поток, если перенос в него уже невозможен
+    void shiftLow() {
+        if ((uint32_t)low < 0xFF000000u || (low >> 32)) {
+            uint8_t carry = (uint8_t)(low >> 32);
+            uint8_t b = cache;
+            do {
+                out((uint8_t)(b + carry));
+                b = 0xFF;
+            } while (--cacheSize);
+            cache = (uint8_t)(low >> 24);
+        }
+        cacheSize++;
+        low = (low & 0x00FFFFFF) << 8;
+    }
+
+    bool flag(uint16_t& prob, bool value) {
+        uint32_t bound = (range >> PROB_BITS) * prob;
+        if (!value) {
+            range = bound;
+            prob += ((1 << PROB_BITS) - prob) >> PROB_SHIFT;
+        } else {
+            low += bound;
+            range -= bound;
+            prob -= prob >> PROB_SHIFT;
+        }
+        while (range < RANGE_TOP) {
+            range <<= 8;
+            shiftLow();
+        }
+        return value;
+    }
+
+    // n младших бит value без модели (по 1 биту на бит)
+    uint32_t direct(uint32_t value, uint8_t n) {
+        value &= (n < 32) ? ((1u << n) - 1) : 0xFFFFFFFF;
+        for (uint8_t i = n; i--; ) {
+            range >>= 1;
+            if ((value >> i) & 1) low += range;
+            while (range < RANGE_TOP) {
+                range <<= 8;
+                shiftLow();
+            }
+        }
+        return value;
+    }
+
+    // Сколько байт допишет flush()
+    uint16_t tailBytes() const { return cacheSize + 4; }
+
+    void flush() {
+        for (uint8_t i = 0; i < 5; i++) shiftLow();
+    }
+};
+
+struct RangeDecoder {
+    const uint8_t* buf;
+    uint16_t end;
+    uint16_t pos;
+    uint32_t range;
+    uint32_t code;
+
+    uint8_t in() { return pos < end ? buf[pos++] : 0; }
+
+    void begin(const uint8_t* data, uint16_t size) {
+        buf = data;
+        end = size;
+        pos = 0;
+        range = 0xFFFFFFFF;
+        code = 0;
+        for (uint8_t i = 0; i < 5; i++) code = (code << 8) | in();
+    }
+
+    bool flag(uint16_t& prob, bool) {
+        uint32_t bound = (range >> PROB_BITS) * prob;
+        bool value;
+        if (code < bound) {
+            range = bound;
+            prob += ((1 << PROB_BITS) - prob) >> PROB_SHIFT;
+            value = false;
+        } else {
+            code -= bound;
+            range -= bound;
+            prob -= prob >> PROB_SHIFT;
+            value = true;
+        }
+        while (range < RANGE_TOP) {
+            range <<= 8;
+            code = (code << 8) | in();
+        }
+        return value;
+    }
+
+    uint32_t direct(uint32_t, uint8_t n) {
+        uint32_t value = 0;
+        while (n--) {
+            range >>= 1;
+            uint32_t b = code >= range ? 1 : 0;
+            if (b) code -= range;
+            value = (value << 1) | b;
+            while (range < RANGE_TOP) {
+                range <<= 8;
+                code = (code << 8) | in();
+            }
+        }
+        return value;
+    }
+};
+
+// --- Модель записей ---
+
+// Вероятности кодера; сбрасываются в начале каждого блока.
+// Контекст канала - знак его прошлой разницы (0, +, -): шум датчика
+// скачет туда-обратно, медленный нагрев идёт шагами в одну сторону.
+struct HistModel {
+    uint16_t late;                              // Запись - не отсчёт в срок
+    uint16_t pump;                              // Тип записи вне срока
+    uint16_t changed[HIST_CHANNELS][3];
+    uint16_t raw[HIST_CHANNELS];                // Значение целиком
+    uint16_t neg[HIST_CHANNELS][3];
+    uint16_t big[HIST_CHANNELS][3];             // Больше 1 шага
+    uint16_t bigger[HIST_CHANNELS];             // Больше 2 шагов
+    uint16_t pulse[CONTOUR_COUNT][4];           // Контекст - импульсы прошлого отсчёта
+    uint16_t multi[CONTOUR_COUNT];
+    uint16_t open[CONTOUR_COUNT][4];
+};
+
+// Состояние кодировщика или декодера внутри блока
+struct HistState {
+    HistModel m;
+    uint8_t cls[HIST_CHANNELS];                 // Знак прошлой разницы канала
+    uint8_t pulses[CONTOUR_COUNT];              // Прошлый отсчёт: 0 - без импульсов, 1 - открыть, 2 - закрыть, 3 - иное
+    uint32_t valveUnits[CONTOUR_COUNT];         // Длительность прошлого одиночного импульса, 100 мс
+    int16_t val[HIST_CHANNELS];                 // Прошлый отсчёт
+    uint32_t sampleT;                           // Время прошлого отсчёта
+    uint32_t t;                                 // Время прошлой записи
+
+    void reset(const HistBlock& b) {
+        uint16_t* p = (uint16_t*)&m;
+        for (size_t i = 0; i < sizeof(m) / sizeof(*p); i++) p[i] = PROB_INIT;
+        memset(cls, 0, sizeof(cls));
+        memset(pulses, 0, sizeof(pulses));
+        memset(valveUnits, 0, sizeof(valveUnits));
+        memcpy(val, b.key, sizeof(val));
+        sampleT = b.t0;
+        t = b.tLast0;
+    }
+};
+
+static HistBlock blocks[HIST_BLOCK_COUNT];
+static uint32_t headSeq = 0;        // Блок, в который идёт запись (0 - журнал пуст)
+static portMUX_TYPE histMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Состояние кодировщика (только под histMux)
+static HistState enc;
+static RangeEncoder rc;
+static HistState encSaved;          // Откат записи, не поместившейся в блок
+static RangeEncoder rcSaved;
+static bool initialized = false;
+static bool started = false;        // Есть хотя бы один отсчёт
+static HistValve valveAcc[CONTOUR_COUNT]; // Импульсы с прошлого отсчёта
+
+// Запись и разбор - одни и те же функции над кодером (пишет переданное
+// значение и возвращает его) или декодером (возвращает прочитанное)
+
+// Без знака: группы по 4 бита с битом продолжения, младшие вперёд
+template <class Coder>
+static uint32_t codeVar(Coder& c, uint32_t v) {
+    uint32_t result = 0;
+    for (uint8_t shift = 0; shift < 32; shift += 4) {
+        bool more = c.direct((v >> shift) >> 4 ? 1 : 0, 1);
+        result |= c.direct(v >> shift, 4) << shift;
+        if (!more) break;
+    }
+    return result;
+}
+
+// Шаг канала в 1/16 °C: датчик с разрешением 9 бит меняется по 0,5 °C (8),
+// 12 бит - по 1/16; разница пишется в шагах
+static int16_t channelStep(uint8_t ch) {
+    if (ch >= OW_VAR_COUNT) return 1;
+    uint8_t res = OW_VAR_TIMING[ch].resolution;
+    return (res >= 9 && res <= 12) ? (int16_t)(1 << (12 - res)) : 1;
+}
+
+// Канал: без изменений / ±1, ±2 шага / ±3..18 шагов (4 бита) / значение
+// целиком (16 бит, в том числе "нет данных")
+template <class Coder>
+static int16_t codeValue(Coder& c, HistState& s, uint8_t ch, int16_t v) {
+    int16_t prev = s.val[ch];
+    uint8_t& cls = s.cls[ch];
+    if (!c.flag(s.m.changed[ch][cls], v != prev)) {
+        cls = 0;
+        return prev;
+    }
+    int16_t step = channelStep(ch);
+    int32_t d = ((int32_t)v - prev) / step;
+    bool fits = v != HIST_NONE && prev != HIST_NONE && ((int32_t)v - prev) % step == 0 && d >= -18 && d <= 18;
+    if (c.flag(s.m.raw[ch], !fits)) {
+        cls = 0;
+        return (int16_t)c.direct((uint16_t)v, 16);
+    }
+    uint32_t mag = d < 0 ? -d : d;
+    bool neg = c.flag(s.m.neg[ch][cls], d < 0);
+    if (!c.flag(s.m.big[ch][cls], mag > 1)) mag = 1;
+    else if (!c.flag(s.m.bigger[ch], mag > 2)) mag = 2;
+    else mag = 3 + c.direct(mag - 3, 4);
+    cls = neg ? 2 : 1;
+    return (int16_t)(prev + (neg ? -(int32_t)mag : (int32_t)mag) * step);
+}
+
+static bool singlePulse(const HistValve& v, uint32_t units) {
+    return v.opens + v.closes == 1 && (v.opens ? v.openUnits : v.closeUnits) == units;
+}
+
+// Импульсы контура за период отсчёта: не было / один импульс прошлой
+// длительности + направление / счётчики и суммы длительностей
+template <class Coder>
+static void codeValve(Coder& c, HistState& s, uint8_t cont, HistValve& v) {
+    uint8_t& prev = s.pulses[cont];
+    uint32_t& units = s.valveUnits[cont];
+    if (!c.flag(s.m.pulse[cont][prev], v.opens || v.closes)) {
+        v = HistValve();
+        prev = 0;
+        return;
+    }
+    if (!c.flag(s.m.multi[cont], !singlePulse(v, units))) {
+        bool open = c.flag(s.m.open[cont][prev], v.opens != 0);
+        v = HistValve();
+        if (open) { v.opens = 1; v.openUnits = units; }
+        else { v.closes = 1; v.closeUnits = units; }
+        prev = open ? 1 : 2;
+        return;
+    }
+    v.opens = (uint8_t)codeVar(c, v.opens);
+    v.closes = (uint8_t)codeVar(c, v.closes);
+    v.openUnits = codeVar(c, v.openUnits);
+    v.closeUnits = codeVar(c, v.closeUnits);
+    // Импульсы ПИ обычно одной длительности - её помнит модель контура
+    if (v.opens + v.closes == 1) units = v.opens ? v.openUnits : v.closeUnits;
+    prev = 3;
+}
+
+// Заголовок записи: отсчёт через HIST_SAMPLE_S после прошлого (onTime) -
+// один бит; иначе тип и секунды от прошлой записи
+template <class Coder>
+static void codeRecord(Coder& c, HistState& s, HistRec& r, bool onTime) {
+    if (c.flag(s.m.late, !onTime)) {
+        r.type = c.flag(s.m.pump, r.type == REC_PUMP) ? REC_PUMP : REC_SAMPLE;
+        r.t = s.t + codeVar(c, r.t - s.t);
+    } else {
+        r.type = REC_SAMPLE;
+        r.t = s.sampleT + HIST_SAMPLE_S;
+    }
+    if (r.type == REC_SAMPLE) {
+        for (uint8_t i = 0; i < HIST_CHANNELS; i++) r.v[i] = codeValue(c, s, i, r.v[i]);
+        for (uint8_t k = 0; k < CONTOUR_COUNT; k++) codeValve(c, s, k, r.valve[k]);
+        memcpy(s.val, r.v, sizeof(s.val));
+        s.sampleT = r.t;
+    } else {
+        r.contour = (uint8_t)c.direct(r.contour - 1, HIST_CONTOUR_BITS) + 1;
+        r.state = (uint8_t)c.direct(r.state, 3);
+        r.p1 = (uint8_t)c.direct(r.p1, 2);
+        r.p2 = (uint8_t)c.direct(r.p2, 2);
+        r.active = (uint8_t)c.direct(r.active, 1);
+    }
+    s.t = r.t;
+}
+
+// Закрыть блок записи (дописать хвост кодера) и открыть следующий,
+// затирая самый старый
+static HistBlock& openBlock() {
+    if (headSeq) {
+        rc.flush();
+        blocks[headSeq % HIST_BLOCK_COUNT].bytes = rc.pos;
+    }
+    headSeq++;
+    HistBlock& b = blocks[headSeq % HIST_BLOCK_COUNT];
+    b.seq = headSeq;
+    b.t0 = enc.sampleT;
+    b.tLast0 = enc.t;
+    b.tEnd = enc.t;
+    b.bytes = 0;
+    b.samples = 0;
+    b.events = 0;
+    memcpy(b.key, enc.val, sizeof(b.key));
+    enc.reset(b);
+    rc.begin(b.data, sizeof(b.data));
+    return b;
+}
+
+static void append(HistRec& r) {
+    portENTER_CRITICAL(&histMux);
+    if (!initialized) {
+        enc.sampleT = enc.t = r.t;
+        for (uint8_t i = 0; i < HIST_CHANNELS; i++) enc.val[i] = HIST_NONE;
+        initialized = true;
+    }
+    if (r.t < enc.t) r.t = enc.t; // Запись из другой задачи с чуть более ранним временем
+    HistBlock* b = headSeq ? &blocks[headSeq % HIST_BLOCK_COUNT] : &openBlock();
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        bool onTime = r.type == REC_SAMPLE && started && r.t == enc.sampleT + HIST_SAMPLE_S;
+        encSaved = enc;
+        rcSaved = rc;
+        codeRecord(rc, enc, r, onTime);
+        // В блоке должно остаться место под хвост кодера
+        if (rc.ok && rc.pos + rc.tailBytes() <= rc.cap) {
+            b->bytes = rc.pos;
+            b->tEnd = r.t;
+            if (r.type == REC_SAMPLE) {
+                b->samples++;
+                started = true;
+            } else {
+                b->events++;
+            }
+            break;
+        }
+        enc = encSaved; // Блок заполнен - запись целиком уходит в новый
+        rc = rcSaved;
+        b = &openBlock();
+    }
+    portEXIT_CRITICAL(&histMux);
+}
+
+// --- Запись (задача control) ---
+
+void histRecordSample() {
+    HistRec r;
+    r.type = REC_SAMPLE;
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+        bool alarm;
+        float t = getTempByVar(OW_VARS[i], alarm);
+        r.v[i] = alarm ? HIST_NONE : quantizeTemp(t);
+    }
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        bool comfort;
+        float reduction;
+        r.v[OW_VAR_COUNT + c] = quantizeTemp(calculateSetpoint(c + 1, comfort, reduction));
+    }
+    portENTER_CRITICAL(&histMux);
+    memcpy(r.valve, valveAcc, sizeof(r.valve));
+    memset(valveAcc, 0, sizeof(valveAcc));
+    r.t = uptimeSeconds();
+    // Задание может опоздать на доли секунды - отсчёт в срок кодируется одним битом
+    uint32_t due = enc.sampleT + HIST_SAMPLE_S;
+    if (started && r.t + 1 >= due && r.t <= due + 1 && due >= enc.t) r.t = due;
+    portEXIT_CRITICAL(&histMux);
+    append(r);
+}
+
+// Импульс не пишется сразу, а копится до следующего отсчёта: при частых
+// импульсах ПИ отдельные записи занимали бы большую часть кольца
+void histValvePulse(uint8_t contour, int8_t dir, uint32_t durationMs) {
+    if (!isContour(contour)) return;
+    uint32_t units = (durationMs + 50) / 100;
+    portENTER_CRITICAL(&histMux);
+    HistValve& v = valveAcc[contour - 1];
+    if (dir > 0) {
+        if (v.opens < 0xFF) v.opens++;
+        v.openUnits += units;
+    } else {
+        if (v.closes < 0xFF) v.closes++;
+        v.closeUnits += units;
+    }
+    portEXIT_CRITICAL(&histMux);
+}
+
+void histRecordPumps() {
+    static uint8_t recorded[CONTOUR_COUNT][4];
+    static bool recordedValid[CONTOUR_COUNT];
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        const ContourPumpLogic& logic = pumpLogic[c];
+        uint8_t now[4] = { (uint8_t)logic.state, (uint8_t)logic.pumps[0].status,
+                           (uint8_t)logic.pumps[1].status, (uint8_t)(logic.activePumpIndex ? 1 : 0) };
+        if (recordedValid[c] && memcmp(now, recorded[c], sizeof(now)) == 0) continue;
+        memcpy(recorded[c], now, sizeof(now));
+        recordedValid[c] = true;
+
+        HistRec r;
+        r.type = REC_PUMP;
+        r.contour = c + 1;
+        r.state = now[0];
+        r.p1 = now[1];
+        r.p2 = now[2];
+        r.active = now[3];
+        portENTER_CRITICAL(&histMux);
+        r.t = uptimeSeconds();
+        portEXIT_CRITICAL(&histMux);
+        append(r);
+    }
+}
+
+HistInfo histInfo() {
+    HistInfo info = {};
+    info.capacityBytes = sizeof(blocks);
+    portENTER_CRITICAL(&histMux);
+    info.now = uptimeSeconds();
+    info.from = info.now;
+    uint32_t oldest = headSeq >= HIST_BLOCK_COUNT ? headSeq - HIST_BLOCK_COUNT + 1 : 1;
+    for (uint32_t seq = oldest; seq <= headSeq; seq++) {
+        const HistBlock& b = blocks[seq % HIST_BLOCK_COUNT];
+        if (seq == oldest) info.from = b.tLast0;
+        info.samples += b.samples;
+        info.events += b.events;
+        info.usedBytes += sizeof(HistBlock) - sizeof(b.data) + b.bytes;
+    }
+    portEXIT_CRITICAL(&histMux);
+    return info;
+}
+
+// --- Разбор блока ---
+
+struct HistDecoder {
+    RangeDecoder r;
+    HistState s;
+    uint32_t left;                  // Записей до конца блока
+
+    void begin(const HistBlock& b) {
+        r.begin(b.data, b.bytes);
+        s.reset(b);
+        left = (uint32_t)b.samples + b.events;
+    }
+
+    bool next(HistRec& rec) {
+        if (!left) return false;
+        left--;
+        rec = HistRec(); // Декодеру поля записи не нужны - только чтобы не читать мусор
+        codeRecord(r, s, rec, false);
+        return true;
+    }
+};
+
+// --- Выгрузка (задача web) ---
+
+static void channelName(uint8_t ch, char* buf, size_t len) {
+    if (ch < OW_VAR_COUNT) snprintf(buf, len, "%s", OW_VARS[ch]);
+    else snprintf(buf, len, "c%u.tzavd", (unsigned)(ch - OW_VAR_COUNT + 1));
+}
+
+struct HistExport {
+    bool binary;
+    bool events;
+    bool header;                    // Строка заголовка CSV ещё не выдана
+    uint32_t from, to, step;
+    uint8_t chans[HIST_CHANNELS];
+    uint8_t chanCount;
+    uint32_t seq;                   // Следующий блок
+    bool haveBlock;
+    HistBlock copy;
+    HistDecoder dec;
+    // Текущий интервал усреднения
+    bool bucketOpen;
+    uint32_t bucketT;
+    int32_t sum[HIST_CHANNELS];
+    uint16_t cnt[HIST_CHANNELS];
+};
+static HistExport xfer;
+
+// Порция выгрузки, которую сейчас наполняет fill()
+static char* out;
+static size_t outCap;
+static size_t* outLen;
+
+static void outBytes(const void* data, size_t len) {
+    if (*outLen + len > outCap) return;
+    memcpy(out + *outLen, data, len);
+    *outLen += len;
+}
+
+static void flushBucket() {
+    if (!xfer.bucketOpen) return;
+    xfer.bucketOpen = false;
+    if (xfer.binary) {
+        uint8_t t[4];
+        putU32(t, xfer.bucketT);
+        outBytes(t, sizeof(t));
+        for (uint8_t k = 0; k < xfer.chanCount; k++) {
+            int16_t v = xfer.cnt[k] ? (int16_t)lroundf((float)xfer.sum[k] / xfer.cnt[k]) : HIST_NONE;
+            uint8_t le[2];
+            putU16(le, (uint16_t)v);
+            outBytes(le, sizeof(le));
+        }
+        return;
+    }
+    exportAppend(out, outCap, *outLen, "%lu", (unsigned long)xfer.bucketT);
+    for (uint8_t k = 0; k < xfer.chanCount; k++) {
+        if (xfer.cnt[k]) exportAppend(out, outCap, *outLen, ",%.2f", (float)xfer.sum[k] / xfer.cnt[k] / 16.0f);
+        else exportAppend(out, outCap, *outLen, ",");
+    }
+    exportAppend(out, outCap, *outLen, "\n");
+}
+
+static void addSample(const HistRec& rec) {
+    uint32_t bucketT = xfer.step ? xfer.from + (rec.t - xfer.from) / xfer.step * xfer.step : rec.t;
+    if (xfer.bucketOpen && bucketT != xfer.bucketT) flushBucket();
+    if (!xfer.bucketOpen) {
+        xfer.bucketOpen = true;
+        xfer.bucketT = bucketT;
+        memset(xfer.sum, 0, sizeof(xfer.sum));
+        memset(xfer.cnt, 0, sizeof(xfer.cnt));
+    }
+    for (uint8_t k = 0; k < xfer.chanCount; k++) {
+        int16_t v = rec.v[xfer.chans[k]];
+        if (v == HIST_NONE) continue;
+        xfer.sum[k] += v;
+        xfer.cnt[k]++;
+    }
+}
+
+// Импульсы за период отсчёта - строка на контур и направление, время - отсчёта
+static void addEvent(const HistRec& rec) {
+    if (rec.type == REC_SAMPLE) {
+        for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+            const HistValve& v = rec.valve[c];
+            if (v.opens) exportAppend(out, outCap, *outLen, "%lu,%u,valve,1,%u,%lu,,,,\n", (unsigned long)rec.t, c + 1, v.opens, (unsigned long)v.openUnits * 100);
+            if (v.closes) exportAppend(out, outCap, *outLen, "%lu,%u,valve,-1,%u,%lu,,,,\n", (unsigned long)rec.t, c + 1, v.closes, (unsigned long)v.closeUnits * 100);
+        }
+    } else {
+        exportAppend(out, outCap, *outLen, "%lu,%u,pump,,,,%u,%s,%s,%u\n", (unsigned long)rec.t, rec.contour, rec.state,
+                  getPumpStatusString((PumpStatus)rec.p1), getPumpStatusString((PumpStatus)rec.p2), rec.active);
+    }
+}
+
+// Скопировать следующий живой блок; false - блоков больше нет
+static bool loadBlock() {
+    for (;;) {
+        bool found = false;
+        portENTER_CRITICAL(&histMux);
+        if (xfer.seq > headSeq) {
+            portEXIT_CRITICAL(&histMux);
+            return false;
+        }
+        uint32_t oldest = headSeq >= HIST_BLOCK_COUNT ? headSeq - HIST_BLOCK_COUNT + 1 : 1;
+        if (xfer.seq < oldest) xfer.seq = oldest; // Затёрт, пока шла выгрузка
+        const HistBlock& b = blocks[xfer.seq % HIST_BLOCK_COUNT];
+        // Блоки целиком раньше начала диапазона не копируются
+        if (b.tEnd >= xfer.from || xfer.seq == headSeq) {
+            memcpy(&xfer.copy, &b, sizeof(b));
+            if (xfer.seq == headSeq) {
+                // Блок записи - с хвостом кодера, дописанным в копию
+                RangeEncoder tail = rc;
+                tail.buf = xfer.copy.data;
+                tail.flush();
+                xfer.copy.bytes = tail.pos;
+            }
+            found = true;
+        }
+        xfer.seq++;
+        portEXIT_CRITICAL(&histMux);
+        if (found) {
+            xfer.dec.begin(xfer.copy);
+            return true;
+        }
+    }
+}
+
+// Наполнить порцию строками; true - конец диапазона
+static bool fill(char* buf, size_t cap, size_t& len) {
+    out = buf;
+    outCap = cap;
+    outLen = &len;
+    if (xfer.header) {
+        xfer.header = false;
+        if (xfer.events) {
+            exportAppend(buf, cap, len, "t,contour,event,dir,n,ms,state,p1,p2,active\n");
+        } else if (!xfer.binary) {
+            char name[16];
+            exportAppend(buf, cap, len, "t");
+            for (uint8_t k = 0; k < xfer.chanCount; k++) {
+                channelName(xfer.chans[k], name, sizeof(name));
+                exportAppend(buf, cap, len, ",%s", name);
+            }
+            exportAppend(buf, cap, len, "\n");
+        }
+    }
+    HistRec rec;
+    bool end = false;
+    while (!end && len + HIST_ROW_MAX < cap) {
+        if (!xfer.haveBlock) {
+            xfer.haveBlock = loadBlock();
+            if (!xfer.haveBlock) { end = true; break; }
+        }
+        if (!xfer.dec.next(rec)) {
+            xfer.haveBlock = false;
+            continue;
+        }
+        if (rec.t < xfer.from) continue;
+        if (rec.t > xfer.to) { end = true; break; }
+        if (xfer.events) {
+            addEvent(rec);
+        } else if (rec.type == REC_SAMPLE) {
+            addSample(rec);
+        }
+    }
+    if (end) flushBucket();
+    return end;
+}
+
+// Каналы из списка "T11,c1.tzavd"; неизвестные имена пропускаются
+static void parseChannels(const String& csv) {
+    xfer.chanCount = 0;
+    if (!csv.length()) {
+        for (uint8_t i = 0; i < HIST_CHANNELS; i++) xfer.chans[xfer.chanCount++] = i;
+        return;
+    }
+    char name[16];
+    int start = 0;
+    while (start >= 0 && xfer.chanCount < HIST_CHANNELS) {
+        int comma = csv.indexOf(',', start);
+        String tok = (comma < 0) ? csv.substring(start) : csv.substring(start, comma);
+        tok.trim();
+        for (uint8_t i = 0; i < HIST_CHANNELS; i++) {
+            channelName(i, name, sizeof(name));
+            if (tok == name) { xfer.chans[xfer.chanCount++] = i; break; }
+        }
+        if (comma < 0) break;
+        start = comma + 1;
+    }
+}
+
+void handleHistory() {
+    if (!exportAvailable()) return;
+    HistInfo info = histInfo();
+    xfer.events = server.arg("kind") == "events";
+    xfer.binary = !xfer.events && server.arg("fmt") == "bin";
+    xfer.to = server.hasArg("to") ? (uint32_t)server.arg("to").toInt() : info.now;
+    if (server.hasArg("last")) {
+        uint32_t last = (uint32_t)server.arg("last").toInt();
+        xfer.from = info.now > last ? info.now - last : 0;
+    } else {
+        xfer.from = (uint32_t)server.arg("from").toInt();
+    }
+    xfer.step = xfer.events ? 0 : (uint32_t)server.arg("step").toInt();
+    parseChannels(server.arg("ch"));
+    if (xfer.from > xfer.to || !xfer.chanCount) {
+        server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad range\"}");
+        return;
+    }
+
+    char head[EXPORT_CHUNK_BYTES / 2];
+    size_t len = 0;
+    char name[16];
+    exportAppend(head, sizeof(head), len, "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nCache-Control: no-cache\r\n"
+                 "X-Hist-Now: %lu\r\nX-Hist-From: %lu\r\n",
+                 xfer.binary ? "application/octet-stream" : "text/csv",
+                 (unsigned long)info.now, (unsigned long)info.from);
+    if (!xfer.events) {
+        exportAppend(head, sizeof(head), len, "X-Hist-Channels: ");
+        for (uint8_t k = 0; k < xfer.chanCount; k++) {
+            channelName(xfer.chans[k], name, sizeof(name));
+            exportAppend(head, sizeof(head), len, k ? ",%s" : "%s", name);
+        }
+        exportAppend(head, sizeof(head), len, "\r\n");
+    }
+    xfer.header = true;
+    xfer.seq = 0;
+    xfer.haveBlock = false;
+    xfer.bucketOpen = false;
+    exportBegin(head, fill);
+}
@@ -0,0 +1,639 @@
+// =================================================================================
+// File:         src/http_server.cpp
+// Description:  Реализация неблокирующего HTTP-сервера (см. http_server.h).
+//               Колбэки AsyncTCP меняют только состояние слота и его буфер
+//               приёма (под спинлоком mux) и будят задание http; всё
+//               остальное - разбор, обработчики, отправка, таймауты - в
+//               задаче web. Объект AsyncClient удаляет только задача web,
+//               после onDisconnect.
+// =================================================================================
+
+#include "tasks.h"
+
+#if USE_ASYNC_HTTP
+
+#include "http_server.h"
+#include <strings.h>
+
+static const char* statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 408: return "Request Timeout";
+        case 413: return "Payload Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default:  return "";
+    }
+}
+
+static HTTPMethod parseMethod(const String& m) {
+    if (m == "GET") return HTTP_GET;
+    if (m == "HEAD") return HTTP_HEAD;
+    if (m == "POST") return HTTP_POST;
+    if (m == "PUT") return HTTP_PUT;
+    if (m == "PATCH") return HTTP_PATCH;
+    if (m == "DELETE") return HTTP_DELETE;
+    if (m == "OPTIONS") return HTTP_OPTIONS;
+    return HTTP_ANY;
+}
+
+static String copyOf(const char* s, size_t len) {
+    String r;
+    r.reserve(len);
+    for (size_t i = 0; i < len; i++) r += s[i];
+    return r;
+}
+
+static String urlDecode(const char* s, size_t len) {
+    String r;
+    r.reserve(len);
+    for (size_t i = 0; i < len; i++) {
+        if (s[i] == '+') {
+            r += ' ';
+        } else if (s[i] == '%' && i + 2 < len) {
+            char hex[3] = { s[i + 1], s[i + 2], '\0' };
+            r += (char)strtol(hex, nullptr, 16);
+            i += 2;
+        } else {
+            r += s[i];
+        }
+    }
+    return r;
+}
+
+// --- HttpStream ---
+
+uint8_t HttpStream::connected() const {
+    if (!srv || slot >= HTTP_MAX_CONNS) return 0;
+    const HttpServer::Conn& c = srv->conns[slot];
+    return c.gen == gen && c.state == HttpServer::CONN_STREAM && c.tcp && c.tcp->connected();
+}
+
+size_t HttpStream::write(const uint8_t* buf, size_t n) {
+    if (!connected()) return 0;
+    AsyncClient* tcp = srv->conns[slot].tcp;
+    if (tcp->space() < n) return 0; // Клиент не успевает читать - кадр не пишем частично
+    size_t added = tcp->add((const char*)buf, n);
+    tcp->send();
+    return added;
+}
+
+void HttpStream::stop() {
+    if (connected()) srv->closeConn(srv->conns[slot]);
+    srv = nullptr;
+}
+
+// --- HttpChunkWriter ---
+
+size_t HttpChunkWriter::write(const uint8_t* data, size_t n) {
+    if (!srv) return n;
+    for (size_t done = 0; done < n;) {
+        size_t part = n - done;
+        if (part > (size_t)(HTTP_CHUNK_BYTES - len)) part = HTTP_CHUNK_BYTES - len;
+        memcpy(buf + 6 + len, data + done, part);
+        len += part;
+        done += part;
+        if (len == HTTP_CHUNK_BYTES) flushChunk();
+    }
+    return n;
+}
+
+// Размер куска - вплотную перед данными, CRLF - после: одна запись в TCP
+void HttpChunkWriter::flushChunk() {
+    if (!srv || !len) return;
+    char size[8];
+    int h = snprintf(size, sizeof(size), "%X\r\n", len);
+    char* start = buf + 6 - h;
+    memcpy(start, size, h);
+    buf[6 + len] = '\r';
+    buf[7 + len] = '\n';
+    srv->emit(srv->conns[srv->cur], start, h + len + 2);
+    len = 0;
+}
+
+// --- Колбэки AsyncTCP ---
+
+HttpServer::HttpServer(uint16_t port) : port(port) {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNS; i++) {
+        conns[i].tcp = nullptr;
+        conns[i].state = CONN_FREE;
+        conns[i].gen = 0;
+    }
+}
+
+int8_t HttpServer::slotOf(AsyncClient* tcp) const {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNS; i++) {
+        if (conns[i].tcp == tcp && conns[i].state != CONN_FREE) return (int8_t)i;
+    }
+    return -1;
+}
+
+// Длина полного запроса в буфере (заголовки + тело по Content-Length); 0 - ещё не весь
+uint16_t HttpServer::requestLength(const char* buf, uint16_t len) {
+    const char* end = strstr(buf, "\r\n\r\n");
+    if (!end) return 0;
+    uint32_t headLen = (uint32_t)(end - buf) + 4;
+    uint32_t bodyLen = 0;
+    for (const char* line = strstr(buf, "\r\n"); line && line < end; line = strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, "Content-Length:", 15) == 0) {
+            bodyLen = strtoul(line + 17, nullptr, 10);
+            break;
+        }
+    }
+    return (headLen + bodyLen <= len) ? (uint16_t)(headLen + bodyLen) : 0;
+}
+
+void HttpServer::onConnect(void* arg, AsyncClient* tcp) {
+    HttpServer* self = (HttpServer*)arg;
+    int8_t slot = -1;
+    portENTER_CRITICAL(&self->mux);
+    for (uint8_t i = 0; i < HTTP_MAX_CONNS; i++) {
+        Conn& c = self->conns[i];
+        if (c.state != CONN_FREE) continue;
+        c.tcp = tcp;
+        c.state = CONN_READING;
+        c.gen++;
+        c.served = 0;
+        c.oversized = false;
+        c.rxLen = 0;
+        c.reqLen = 0;
+        c.startMs = c.lastMs = millis();
+        c.rx[0] = '\0';
+        slot = (int8_t)i;
+        break;
+    }
+    if (slot < 0) self->counters.rejected++;
+    else self->counters.accepted++;
+    portEXIT_CRITICAL(&self->mux);
+
+    if (slot < 0) {
+        // Пул занят: браузер повторит запрос по одному из открытых соединений
+        tcp->onDisconnect([](void*, AsyncClient* c) { delete c; }, nullptr);
+        tcp->close(true);
+        return;
+    }
+    tcp->setNoDelay(true);
+    tcp->onData(&HttpServer::onData, self);
+    tcp->onAck(&HttpServer::onAck, self);
+    tcp->onDisconnect(&HttpServer::onDisconnect, self);
+}
+
+void HttpServer::onData(void* arg, AsyncClient* tcp, void* data, size_t len) {
+    HttpServer* self = (HttpServer*)arg;
+    bool wake = false;
+    portENTER_CRITICAL(&self->mux);
+    int8_t i = self->slotOf(tcp);
+    if (i >= 0) {
+        Conn& c = self->conns[i];
+        if (c.state <= CONN_SENDING) {
+            if (c.rxLen + len >= HTTP_RX_BYTES) {
+                c.oversized = true;
+            } else {
+                if (c.rxLen == 0) c.startMs = millis();
+                memcpy(c.rx + c.rxLen, data, len);
+                c.rxLen += len;
+                c.rx[c.rxLen] = '\0';
+            }
+            c.lastMs = millis();
+            // Следующий запрос (конвейер) дождётся окончания текущего ответа
+            if (c.state == CONN_READING) {
+                c.reqLen = c.oversized ? 0 : requestLength(c.rx, c.rxLen);
+                if (c.reqLen || c.oversized) {
+                    c.state = CONN_READY;
+                    wake = true;
+                }
+            }
+        }
+    }
+    portEXIT_CRITICAL(&self->mux);
+    if (wake) tasksWakeHttp();
+}
+
+void HttpServer::onAck(void* arg, AsyncClient* tcp, size_t len, uint32_t time) {
+    (void)time;
+    HttpServer* self = (HttpServer*)arg;
+    bool wake = false;
+    portENTER_CRITICAL(&self->mux);
+    int8_t i = self->slotOf(tcp);
+    if (i >= 0 && self->conns[i].state == CONN_SENDING) {
+        self->conns[i].acked += len;
+        wake = true;
+    }
+    portEXIT_CRITICAL(&self->mux);
+    if (wake) tasksWakeHttp();
+}
+
+void HttpServer::onDisconnect(void* arg, AsyncClient* tcp) {
+    HttpServer* self = (HttpServer*)arg;
+    portENTER_CRITICAL(&self->mux);
+    int8_t i = self->slotOf(tcp);
+    if (i >= 0) self->conns[i].state = CONN_CLOSED;
+    portEXIT_CRITICAL(&self->mux);
+    if (i >= 0) tasksWakeHttp();
+}
+
+// --- Задача web ---
+
+void HttpServer::begin() {
+    if (!listener) {
+        listener = new AsyncServer(port);
+        listener->onClient(&HttpServer::onConnect, this);
+    }
+    listener->begin();
+}
+
+void HttpServer::stop() {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNS; i++) {
+        ConnState st = conns[i].state;
+        if (st != CONN_FREE && st != CONN_CLOSING && st != CONN_CLOSED) closeConn(conns[i]);
+    }
+    if (listener) listener->end();
+}
+
+void HttpServer::on(const String& uri, HTTPMethod method, THandlerFunction fn) {
+    if (routeCount >= HTTP_MAX_ROUTES) {
+        // Регистрация - из setup(): молча отброшенный маршрут отвечал бы 404
+        Serial.printf("HTTP: route table full (%u), cannot add %s\n", (unsigned)HTTP_MAX_ROUTES, uri.c_str());
+        Serial.flush();
+        abort();
+    }
+    routes[routeCount++] = Route{ uri, method, fn };
+}
+
+void HttpServer::collectHeaders(const char* keys[], size_t count) {
+    headerKeyCount = 0;
+    for (size_t i = 0; i < count && headerKeyCount < HTTP_MAX_HEADERS; i++) headerKeys[headerKeyCount++] = keys[i];
+}
+
+uint8_t HttpServer::activeConnections() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNS; i++) {
+        if (conns[i].state != CONN_FREE) n++;
+    }
+    return n;
+}
+
+void HttpServer::closeConn(Conn& c) {
+    bool doClose = false;
+    portENTER_CRITICAL(&mux);
+    if (c.state != CONN_FREE && c.state != CONN_CLOSING && c.state != CONN_CLOSED) {
+        c.state = CONN_CLOSING;
+        doClose = true;
+    }
+    portEXIT_CRITICAL(&mux);
+    // Может сразу вызвать onDisconnect - поэтому вне спинлока
+    if (doClose) c.tcp->close();
+}
+
+void HttpServer::handleClient() {
+    uint32_t startUs = micros();
+    uint32_t now = millis();
+    bool dispatched = false;
+    bool more = false;
+
+    for (uint8_t i = 0; i < HTTP_MAX_CONNS; i++) {
+        Conn& c = conns[i];
+        switch (c.state) {
+            case CONN_CLOSED: {
+                delete c.tcp;
+                c.head = String();
+                c.body = String();
+                portENTER_CRITICAL(&mux);
+                c.tcp = nullptr;
+                c.state = CONN_FREE;
+                portEXIT_CRITICAL(&mux);
+                break;
+            }
+            case CONN_READING:
+                // Начатый запрос - бюджет запроса, пустое соединение - простой keep-alive
+                if (c.rxLen ? (now - c.startMs > HTTP_REQUEST_TIMEOUT_MS) : (now - c.lastMs > HTTP_KEEPALIVE_MS)) {
+                    if (c.rxLen) counters.timeouts++;
+                    closeConn(c);
+                }
+                break;
+            case CONN_READY:
+                // Один обработчик за проход: остальные - в следующем
+                if (dispatched) { more = true; break; }
+                dispatched = true;
+                dispatch(i);
+                if (c.state == CONN_SENDING && pump(c)) finish(i);
+                break;
+            case CONN_SENDING:
+                if (now - c.startMs > HTTP_REQUEST_TIMEOUT_MS) {
+                    counters.timeouts++;
+                    closeConn(c);
+                } else if ((uint32_t)(micros() - startUs) > HTTP_PASS_BUDGET_US) {
+                    more = true;
+                } else if (pump(c)) {
+                    finish(i);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    uint32_t passUs = micros() - startUs;
+    if (passUs > counters.maxPassUs) counters.maxPassUs = passUs;
+    if (more) tasksWakeHttp();
+}
+
+bool HttpServer::parseRequest(Conn& c) {
+    char* p = c.rx;
+    char* headEnd = strstr(p, "\r\n\r\n");
+    if (!headEnd) return false;
+    char* lineEnd = strstr(p, "\r\n");
+    char* sp1 = (char*)memchr(p, ' ', lineEnd - p);
+    char* sp2 = sp1 ? (char*)memchr(sp1 + 1, ' ', lineEnd - sp1 - 1) : nullptr;
+    if (!sp2) return false;
+
+    reqMethod = parseMethod(copyOf(p, sp1 - p));
+    bool http11 = strncmp(sp2 + 1, "HTTP/1.1", 8) == 0;
+
+    char* uriStart = sp1 + 1;
+    char* query = (char*)memchr(uriStart, '?', sp2 - uriStart);
+    char* uriEnd = query ? query : sp2;
+    reqUri = urlDecode(uriStart, uriEnd - uriStart);
+    if (query) {
+        for (char* kv = query + 1; kv < sp2 && argCount < HTTP_MAX_ARGS;) {
+            char* amp = (char*)memchr(kv, '&', sp2 - kv);
+            char* kvEnd = amp ? amp : sp2;
+            char* eq = (char*)memchr(kv, '=', kvEnd - kv);
+            if (kvEnd > kv) {
+                argNames[argCount] = urlDecode(kv, (eq ? eq : kvEnd) - kv);
+                argValues[argCount] = eq ? urlDecode(eq + 1, kvEnd - eq - 1) : String();
+                argCount++;
+            }
+            kv = kvEnd + 1;
+        }
+    }
+
+    c.keepAlive = http11;
+    for (char* line = lineEnd + 2; line < headEnd + 2;) {
+        char* next = strstr(line, "\r\n");
+        char* colon = (char*)memchr(line, ':', next - line);
+        if (colon) {
+            size_t nameLen = colon - line;
+            char* value = colon + 1;
+            while (*value == ' ') value++;
+            if (nameLen == 10 && strncasecmp(line, "Connection", 10) == 0) {
+                if (strncasecmp(value, "close", 5) == 0) c.keepAlive = false;
+                else if (strncasecmp(value, "keep-alive", 10) == 0) c.keepAlive = true;
+            }
+            for (uint8_t k = 0; k < headerKeyCount; k++) {
+                if (strlen(headerKeys[k]) == nameLen && strncasecmp(line, headerKeys[k], nameLen) == 0) {
+                    headerValues[k] = copyOf(value, next - value);
+                }
+            }
+        }
+        line = next + 2;
+    }
+
+    uint16_t bodyStart = (uint16_t)(headEnd + 4 - p);
+    if (c.reqLen > bodyStart && argCount < HTTP_MAX_ARGS) {
+        argNames[argCount] = "plain";
+        argValues[argCount] = copyOf(p + bodyStart, c.reqLen - bodyStart);
+        argCount++;
+    }
+    return true;
+}
+
+void HttpServer::dispatch(uint8_t i) {
+    Conn& c = conns[i];
+    cur = (int8_t)i;
+    responded = false;
+    argCount = 0;
+    pendingHeaders = String();
+    for (uint8_t k = 0; k < headerKeyCount; k++) headerValues[k] = String();
+    c.served++;
+    counters.requests++;
+
+    if (c.oversized || !parseRequest(c)) {
+        c.keepAlive = false;
+        if (c.oversized) {
+            counters.oversized++;
+            send(413, "text/plain", "Request too large");
+        } else {
+            send(400, "text/plain", "Bad request");
+        }
+    } else {
+        bool handled = false;
+        for (uint8_t r = 0; r < routeCount; r++) {
+            if (routes[r].uri == reqUri && (routes[r].method == HTTP_ANY || routes[r].method == reqMethod)) {
+                routes[r].fn();
+                handled = true;
+                break;
+            }
+        }
+        if (!handled) {
+            if (notFound) notFound();
+            else send(404, "text/plain", "Not found");
+        }
+        if (chunkedOpen) endChunked();
+        if (!responded) send(500, "text/plain", "No response");
+    }
+    cur = -1;
+}
+
+// Дописать ответ в окно TCP; true - весь ответ отправлен и подтверждён
+bool HttpServer::pump(Conn& c) {
+    size_t total = c.head.length() + c.bodyLen;
+    while (c.sent < total) {
+        size_t room = c.tcp->space();
+        if (!room) break;
+        const char* data;
+        size_t len;
+        uint8_t flags = ASYNC_WRITE_FLAG_COPY;
+        if (c.sent < c.head.length()) {
+            data = c.head.c_str() + c.sent;
+            len = c.head.length() - c.sent;
+        } else {
+            size_t off = c.sent - c.head.length();
+            data = c.bodyPtr + off;
+            len = c.bodyLen - off;
+            if (c.bodyInFlash) flags = 0; // Массив во flash живёт всегда - без копии
+        }
+        if (len > room) len = room;
+        size_t added = c.tcp->add(data, len, flags);
+        if (!added) break;
+        c.sent += added;
+    }
+    c.tcp->send();
+    return c.acked >= c.direct + total;
+}
+
+void HttpServer::finish(uint8_t i) {
+    Conn& c = conns[i];
+    c.head = String();
+    c.body = String();
+    if (!c.keepAlive) {
+        closeConn(c);
+        return;
+    }
+    bool wake = false;
+    portENTER_CRITICAL(&mux);
+    if (c.state == CONN_SENDING) {
+        // Сдвинуть пришедшее следом (конвейер) в начало буфера
+        memmove(c.rx, c.rx + c.reqLen, c.rxLen - c.reqLen);
+        c.rxLen -= c.reqLen;
+        c.rx[c.rxLen] = '\0';
+        c.reqLen = requestLength(c.rx, c.rxLen);
+        c.startMs = c.lastMs = millis();
+        c.state = (c.reqLen || c.oversized) ? CONN_READY : CONN_READING;
+        wake = (c.state == CONN_READY);
+    }
+    portEXIT_CRITICAL(&mux);
+    if (wake) tasksWakeHttp();
+}
+
+// --- Текущий запрос ---
+
+String HttpServer::arg(const String& name) const {
+    for (uint8_t i = 0; i < argCount; i++) {
+        if (argNames[i] == name) return argValues[i];
+    }
+    return String();
+}
+
+bool HttpServer::hasArg(const String& name) const {
+    for (uint8_t i = 0; i < argCount; i++) {
+        if (argNames[i] == name) return true;
+    }
+    return false;
+}
+
+String HttpServer::header(const String& name) const {
+    for (uint8_t k = 0; k < headerKeyCount; k++) {
+        if (strcasecmp(headerKeys[k], name.c_str()) == 0) return headerValues[k];
+    }
+    return String();
+}
+
+HttpStream HttpServer::client() {
+    if (cur < 0 || responded) return HttpStream();
+    Conn& c = conns[cur];
+    responded = true;
+    portENTER_CRITICAL(&mux);
+    bool ok = (c.state == CONN_READY);
+    if (ok) c.state = CONN_STREAM;
+    portEXIT_CRITICAL(&mux);
+    return ok ? HttpStream(this, (uint8_t)cur, c.gen) : HttpStream();
+}
+
+void HttpServer::sendHeader(const String& name, const String& value, bool first) {
+    String line = name + ": " + value + "\r\n";
+    if (first) pendingHeaders = line + pendingHeaders;
+    else pendingHeaders += line;
+}
+
+void HttpServer::queueResponse(int code, const char* content_type, size_t contentLength) {
+    Conn& c = conns[cur];
+    responded = true;
+    if (c.served >= HTTP_KEEPALIVE_MAX) c.keepAlive = false;
+
+    String& h = c.head;
+    h.reserve(128 + pendingHeaders.length());
+    h = "HTTP/1.1 ";
+    h += code;
+    h += ' ';
+    h += statusText(code);
+    h += "\r\n";
+    if (content_type) {
+        h += "Content-Type: ";
+        h += content_type;
+        h += "\r\n";
+    }
+    if (contentLength == CONTENT_LENGTH_UNKNOWN) {
+        h += "Transfer-Encoding: chunked\r\n";
+    } else {
+        h += "Content-Length: ";
+        h += (unsigned long)contentLength;
+        h += "\r\n";
+    }
+    h += pendingHeaders;
+    h += c.keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+    pendingHeaders = String();
+    if (reqMethod == HTTP_HEAD) c.bodyLen = 0;
+    c.sent = 0;
+    c.direct = 0;
+
+    portENTER_CRITICAL(&mux);
+    c.acked = 0;
+    if (c.state == CONN_READY) c.state = CONN_SENDING;
+    portEXIT_CRITICAL(&mux);
+}
+
+void HttpServer::send(int code, const char* content_type, const String& content) {
+    if (cur < 0 || responded) return;
+    Conn& c = conns[cur];
+    c.body = content;
+    c.bodyPtr = c.body.c_str();
+    c.bodyLen = c.body.length();
+    c.bodyInFlash = false;
+    queueResponse(code, content_type, c.bodyLen);
+}
+
+void HttpServer::send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength) {
+    if (cur < 0 || responded) return;
+    Conn& c = conns[cur];
+    c.body = String();
+    c.bodyPtr = content;
+    c.bodyLen = contentLength;
+    c.bodyInFlash = true;
+    queueResponse(code, content_type, contentLength);
+}
+
+Print& HttpServer::beginChunked(int code, const char* content_type) {
+    chunkWriter.srv = nullptr;
+    if (cur < 0 || responded) return chunkWriter;
+    Conn& c = conns[cur];
+    c.body = String();
+    c.bodyPtr = nullptr;
+    c.bodyLen = 0;
+    c.bodyInFlash = false;
+    queueResponse(code, content_type, CONTENT_LENGTH_UNKNOWN);
+    // Предыдущий ответ подтверждён целиком - окно свободно, заголовок уходит сразу
+    emit(c, c.head.c_str(), c.head.length());
+    c.head = String();
+    chunkedOpen = true;
+    if (reqMethod != HTTP_HEAD) {
+        chunkWriter.srv = this;
+        chunkWriter.len = 0;
+    }
+    return chunkWriter;
+}
+
+void HttpServer::endChunked() {
+    if (!chunkedOpen) return;
+    chunkedOpen = false;
+    Conn& c = conns[cur];
+    if (chunkWriter.srv) {
+        chunkWriter.flushChunk();
+        emit(c, "0\r\n\r\n", 5);
+    }
+    chunkWriter.srv = nullptr;
+    c.bodyPtr = c.body.c_str();
+    c.bodyLen = c.body.length();
+}
+
+// Запись потокового ответа: в окно TCP, пока оно не кончится и пока нет
+// хвоста в c.body (иначе нарушится порядок); остальное - в c.body, его
+// допишет pump() по подтверждениям
+void HttpServer::emit(Conn& c, const char* data, size_t len) {
+    if (!c.body.length() && c.tcp->space() >= len) {
+        size_t added = c.tcp->add(data, len);
+        c.direct += added;
+        data += added;
+        len -= added;
+        if (!len) return;
+    }
+    if (!c.body.length()) counters.spilled++;
+    c.body.reserve(c.body.length() + len);
+    for (size_t i = 0; i < len; i++) c.body += data[i];
+}
+
+#endif // USE_ASYNC_HTTP
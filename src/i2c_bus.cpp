@@ -0,0 +1,247 @@
+// =================================================================================
+// File:         src/i2c_bus.cpp
+// Description:  Реализация менеджера шины I2C: таблица устройств, транзакции
+//               под мьютексом шины, учёт ошибок, offline с паузой проб и
+//               освобождение залипшей шины.
+// =================================================================================
+
+#include "i2c_bus.h"
+#include "event_log.h"
+
+struct I2CDev {
+    const char* name;
+    uint8_t addr;
+    uint32_t clockHz;
+    uint16_t timeoutMs;
+    volatile bool online;
+    uint8_t consecutive;        // Ошибок подряд
+    uint32_t backoffMs;
+    uint32_t nextProbeMs;
+    uint32_t transactions, errors, nacks, timeouts, skipped, maxUs;
+    uint32_t winTx, winErr;     // Текущее окно доли ошибок
+    uint16_t ratePm;
+};
+
+static I2CDev devs[I2C_MAX_DEVICES];
+static uint8_t devCount = 0;
+static SemaphoreHandle_t busMutex = nullptr;
+static uint32_t wireClock = 0;              // 0 - применить при следующей транзакции
+static uint16_t wireTimeout = 0;
+static uint32_t recoveries = 0;
+static uint32_t busyCount = 0;
+static uint32_t windowStartMs = 0;
+
+int8_t i2cRegister(uint8_t addr, const char* name, uint32_t maxClockHz, uint16_t timeoutMs) {
+    if (devCount >= I2C_MAX_DEVICES) return -1;
+    I2CDev& d = devs[devCount];
+    d = I2CDev();
+    d.name = name;
+    d.addr = addr;
+    d.clockHz = (maxClockHz < I2C_BUS_CLOCK_HZ) ? maxClockHz : I2C_BUS_CLOCK_HZ;
+    d.timeoutMs = timeoutMs ? timeoutMs : 1;
+    return (int8_t)devCount++;
+}
+
+static void beginWire() {
+    Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN, I2C_BUS_CLOCK_HZ);
+    wireClock = 0;
+    wireTimeout = 0;
+}
+
+// Ведомый ждёт тактов, чтобы доотдать байт: до 9 импульсов SCL, пока он не
+// отпустит SDA, затем STOP (SDA 0 -> 1 при SCL = 1) и заново Wire.begin.
+static void recoverBus() {
+    Wire.end();
+    pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+    pinMode(I2C_SCL_PIN, OUTPUT_OPEN_DRAIN);
+    digitalWrite(I2C_SCL_PIN, HIGH);
+    delayMicroseconds(5);
+    uint8_t clocks = 0;
+    while (clocks < 9 && digitalRead(I2C_SDA_PIN) == LOW) {
+        digitalWrite(I2C_SCL_PIN, LOW);
+        delayMicroseconds(5);
+        digitalWrite(I2C_SCL_PIN, HIGH);
+        delayMicroseconds(5);
+        clocks++;
+    }
+    pinMode(I2C_SDA_PIN, OUTPUT_OPEN_DRAIN);
+    digitalWrite(I2C_SCL_PIN, LOW);
+    digitalWrite(I2C_SDA_PIN, LOW);
+    delayMicroseconds(5);
+    digitalWrite(I2C_SCL_PIN, HIGH);
+    delayMicroseconds(5);
+    digitalWrite(I2C_SDA_PIN, HIGH);
+    delayMicroseconds(5);
+    pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+    bool freed = (digitalRead(I2C_SDA_PIN) == HIGH);
+    beginWire();
+    recoveries++;
+    eventLog(EVT_I2C_RECOVERY, 0, clocks, freed ? 1 : 0);
+}
+
+static void goOffline(I2CDev& d) {
+    d.online = false;
+    d.backoffMs = I2C_BACKOFF_MIN_MS;
+    d.nextProbeMs = millis() + d.backoffMs;
+    eventLog(EVT_I2C_OFFLINE, 0, d.addr, d.consecutive);
+}
+
+// Одна транзакция на шине (мьютекс шины захвачен)
+static I2CResult runLocked(I2CDev& d, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen) {
+    if (d.clockHz != wireClock) {
+        Wire.setClock(d.clockHz);
+        wireClock = d.clockHz;
+    }
+    if (d.timeoutMs != wireTimeout) {
+        Wire.setTimeOut(d.timeoutMs);
+        wireTimeout = d.timeoutMs;
+    }
+
+    uint32_t start = (uint32_t)micros();
+    uint8_t err = 0;
+    if (txLen || !rxLen) {
+        Wire.beginTransmission(d.addr);
+        if (txLen) Wire.write(tx, txLen);
+        err = Wire.endTransmission(rxLen == 0);
+    }
+    if (!err && rxLen) {
+        if (Wire.requestFrom(d.addr, rxLen) != rxLen) {
+            err = 2;
+        } else {
+            for (uint8_t i = 0; i < rxLen; i++) rx[i] = (uint8_t)Wire.read();
+        }
+    }
+    uint32_t us = (uint32_t)micros() - start;
+
+    d.transactions++;
+    d.winTx++;
+    if (us > d.maxUs) d.maxUs = us;
+    if (!err) {
+        d.consecutive = 0;
+        return I2C_OK;
+    }
+
+    // Коды Wire различаются между версиями ядра - таймаут узнаём по времени
+    I2CResult res;
+    if (err == 5 || us >= (uint32_t)d.timeoutMs * 1000UL) res = I2C_TIMEOUT;
+    else if (err == 2 || err == 3) res = I2C_NACK;
+    else res = I2C_BUS_ERROR;
+    d.errors++;
+    d.winErr++;
+    if (res == I2C_NACK) d.nacks++;
+    else if (res == I2C_TIMEOUT) d.timeouts++;
+    if (res != I2C_NACK && digitalRead(I2C_SDA_PIN) == LOW) recoverBus();
+    if (d.consecutive < 255) d.consecutive++;
+    if (d.online && d.consecutive >= I2C_OFFLINE_ERRORS) goOffline(d);
+    return res;
+}
+
+static bool lockBus() {
+    if (!busMutex) return true;
+    return xSemaphoreTake(busMutex, pdMS_TO_TICKS(I2C_QUEUE_WAIT_MS)) == pdTRUE;
+}
+
+static void unlockBus() {
+    if (busMutex) xSemaphoreGive(busMutex);
+}
+
+void i2cBusInit() {
+    if (!busMutex) busMutex = xSemaphoreCreateMutex();
+    beginWire();
+    if (digitalRead(I2C_SDA_PIN) == LOW) recoverBus(); // Сброс посреди транзакции
+
+    Serial.println("Scanning I2C bus...");
+    for (uint8_t i = 0; i < devCount; i++) {
+        I2CDev& d = devs[i];
+        d.online = (runLocked(d, nullptr, 0, nullptr, 0) == I2C_OK);
+        d.consecutive = 0;
+        if (!d.online) {
+            d.backoffMs = I2C_BACKOFF_MIN_MS;
+            d.nextProbeMs = millis() + d.backoffMs;
+        }
+        Serial.printf("%s (0x%02X, %lu kHz) ... %s\n", d.name, d.addr, (unsigned long)(d.clockHz / 1000),
+                      d.online ? "ONLINE" : "OFFLINE");
+    }
+    windowStartMs = millis();
+}
+
+I2CResult i2cTransfer(int8_t dev, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen) {
+    if (dev < 0 || dev >= devCount) return I2C_BUS_ERROR;
+    I2CDev& d = devs[dev];
+    if (!d.online) {
+        d.skipped++;
+        return I2C_OFFLINE;
+    }
+    if (!lockBus()) {
+        busyCount++;
+        return I2C_BUSY;
+    }
+    I2CResult res = runLocked(d, tx, txLen, rx, rxLen);
+    unlockBus();
+    return res;
+}
+
+bool i2cOnline(int8_t dev) {
+    return dev >= 0 && dev < devCount && devs[dev].online;
+}
+
+void i2cBusTick() {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < devCount; i++) {
+        I2CDev& d = devs[i];
+        if (d.online || (int32_t)(now - d.nextProbeMs) < 0) continue;
+        if (!lockBus()) return;
+        bool ok = (runLocked(d, nullptr, 0, nullptr, 0) == I2C_OK);
+        unlockBus();
+        if (ok) {
+            d.backoffMs = 0;
+            d.online = true;
+            eventLog(EVT_I2C_ONLINE, 0, d.addr, 0);
+        } else {
+            d.backoffMs = (d.backoffMs * 2 < I2C_BACKOFF_MAX_MS) ? d.backoffMs * 2 : I2C_BACKOFF_MAX_MS;
+            d.nextProbeMs = millis() + d.backoffMs;
+        }
+    }
+
+    if (now - windowStartMs >= I2C_RATE_WINDOW_MS) {
+        windowStartMs = now;
+        if (!lockBus()) return;
+        for (uint8_t i = 0; i < devCount; i++) {
+            I2CDev& d = devs[i];
+            d.ratePm = d.winTx ? (uint16_t)((uint64_t)d.winErr * 1000 / d.winTx) : 0;
+            d.winTx = 0;
+            d.winErr = 0;
+        }
+        unlockBus();
+    }
+}
+
+uint8_t i2cDeviceCount() {
+    return devCount;
+}
+
+I2CDeviceInfo i2cDeviceInfo(uint8_t i) {
+    I2CDeviceInfo info = I2CDeviceInfo();
+    if (i >= devCount) return info;
+    const I2CDev& d = devs[i];
+    info.name = d.name;
+    info.addr = d.addr;
+    info.online = d.online;
+    info.transactions = d.transactions;
+    info.errors = d.errors;
+    info.nacks = d.nacks;
+    info.timeouts = d.timeouts;
+    info.skipped = d.skipped;
+    info.errorRatePm = d.ratePm;
+    info.backoffMs = d.online ? 0 : d.backoffMs;
+    info.maxUs = d.maxUs;
+    return info;
+}
+
+I2CBusInfo i2cBusInfo() {
+    I2CBusInfo info;
+    info.clockHz = I2C_BUS_CLOCK_HZ;
+    info.recoveries = recoveries;
+    info.busy = busyCount;
+    return info;
+}
@@ -0,0 +1,100 @@
+// =================================================================================
+// File:         src/inputs.cpp
+// Description:  Реализация образа дискретных входов и фильтра дребезга.
+// =================================================================================
+
+#include "inputs.h"
+#include "scheduler.h"
+#include "io_expanders.h"
+
+// Состояние платы: стабильные уровни выводов, вертикальный счётчик
+// выборок "сырое != стабильное" и окно по битам в том же виде
+struct InputBoardState {
+    uint16_t mask;        // Выводы, заведённые в INPUT_MAP (0 - плата без входов)
+    uint16_t stable;
+    uint16_t c0, c1, c2;  // Счётчик: бит i = разряды счётчика вывода i
+    uint16_t w0, w1, w2;  // Окно стабильности в тех же разрядах
+};
+
+static InputBoardState boards[IO_BOARD_COUNT];
+static volatile uint32_t image = 0;
+
+// Стабильные уровни плат -> логический образ
+static void updateImage() {
+    uint32_t img = 0;
+    for (uint8_t id = 0; id < INPUT_COUNT; id++) {
+        const IoPin& pin = INPUT_MAP[id].pin;
+        if ((boards[pin.board].stable >> pin.bit) & 1) img |= 1UL << id;
+    }
+    image = img;
+}
+
+void inputsInit() {
+    for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) boards[b] = InputBoardState();
+    for (uint8_t id = 0; id < INPUT_COUNT; id++) {
+        const InputDef& def = INPUT_MAP[id];
+        InputBoardState& st = boards[def.pin.board];
+        uint16_t bit = (uint16_t)(1u << def.pin.bit);
+        uint8_t w = constrain(def.debounceSamples, 1, 7);
+        st.mask |= bit;
+        if (def.initial) st.stable |= bit;
+        if (w & 1) st.w0 |= bit;
+        if (w & 2) st.w1 |= bit;
+        if (w & 4) st.w2 |= bit;
+    }
+    updateImage();
+}
+
+// Одна выборка: для несовпадающих с образом битов счётчик +1, для
+// совпадающих - сброс; бит, счётчик которого дошёл до окна, переключается.
+// Возвращает маску переключившихся битов.
+static uint16_t debounce(InputBoardState& st, uint16_t raw) {
+    uint16_t delta = (raw ^ st.stable) & st.mask;
+    uint16_t c0 = st.c0 & delta, c1 = st.c1 & delta, c2 = st.c2 & delta;
+
+    // Инкремент 3-битного счётчика сразу для всех битов delta
+    uint16_t carry = c0 & delta;
+    c0 ^= delta;
+    uint16_t carry2 = c1 & carry;
+    c1 ^= carry;
+    c2 ^= carry2;
+
+    uint16_t reached = delta & (uint16_t)~((c0 ^ st.w0) | (c1 ^ st.w1) | (c2 ^ st.w2));
+    st.stable ^= reached;
+    st.c0 = c0 & ~reached;
+    st.c1 = c1 & ~reached;
+    st.c2 = c2 & ~reached;
+    return reached;
+}
+
+bool inputsSample(uint32_t& recheckMs) {
+    recheckMs = SCHED_NEVER;
+    bool changed = false;
+
+    for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) {
+        InputBoardState& st = boards[b];
+        uint16_t raw;
+        if (!st.mask || !ioBoardRead(b, raw)) continue;
+
+        if (debounce(st, raw)) changed = true;
+        if (st.c0 | st.c1 | st.c2) recheckMs = INPUT_SAMPLE_MS;
+    }
+    if (changed) updateImage();
+    return changed;
+}
+
+bool inputGet(InputId id) {
+    if (id >= INPUT_COUNT) return false;
+    return (image >> id) & 1;
+}
+
+uint32_t inputsImage() {
+    return image;
+}
+
+bool inputsOnline() {
+    for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) {
+        if (boards[b].mask && !ioBoardOnline(b)) return false;
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+// =================================================================================
+// File:         src/io_expanders.cpp
+// Description:  Реализация драйверов расширителей портов: PCF8574/PCF8575
+//               и MCP23017 (IOCON.BANK = 0).
+// =================================================================================
+
+#include "io_expanders.h"
+#include "i2c_bus.h"
+
+static const uint8_t MCP_IODIRA = 0x00;
+static const uint8_t MCP_GPIOA = 0x12;
+static const uint8_t MCP_OLATA = 0x14;
+static const uint8_t MCP_IOCON = 0x44;      // MIRROR: INTA = INTB, ODR: INT - открытый сток
+
+struct IoBoardState {
+    int8_t dev;
+    bool configured;            // MCP23017 настроен; PCF857x - всегда
+    uint16_t levels;            // Последние заданные уровни выходов
+};
+
+static IoBoardState boards[IO_BOARD_COUNT];
+static_assert(IO_BOARD_COUNT + 2 <= I2C_MAX_DEVICES, "I2C_MAX_DEVICES: expander boards + RTC + OLED");
+
+static inline uint16_t word16(const uint8_t* b) {
+    return (uint16_t)(b[0] | (b[1] << 8));
+}
+
+static inline uint8_t byteCount(const IoBoardDef& def) {
+    return def.type == IOX_PCF8574 ? 1 : 2;
+}
+
+void ioBoardsInit() {
+    for (uint8_t b = 0; b < IO_BOARD_COUNT; b++) {
+        const IoBoardDef& def = IO_BOARDS[b];
+        IoBoardState& st = boards[b];
+        // PCF8574 - не быстрее 100 кГц, PCF8575 и MCP23017 - 400 кГц
+        st.dev = i2cRegister(def.addr, def.name, def.type == IOX_PCF8574 ? 100000 : 400000, 5);
+        st.configured = (def.type != IOX_MCP23017);
+        st.levels = def.activeLow & def.outputs; // Все выходы выключены
+    }
+}
+
+static bool mcpConfigure(IoBoardState& st, const IoBoardDef& def) {
+    uint16_t in = (uint16_t)~def.outputs;
+    const uint8_t olat[3] = { MCP_OLATA, (uint8_t)st.levels, (uint8_t)(st.levels >> 8) };
+    // IODIR, IPOL, GPINTEN, DEFVAL, INTCON, IOCON (A и B - один регистр), GPPU
+    const uint8_t cfg[15] = { MCP_IODIRA, (uint8_t)in, (uint8_t)(in >> 8), 0, 0,
+                              (uint8_t)in, (uint8_t)(in >> 8), 0, 0, 0, 0,
+                              MCP_IOCON, MCP_IOCON, (uint8_t)in, (uint8_t)(in >> 8) };
+    st.configured = i2cWrite(st.dev, olat, sizeof(olat)) == I2C_OK &&
+                    i2cWrite(st.dev, cfg, sizeof(cfg)) == I2C_OK;
+    return st.configured;
+}
+
+bool ioBoardRead(uint8_t board, uint16_t& pins) {
+    if (board >= IO_BOARD_COUNT) return false;
+    const IoBoardDef& def = IO_BOARDS[board];
+    IoBoardState& st = boards[board];
+    if (def.type != IOX_MCP23017) {
+        uint8_t rx[2] = { 0, 0 };
+        if (i2cRead(st.dev, rx, byteCount(def)) != I2C_OK) return false; // Ошибки и offline учитывает менеджер шины
+        pins = word16(rx);
+        return true;
+    }
+
+    if (!st.configured && !mcpConfigure(st, def)) return false;
+    const uint8_t reg = MCP_GPIOA;
+    uint8_t rx[6]; // GPIOA/B, OLATA/B, IODIRA/B
+    if (i2cTransfer(st.dev, &reg, 1, rx, sizeof(rx)) != I2C_OK || word16(rx + 4) != (uint16_t)~def.outputs) {
+        st.configured = false;
+        return false;
+    }
+    pins = word16(rx);
+    return true;
+}
+
+bool ioBoardWrite(uint8_t board, uint16_t levels) {
+    if (board >= IO_BOARD_COUNT) return false;
+    const IoBoardDef& def = IO_BOARDS[board];
+    IoBoardState& st = boards[board];
+    st.levels = levels & def.outputs;
+    if (def.type != IOX_MCP23017) {
+        // Вывод с "0" читается как 0, с "1" (слабая подтяжка) - как 1
+        uint16_t value = st.levels | (uint16_t)~def.outputs;
+        const uint8_t tx[2] = { (uint8_t)value, (uint8_t)(value >> 8) };
+        uint8_t rx[2] = { 0, 0 };
+        uint8_t n = byteCount(def);
+        return i2cTransfer(st.dev, tx, n, rx, n) == I2C_OK && ((word16(rx) ^ value) & def.outputs) == 0;
+    }
+
+    if (!st.configured && !mcpConfigure(st, def)) return false;
+    const uint8_t tx[3] = { MCP_GPIOA, (uint8_t)st.levels, (uint8_t)(st.levels >> 8) };
+    uint8_t rx[4]; // OLATA/B, IODIRA/B
+    if (i2cTransfer(st.dev, tx, sizeof(tx), rx, sizeof(rx)) != I2C_OK || word16(rx + 2) != (uint16_t)~def.outputs) {
+        st.configured = false;
+        return false;
+    }
+    return ((word16(rx) ^ st.levels) & def.outputs) == 0;
+}
+
+bool ioBoardOnline(uint8_t board) {
+    return board < IO_BOARD_COUNT && i2cOnline(boards[board].dev);
+}
@@ -0,0 +1,185 @@
+// =================================================================================
+// File:         src/json_writer.cpp
+// Description:  Реализация потоковой записи JSON и ответа JsonResponse.
+// =================================================================================
+
+#include "json_writer.h"
+
+// --- JsonWriter ---
+
+void JsonWriter::prefix(const char* key) {
+    if (depth) {
+        uint16_t bit = 1u << (depth - 1);
+        if (hasItems & bit) out.write(',');
+        hasItems |= bit;
+    }
+    if (key) {
+        writeString(key);
+        out.write(':');
+    }
+}
+
+void JsonWriter::writeString(const char* s) {
+    out.write('"');
+    const char* run = s;
+    for (; *s; s++) {
+        uint8_t ch = (uint8_t)*s;
+        if (ch >= 0x20 && ch != '"' && ch != '\\') continue; // UTF-8 - как есть
+        if (s > run) out.write((const uint8_t*)run, s - run);
+        char esc[8];
+        switch (ch) {
+            case '"':  out.write("\\\""); break;
+            case '\\': out.write("\\\\"); break;
+            case '\n': out.write("\\n"); break;
+            case '\r': out.write("\\r"); break;
+            case '\t': out.write("\\t"); break;
+            default:
+                snprintf(esc, sizeof(esc), "\\u%04x", ch);
+                out.write(esc);
+                break;
+        }
+        run = s + 1;
+    }
+    if (s > run) out.write((const uint8_t*)run, s - run);
+    out.write('"');
+}
+
+JsonWriter& JsonWriter::beginObject(const char* key) {
+    prefix(key);
+    out.write('{');
+    if (depth < JSON_WRITER_MAX_DEPTH) {
+        depth++;
+        hasItems &= ~(1u << (depth - 1));
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+    out.write('}');
+    if (depth) depth--;
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginArray(const char* key) {
+    prefix(key);
+    out.write('[');
+    if (depth < JSON_WRITER_MAX_DEPTH) {
+        depth++;
+        hasItems &= ~(1u << (depth - 1));
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+    out.write(']');
+    if (depth) depth--;
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, const char* value) {
+    prefix(key);
+    if (value) writeString(value);
+    else out.write("null");
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, bool value) {
+    prefix(key);
+    out.write(value ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, long value) {
+    char buf[16];
+    prefix(key);
+    out.write(buf, snprintf(buf, sizeof(buf), "%ld", value));
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, unsigned long value) {
+    char buf[16];
+    prefix(key);
+    out.write(buf, snprintf(buf, sizeof(buf), "%lu", value));
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const char* key, float value) {
+    prefix(key);
+    if (isnan(value) || isinf(value)) {
+        out.write("null");
+    } else {
+        char buf[24];
+        out.write(buf, snprintf(buf, sizeof(buf), "%.7g", (double)value));
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::fieldNull(const char* key) {
+    prefix(key);
+    out.write("null");
+    return *this;
+}
+
+JsonWriter& JsonWriter::fieldRaw(const char* key, const char* json) {
+    prefix(key);
+    out.write((json && *json) ? json : "null");
+    return *this;
+}
+
+// --- JsonResponse ---
+
+#if USE_ASYNC_HTTP
+
+static Print& beginResponse(int code) {
+    return server.beginChunked(code, "application/json");
+}
+
+static void endResponse() {
+    server.endChunked();
+}
+
+#else
+
+// Синхронный WebServer: те же куски через sendContent()
+class ChunkSink : public Print {
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t n) override {
+        for (size_t i = 0; i < n; i++) {
+            buf[len++] = (char)data[i];
+            if (len == sizeof(buf)) sendBuffered();
+        }
+        return n;
+    }
+    using Print::write;
+
+    void sendBuffered() {
+        if (len) server.sendContent(buf, len);
+        len = 0;
+    }
+
+private:
+    char buf[512];
+    size_t len = 0;
+};
+
+static ChunkSink chunkSink;
+
+static Print& beginResponse(int code) {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(code, "application/json", "");
+    return chunkSink;
+}
+
+static void endResponse() {
+    chunkSink.sendBuffered();
+    server.sendContent("");
+}
+
+#endif // USE_ASYNC_HTTP
+
+JsonResponse::JsonResponse(int code) : JsonWriter(beginResponse(code)) {}
+
+JsonResponse::~JsonResponse() {
+    endResponse();
+}
@@ -0,0 +1,278 @@
+// =================================================================================
+// File:         src/live_status.cpp
+// Description:  Реализация живого канала /api/live (SSE): таблица полей,
+//               сравнение с последним кадром и рассылка версий подписчикам.
+//               Всё выполняется в задаче web (обработчик и задание "live").
+// =================================================================================
+
+#include "live_status.h"
+#include "scheduler.h"
+#include "tasks.h"
+#include "utils.h"
+#include "sensors.h"
+#include "pid_control.h"
+#include "pump_control.h"
+#include "comfort.h"
+#include "inputs.h"
+
+#define LIVE_VALUE_LEN 20           // Значение поля в виде JSON ("\"S_WORKING\"", "55.25", "null")
+#define LIVE_FRAME_LEN 2048
+static const uint32_t LIVE_PING_MS = 15000; // Комментарий-пинг: мёртвые соединения отваливаются на записи
+
+// Уставка считается один раз за кадр - из неё три поля
+struct LiveSetpoint {
+    float tzavd;
+    float reduction;
+    bool comfort;
+};
+static LiveSetpoint setpoints[CONTOUR_COUNT];
+
+// --- Форматирование полей ---
+// idx - индекс контура (поля контура) или переменной OW_VARS (vars.*)
+
+typedef void (*LiveFmt)(uint8_t idx, char* buf, size_t len);
+
+struct LiveField {
+    const char* key;
+    LiveFmt fmt;
+};
+
+static void fmtOnline(char* buf, size_t len, bool online) {
+    snprintf(buf, len, online ? "\"ONLINE\"" : "\"OFFLINE\"");
+}
+
+static void fmtFloat(char* buf, size_t len, float v) {
+    if (isnan(v)) snprintf(buf, len, "null");
+    else snprintf(buf, len, "%.2f", v);
+}
+
+static void fmtDisplay(uint8_t, char* buf, size_t len) { fmtOnline(buf, len, isDisplayAvailable); }
+static void fmtRelay(uint8_t, char* buf, size_t len) { fmtOnline(buf, len, isRelayExpanderAvailable); }
+static void fmtInput(uint8_t, char* buf, size_t len) { fmtOnline(buf, len, isInputExpanderAvailable); }
+
+static void fmtRtcStatus(uint8_t, char* buf, size_t len) {
+    uint8_t hh, mm, dow;
+    fmtOnline(buf, len, isRtcAvailable && comfortClock(hh, mm, dow));
+}
+
+static void fmtRtcTime(uint8_t, char* buf, size_t len) {
+    static const char* days[] = {"(Нд)", "(Пн)", "(Вт)", "(Ср)", "(Чт)", "(Пт)", "(Сб)"};
+    uint8_t hh, mm, dow;
+    if (isRtcAvailable && comfortClock(hh, mm, dow)) snprintf(buf, len, "\"%02d:%02d %s\"", hh, mm, days[dow % 7]);
+    else snprintf(buf, len, "\"N/A\"");
+}
+
+static void fmtVar(uint8_t idx, char* buf, size_t len) {
+    bool alarm;
+    float t = getTempByVar(OW_VARS[idx], alarm);
+    if (alarm) snprintf(buf, len, "null");
+    else fmtFloat(buf, len, t);
+}
+
+static void fmtMode(uint8_t c, char* buf, size_t len) { snprintf(buf, len, "%d", (int)inputGet(CONTOURS[c].modeInput)); }
+static void fmtDryRun(uint8_t c, char* buf, size_t len) { snprintf(buf, len, "%d", (int)inputGet(CONTOURS[c].dryRunInput)); }
+static void fmtP1(uint8_t c, char* buf, size_t len) { snprintf(buf, len, "\"%s\"", getPumpStatusString(pumpLogic[c].pumps[0].status)); }
+static void fmtP2(uint8_t c, char* buf, size_t len) { snprintf(buf, len, "\"%s\"", getPumpStatusString(pumpLogic[c].pumps[1].status)); }
+static void fmtLogicState(uint8_t c, char* buf, size_t len) { snprintf(buf, len, "%d", (int)pumpLogic[c].state); }
+static void fmtActivePump(uint8_t c, char* buf, size_t len) { snprintf(buf, len, "%d", pumpLogic[c].activePumpIndex); }
+static void fmtSummer(uint8_t c, char* buf, size_t len) { snprintf(buf, len, pumpLogic[c].summer_mode_active ? "true" : "false"); }
+static void fmtComfort(uint8_t c, char* buf, size_t len) { snprintf(buf, len, setpoints[c].comfort ? "true" : "false"); }
+static void fmtReduction(uint8_t c, char* buf, size_t len) { fmtFloat(buf, len, setpoints[c].reduction); }
+static void fmtTzavd(uint8_t c, char* buf, size_t len) { fmtFloat(buf, len, setpoints[c].tzavd); }
+
+static void fmtValve(uint8_t c, char* buf, size_t len) {
+    const ContourDef& def = CONTOURS[c];
+    unsigned long now = millis();
+    bool closing = pulseEndTimes[def.valveCloseRelay] > 0 && (long)(now - pulseEndTimes[def.valveCloseRelay]) < 0;
+    bool opening = pulseEndTimes[def.valveOpenRelay] > 0 && (long)(now - pulseEndTimes[def.valveOpenRelay]) < 0;
+    snprintf(buf, len, "%d", closing ? -1 : (opening ? 1 : 0));
+}
+
+static void fmtProfile(uint8_t c, char* buf, size_t len) {
+    snprintf(buf, len, "\"%s\"", TILES[getProfileIndex(c + 1)].id);
+}
+
+static const LiveField GLOBAL_FIELDS[] = {
+    { "display", fmtDisplay }, { "relay", fmtRelay }, { "input", fmtInput },
+    { "rtc.status", fmtRtcStatus }, { "rtc.time", fmtRtcTime }
+};
+
+// Поля контура - ключ "c<N>.<key>", как в /api/main/status
+static const LiveField CONTOUR_FIELDS[] = {
+    { "mode", fmtMode }, { "dry_run", fmtDryRun }, { "p1_status", fmtP1 }, { "p2_status", fmtP2 },
+    { "logic_state", fmtLogicState }, { "active_pump", fmtActivePump }, { "summer_mode", fmtSummer },
+    { "valve", fmtValve }, { "isComfort", fmtComfort }, { "comfortReduction", fmtReduction },
+    { "tzavd", fmtTzavd }, { "profile", fmtProfile }
+};
+
+static const uint8_t GLOBAL_FIELD_COUNT = sizeof(GLOBAL_FIELDS) / sizeof(GLOBAL_FIELDS[0]);
+static const uint8_t CONTOUR_FIELD_COUNT = sizeof(CONTOUR_FIELDS) / sizeof(CONTOUR_FIELDS[0]);
+static const uint16_t LIVE_FIELD_COUNT = GLOBAL_FIELD_COUNT + OW_VAR_COUNT + CONTOUR_COUNT * CONTOUR_FIELD_COUNT;
+
+// Ключ и значение поля i в общей нумерации: глобальные, vars.*, контуры
+static void fieldKey(uint16_t i, char* buf, size_t len) {
+    if (i < GLOBAL_FIELD_COUNT) { snprintf(buf, len, "%s", GLOBAL_FIELDS[i].key); return; }
+    i -= GLOBAL_FIELD_COUNT;
+    if (i < OW_VAR_COUNT) { snprintf(buf, len, "vars.%s", OW_VARS[i]); return; }
+    i -= OW_VAR_COUNT;
+    snprintf(buf, len, "c%u.%s", (unsigned)(i / CONTOUR_FIELD_COUNT + 1), CONTOUR_FIELDS[i % CONTOUR_FIELD_COUNT].key);
+}
+
+static void fieldValue(uint16_t i, char* buf, size_t len) {
+    if (i < GLOBAL_FIELD_COUNT) { GLOBAL_FIELDS[i].fmt(0, buf, len); return; }
+    i -= GLOBAL_FIELD_COUNT;
+    if (i < OW_VAR_COUNT) { fmtVar((uint8_t)i, buf, len); return; }
+    i -= OW_VAR_COUNT;
+    CONTOUR_FIELDS[i % CONTOUR_FIELD_COUNT].fmt((uint8_t)(i / CONTOUR_FIELD_COUNT), buf, len);
+}
+
+// --- Состояние канала ---
+
+static char lastValues[LIVE_FIELD_COUNT][LIVE_VALUE_LEN]; // Последний разосланный кадр
+static bool lastValid = false;
+static uint32_t liveVersion = 0;
+#if USE_ASYNC_HTTP
+// Запись неблокирующая: кадр, не влезший в окно TCP, отключает подписчика -
+// браузер переподключится и получит полный снимок
+typedef HttpStream LiveClient;
+#else
+typedef WiFiClient LiveClient;
+#endif
+static LiveClient clients[LIVE_MAX_CLIENTS];
+static unsigned long lastSendTime = 0;
+
+static char body[LIVE_FRAME_LEN - 64]; // "ключ":значение,... без скобок; 64 - на заголовок события
+static size_t bodyLen = 0;
+static char frame[LIVE_FRAME_LEN];
+
+static bool bodyAppend(uint16_t i, const char* value) {
+    char key[24];
+    fieldKey(i, key, sizeof(key));
+    int n = snprintf(body + bodyLen, sizeof(body) - bodyLen, "%s\"%s\":%s", bodyLen ? "," : "", key, value);
+    if (n < 0 || (size_t)n >= sizeof(body) - bodyLen) {
+        body[bodyLen] = '\0';
+        return false;
+    }
+    bodyLen += n;
+    return true;
+}
+
+// Снять текущие значения; изменившиеся - в body. Возвращает число изменений.
+static uint16_t collectChanges() {
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        LiveSetpoint& sp = setpoints[c];
+        sp.comfort = false;
+        sp.reduction = 0.0f;
+        sp.tzavd = calculateSetpoint(c + 1, sp.comfort, sp.reduction);
+    }
+    bodyLen = 0;
+    body[0] = '\0';
+    uint16_t changed = 0;
+    char value[LIVE_VALUE_LEN];
+    for (uint16_t i = 0; i < LIVE_FIELD_COUNT; i++) {
+        fieldValue(i, value, sizeof(value));
+        if (lastValid && strcmp(value, lastValues[i]) == 0) continue;
+        if (!bodyAppend(i, value)) break; // Не влезло - уйдёт следующим кадром
+        memcpy(lastValues[i], value, sizeof(value));
+        changed++;
+    }
+    lastValid = true;
+    return changed;
+}
+
+static size_t buildFrame(const char* event) {
+    int n = snprintf(frame, sizeof(frame), "id: %lu\nevent: %s\ndata: {\"v\":%lu,\"f\":{%s}}\n\n",
+                     (unsigned long)liveVersion, event, (unsigned long)liveVersion, body);
+    return (n < 0) ? 0 : ((size_t)n < sizeof(frame) ? (size_t)n : sizeof(frame) - 1);
+}
+
+static void sendTo(uint8_t i, const char* data, size_t len) {
+    LiveClient& c = clients[i];
+    if (!c.connected()) return;
+    if (c.write((const uint8_t*)data, len) != len) {
+        c.stop();
+        clients[i] = LiveClient();
+    }
+}
+
+static void sendAll(const char* data, size_t len) {
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) sendTo(i, data, len);
+    lastSendTime = millis();
+}
+
+static void dropAll() {
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        if (clients[i].connected()) clients[i].stop();
+        clients[i] = LiveClient();
+    }
+}
+
+static void publishDelta() {
+    if (!collectChanges()) return;
+    liveVersion++;
+    size_t len = buildFrame("delta");
+    sendAll(frame, len);
+}
+
+uint8_t liveClientCount() {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        if (clients[i].connected()) n++;
+    }
+    return n;
+}
+
+uint32_t livePublish() {
+    if (!apModeActive) {
+        dropAll();
+        return SCHED_NEVER;
+    }
+    if (!liveClientCount()) return SCHED_NEVER;
+
+    publishDelta();
+
+    unsigned long idle = millis() - lastSendTime;
+    if (idle >= LIVE_PING_MS) {
+        sendAll(":\n\n", 3);
+        idle = 0;
+    }
+    return liveClientCount() ? (uint32_t)(LIVE_PING_MS - idle) : SCHED_NEVER;
+}
+
+void handleLiveSubscribe() {
+    int8_t slot = -1;
+    for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        if (!clients[i].connected()) { slot = i; break; }
+    }
+    if (slot < 0) {
+        // Браузер останется на опросах
+        server.send(503, "application/json", "{\"ok\":false,\"err\":\"live_busy\"}");
+        return;
+    }
+
+    // Текущие подписчики получают накопившуюся дельту - новый стартует с той же версии
+    if (liveClientCount()) publishDelta();
+    else collectChanges();
+
+    static const char HEAD[] =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: keep-alive\r\n\r\n"
+        "retry: 3000\n\n";
+    LiveClient c = server.client();
+    c.setNoDelay(true);
+    clients[slot] = c;
+    sendTo(slot, HEAD, sizeof(HEAD) - 1);
+
+    bodyLen = 0;
+    body[0] = '\0';
+    for (uint16_t i = 0; i < LIVE_FIELD_COUNT; i++) {
+        if (!lastValues[i][0]) continue; // Ещё не снято (не влезло в кадр)
+        if (!bodyAppend(i, lastValues[i])) break;
+    }
+    size_t len = buildFrame("full");
+    sendTo(slot, frame, len);
+    lastSendTime = millis();
+    tasksWakeLive(); // Запланировать пинг
+}
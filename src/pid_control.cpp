@@ -8,28 +8,41 @@
 #include "sensors.h"
 #include "web_server.h"
 #include "utils.h"
+#include "settings.h"
+#include "heating_curve.h"
+#include "comfort.h"
+#include "tasks.h"
+#include "historian.h"
+#include "event_log.h"
+#include <atomic>
+
+// Запросы pidRequestReset: бит контура (cont - 1)
+static std::atomic<uint8_t> resetRequests(0);
+static_assert(CONTOUR_COUNT <= 8, "resetRequests holds 8 contours");
+
+void pidRequestReset(uint8_t contourNum) {
+    if (isContour(contourNum)) resetRequests.fetch_or((uint8_t)(1 << (contourNum - 1)));
+}
 
 // --- Основная функция логики ПИ-регулятора ---
 
 void runPIDLogic(int contourNum) {
-    PIDController& pid = (contourNum == 1) ? pidController1 : pidController2;
-    int relay_plus = (contourNum == 1) ? 2 : 6;
-    int relay_minus = (contourNum == 1) ? 1 : 5;
-
+    if (!isContour(contourNum)) return;
+    PIDController& pid = pidControllers[contourNum - 1];
+    uint8_t resetBit = (uint8_t)(1 << (contourNum - 1));
+    if (resetRequests.fetch_and((uint8_t)~resetBit) & resetBit) pid.integralSum = 0;
+    int relay_plus = CONTOURS[contourNum - 1].valveOpenRelay;
+    int relay_minus = CONTOURS[contourNum - 1].valveCloseRelay;
+
+    // Период (1 с) задаёт планировщик задачи control
     unsigned long currentTime = millis();
-    if (currentTime - pid.lastRunTime < 1000) { // Запускаем не чаще раза в секунду
-        return;
-    }
     pid.lastRunTime = currentTime;
 
     bool isComfort, isSummer;
     float comfortReduction;
     float setpoint = calculateSetpoint(contourNum, isComfort, comfortReduction);
 
-    String profileId = getProfileId(contourNum);
-    int tileIdx = tileIndexById(profileId);
-    if (tileIdx < 0) return;
-    const TileDef& tile = getTile(tileIdx);
+    const TileDef& tile = getTile(getProfileIndex(contourNum));
 
     bool tpod_alarm;
     float tpod = getTempByVar(tile.TPOD, tpod_alarm);
@@ -42,12 +55,14 @@ void runPIDLogic(int contourNum) {
 
     float error = setpoint - tpod;
 
-    prefsGeneral.begin("general", true);
-    String pi_prefix = (contourNum == 1) ? "pi1_" : "pi2_";
-    float Kp = prefsGeneral.getFloat((pi_prefix + "Kp").c_str(), 0.1f);
-    float Ki = prefsGeneral.getFloat((pi_prefix + "Ki").c_str(), 0.01f);
-    float Ti = prefsGeneral.getFloat((pi_prefix + "Ti").c_str(), 10.0f);
-    prefsGeneral.end();
+    PiParams pi;
+    {
+        MutexLock lock(settingsMutex); // Копия: веб-задача может сохранять коэффициенты
+        pi = appSettings.pi[contourNum - 1];
+    }
+    float Kp = pi.Kp;
+    float Ki = pi.Ki;
+    float Ti = pi.Ti;
 
     pid.integralSum += error;
     // Ограничение интегральной суммы (anti-windup)
@@ -63,6 +78,8 @@ void runPIDLogic(int contourNum) {
     if (direction != 0 && (currentTime - pid.lastImpulseTime) > (unsigned long)(Ti * 1000)) {
         int pulse_duration = 1000; // Длительность импульса 1 секунда
         triggerRelayPulse(direction == 1 ? relay_plus : relay_minus, pulse_duration);
+        histValvePulse(contourNum, direction, pulse_duration);
+        eventLog(EVT_VALVE_PULSE, contourNum, direction == 1 ? 1 : 0, pulse_duration);
         pid.lastImpulseTime = currentTime;
         pid.lastDirection = direction;
     } else {
@@ -76,11 +93,9 @@ void runPIDLogic(int contourNum) {
 float calculateSetpoint(int contourNum, bool& isComfortActive, float& comfortReduction) {
     isComfortActive = false;
     comfortReduction = 0.0f;
+    MutexLock lock(settingsMutex); // appSettings.curve может перезаписываться из веб-задачи
 
-    String profileId = getProfileId(contourNum);
-    int tileIdx = tileIndexById(profileId);
-    if (tileIdx < 0) return NAN;
-    
+    uint8_t tileIdx = getProfileIndex(contourNum);
     const TileDef& tile = getTile(tileIdx);
     bool tn_alarm, tpod_alarm;
     float tn = getTempByVar("Tn", tn_alarm);
@@ -88,101 +103,34 @@ float calculateSetpoint(int contourNum, bool& isComfortActive, float& comfortRed
 
     float baseSetpoint = NAN;
 
-    if (profileId.startsWith("GVP")) {
+    if (strncmp(tile.id, "GVP", 3) == 0) {
         if (!tpod_alarm) {
-            prefsParams.begin("params", true);
-            baseSetpoint = prefsParams.getFloat(tile.TZAD, tile.defaultValue);
-            prefsParams.end();
+            baseSetpoint = settingsTzadForTile(tileIdx);
         }
-    } else if (profileId.startsWith("CO")) {
-        prefsParams.begin("params", true);
-        float coefficient = prefsParams.getFloat(tile.TZAD, tile.defaultValue);
-        prefsParams.end();
-
-        prefsGeneral.begin("general", true);
-        String jsonPoints = prefsGeneral.getString("curvePoints", "[]");
-        float summerCutoffTemp = prefsGeneral.getFloat("summerCutoff", 20.0f);
-        prefsGeneral.end();
+    } else if (strncmp(tile.id, "CO", 2) == 0) {
+        float coefficient = settingsTzadForTile(tileIdx);
+        float summerCutoffTemp = appSettings.summerCutoff;
 
         if (!tn_alarm && tn >= summerCutoffTemp) {
             return NAN; // Летний режим
         }
 
         if (!tn_alarm) {
-            // Расчет по кривой
-            StaticJsonDocument<256> doc;
-            deserializeJson(doc, jsonPoints);
-            JsonArray array = doc.as<JsonArray>();
-            if (array.size() == 5) {
-                float x[5], y[5];
-                for(int i=0; i<5; i++) { x[i] = array[i]["x"]; y[i] = array[i]["y"]; }
-                
-                // Сортировка точек на случай, если они в NVS хранятся не по порядку
-                for(int i=0; i<4; i++) {
-                    for(int j=0; j<4-i; j++) {
-                        if(x[j] > x[j+1]) {
-                            float tempX = x[j]; x[j] = x[j+1]; x[j+1] = tempX;
-                            float tempY = y[j]; y[j] = y[j+1]; y[j+1] = tempY;
-                        }
-                    }
-                }
-                
-                // Простая линейная интерполяция
-                if (tn <= x[0]) baseSetpoint = y[0];
-                else if (tn >= x[4]) baseSetpoint = y[4];
-                else {
-                    for (int i = 0; i < 4; i++) {
-                        if (tn >= x[i] && tn <= x[i+1]) {
-                            baseSetpoint = y[i] + (tn - x[i]) * (y[i+1] - y[i]) / (x[i+1] - x[i]);
-                            break;
-                        }
-                    }
-                }
-                if (!isnan(baseSetpoint)) {
-                    baseSetpoint *= coefficient;
-                }
+            // Расчет по кривой (график подготовлен при загрузке/сохранении)
+            baseSetpoint = curveEvaluate(appSettings.curve, tn);
+            if (!isnan(baseSetpoint)) {
+                baseSetpoint *= coefficient;
             }
         }
     }
 
-    // Логика комфортного режима (если RTC доступен)
-    if (isRtcAvailable && !isnan(baseSetpoint)) {
-        prefsGeneral.begin("general", true);
-        bool timeWasSet = prefsGeneral.getBool("timeWasSet", false);
-        String comfortKey = (contourNum == 1) ? "comfort1" : "comfort2";
-        String comfortJsonStr = prefsGeneral.getString(comfortKey.c_str(), "{}");
-        prefsGeneral.end();
-
-        if (timeWasSet) {
-            StaticJsonDocument<512> doc;
-            deserializeJson(doc, comfortJsonStr);
-
-            if (doc["enabled"] | false) {
-                DateTime now = rtc.now();
-                int currentDow = now.dayOfTheWeek();
-                int currentMinutes = now.hour() * 60 + now.minute();
-                
-                JsonArray days = doc["days"];
-                bool todayIsActive = false;
-                for(int day : days) { if (day == currentDow) { todayIsActive = true; break; } }
-
-                if (todayIsActive) {
-                    JsonArray intervals = doc["intervals"];
-                    for(JsonObject interval : intervals) {
-                        String startStr = interval["start"] | "00:00";
-                        String endStr = interval["end"] | "00:00";
-                        int startMins = (startStr.substring(0,2).toInt() * 60) + startStr.substring(3,5).toInt();
-                        int endMins = (endStr.substring(0,2).toInt() * 60) + endStr.substring(3,5).toInt();
-                        if (endMins == 0 && startMins > 0) endMins = 1440;
-
-                        if (currentMinutes >= startMins && currentMinutes < endMins) {
-                            isComfortActive = true;
-                            comfortReduction = interval["reduct"] | 0.0f;
-                            return baseSetpoint + comfortReduction;
-                        }
-                    }
-                }
-            }
+    // Логика комфортного режима (состояние пересчитывается раз в минуту в comfortTick)
+    if (!isnan(baseSetpoint)) {
+        float reduction;
+        if (comfortActive(contourNum, reduction)) {
+            isComfortActive = true;
+            comfortReduction = reduction;
+            return baseSetpoint + comfortReduction;
         }
     }
     
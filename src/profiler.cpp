@@ -0,0 +1,154 @@
+// =================================================================================
+// File:         src/profiler.cpp
+// Description:  Реализация профилировщика этапов: таблица статистики,
+//               выдача в /api/perf и в Serial.
+// =================================================================================
+
+#include "profiler.h"
+#include "json_writer.h"
+
+// Дольше - счётчик тактов мог переполниться, длительность берётся по micros()
+static const uint32_t PERF_CYCLES_SAFE_US = 10000000UL;
+
+static PerfStat stats[PERF_MAX_STAGES];
+static uint8_t statCount = 0;
+static volatile uint32_t resetGen = 0;
+static unsigned long resetAtMs = 0;
+
+int8_t perfRegister(const char* group, const char* name) {
+    if (statCount >= PERF_MAX_STAGES) return -1;
+    PerfStat& st = stats[statCount];
+    st = PerfStat();
+    st.group = group;
+    st.name = name;
+    st.minCycles = UINT32_MAX;
+    return (int8_t)statCount++;
+}
+
+static inline uint8_t bucketOf(uint32_t us) {
+    if (!us) return 0;
+    uint8_t b = (uint8_t)(32 - __builtin_clz(us)); // us в [2^(b-1), 2^b)
+    return b < PERF_BUCKETS ? b : PERF_BUCKETS - 1;
+}
+
+static void record(PerfStat& st, uint32_t cycles, uint32_t us) {
+    uint32_t gen = resetGen;
+    if (st.gen != gen) {
+        st.count = 0;
+        st.minCycles = UINT32_MAX;
+        st.maxUs = 0;
+        st.sumCycles = 0;
+        memset(st.hist, 0, sizeof(st.hist));
+        st.gen = gen;
+    }
+    st.count++;
+    if (cycles < st.minCycles) st.minCycles = cycles;
+    if (us > st.maxUs) st.maxUs = us;
+    st.sumCycles += cycles;
+    st.hist[bucketOf(us)]++;
+}
+
+void perfStop(int8_t id, const PerfMark& m) {
+    if (id < 0 || id >= statCount) return;
+    uint32_t cycles = ESP.getCycleCount() - m.cycles;
+    uint32_t us = (uint32_t)micros() - m.us;
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    if (us < PERF_CYCLES_SAFE_US) us = cycles / mhz;
+    else cycles = (us >= UINT32_MAX / mhz) ? UINT32_MAX : us * mhz;
+    record(stats[id], cycles, us);
+}
+
+void perfRecordUs(int8_t id, uint32_t us) {
+    if (id < 0 || id >= statCount) return;
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    record(stats[id], (us >= UINT32_MAX / mhz) ? UINT32_MAX : us * mhz, us);
+}
+
+void perfReset() {
+    resetGen = resetGen + 1;
+    resetAtMs = millis();
+}
+
+// Данные этапа текущего поколения (после сброса, до первой записи - пусто)
+static bool current(const PerfStat& st) {
+    return st.gen == resetGen && st.count;
+}
+
+// --- Выдача ---
+
+void handlePerf() {
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.field("cpu_mhz", mhz);
+    w.field("window_ms", (unsigned long)(millis() - resetAtMs));
+    w.beginArray("bucket_us");
+    w.field(nullptr, 0);
+    for (uint8_t b = 1; b < PERF_BUCKETS; b++) w.field(nullptr, 1UL << (b - 1));
+    w.endArray();
+    w.beginArray("stages");
+    for (uint8_t i = 0; i < statCount; i++) {
+        const PerfStat& st = stats[i];
+        bool have = current(st);
+        w.beginObject();
+        w.field("task", st.group);
+        w.field("name", st.name);
+        w.field("count", have ? st.count : 0);
+        w.field("min_us", have ? (float)st.minCycles / mhz : 0.0f);
+        w.field("mean_us", have ? (float)((double)st.sumCycles / st.count / mhz) : 0.0f);
+        w.field("max_us", have ? st.maxUs : 0);
+        // Гистограмма без хвоста пустых корзин
+        uint8_t last = 0;
+        for (uint8_t b = 0; have && b < PERF_BUCKETS; b++) if (st.hist[b]) last = b + 1;
+        w.beginArray("hist");
+        for (uint8_t b = 0; b < last; b++) w.field(nullptr, st.hist[b]);
+        w.endArray();
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+}
+
+void handlePerfReset() {
+    perfReset();
+    server.send(200, "application/json", "{\"ok\":true}");
+}
+
+static void printTable() {
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    Serial.printf("[PERF] %lu ms since reset, buckets: <1us, then powers of two up to %lu us\n",
+                  (unsigned long)(millis() - resetAtMs), 1UL << (PERF_BUCKETS - 2));
+    Serial.println("[PERF] task     stage        count      min_us    mean_us     max_us  histogram");
+    for (uint8_t i = 0; i < statCount; i++) {
+        const PerfStat& st = stats[i];
+        if (!current(st)) continue;
+        Serial.printf("[PERF] %-8s %-10s %8lu %10.1f %10.1f %10lu ", st.group, st.name, (unsigned long)st.count,
+                      (float)st.minCycles / mhz, (float)((double)st.sumCycles / st.count / mhz), (unsigned long)st.maxUs);
+        for (uint8_t b = 0; b < PERF_BUCKETS; b++) {
+            if (st.hist[b]) Serial.printf(" %s%lu:%lu", b ? "" : "<", b ? 1UL << (b - 1) : 1UL, (unsigned long)st.hist[b]);
+        }
+        Serial.println();
+    }
+}
+
+void perfSerialPoll() {
+    static char line[24];
+    static uint8_t len = 0;
+    while (Serial.available()) {
+        int c = Serial.read();
+        if (c < 0) break;
+        if (c != '\n' && c != '\r') {
+            if (len < sizeof(line) - 1) line[len++] = (char)c;
+            continue;
+        }
+        line[len] = '\0';
+        len = 0;
+        if (strcmp(line, "perf") == 0) {
+            printTable();
+        } else if (strcmp(line, "perf reset") == 0) {
+            perfReset();
+            Serial.println("[PERF] reset");
+        }
+    }
+}
@@ -7,6 +7,9 @@
 #include "pump_control.h"
 #include "hardware.h"
 #include "sensors.h"
+#include "inputs.h"
+#include "event_log.h"
+#include <atomic>
 
 // --- Вспомогательные константы (таймауты) ---
 const unsigned long PUMP_START_DELAY = 5000;       // 5 секунд задержки перед стартом
@@ -15,21 +18,34 @@ const unsigned long PUMP_CHANGEOVER_PAUSE = 3000;  // 3 секунды пауз
 const unsigned long DRY_RUN_RECOVERY_TIME = 600000; // 10 минут на восстановление после сухого хода
 const unsigned long DRY_RUN_ALARM_DELAY = 15000;   // 15 секунд задержки до срабатывания тревоги по сухому ходу
 
+// Запросы pumpLogicRequestIdle: бит контура (cont - 1)
+static std::atomic<uint8_t> idleRequests(0);
+static_assert(CONTOUR_COUNT <= 8, "idleRequests holds 8 contours");
+
+void pumpLogicRequestIdle(uint8_t contourNum) {
+    if (isContour(contourNum)) idleRequests.fetch_or((uint8_t)(1 << (contourNum - 1)));
+}
+
 // --- Главная функция логики ---
 
 void runPumpLogic(int contourNum) {
     // 1. Определяем, с каким контуром работаем, и получаем ссылки на его переменные
-    ContourPumpLogic& logic = (contourNum == 1) ? pumpLogic1 : pumpLogic2;
-    int mode_stable = (contourNum == 1) ? contour1_mode_stable : contour2_mode_stable;
-    int dry_run_stable = (contourNum == 1) ? dry_run_state_stable : dry_run_state_2_stable;
-    int p1_feedback = (contourNum == 1) ? pump1_state_stable : pump3_state_stable;
-    int p2_feedback = (contourNum == 1) ? pump2_state_stable : pump4_state_stable;
-    int p1_relay = (contourNum == 1) ? 3 : 7;
-    int p2_relay = (contourNum == 1) ? 4 : 0;
-    uint8_t p1_enable_bit = (contourNum == 1) ? 0 : 2;
-    uint8_t p2_enable_bit = (contourNum == 1) ? 1 : 3;
+    if (!isContour(contourNum)) return;
+    const ContourDef& def = CONTOURS[contourNum - 1];
+    ContourPumpLogic& logic = pumpLogic[contourNum - 1];
+    uint8_t idleBit = (uint8_t)(1 << (contourNum - 1));
+    if (idleRequests.fetch_and((uint8_t)~idleBit) & idleBit) logic.state = S_IDLE;
+    int mode_stable = inputGet(def.modeInput);
+    int dry_run_stable = inputGet(def.dryRunInput);
+    int p1_feedback = inputGet(def.pumpFeedback[0]);
+    int p2_feedback = inputGet(def.pumpFeedback[1]);
+    int p1_relay = def.pumpRelay[0];
+    int p2_relay = def.pumpRelay[1];
+    uint8_t p1_enable_bit = def.pumpEnableBit[0];
+    uint8_t p2_enable_bit = def.pumpEnableBit[1];
 
     unsigned long currentTime = millis();
+    ContourLogicState prevState = logic.state;
     int feedbacks[] = {p1_feedback, p2_feedback};
     int relays[] = {p1_relay, p2_relay};
     uint8_t enable_bits[] = {p1_enable_bit, p2_enable_bit};
@@ -37,8 +53,7 @@ void runPumpLogic(int contourNum) {
     // 2. Проверка на летний режим (из старого проекта)
     bool tn_alarm;
     float tn = getTempByVar("Tn", tn_alarm);
-    float summerCutoff = prefsGeneral.getFloat("summerCutoff", 20.0f);
-    logic.summer_mode_active = !tn_alarm && (tn > summerCutoff);
+    logic.summer_mode_active = !tn_alarm && (tn > appSettings.summerCutoff);
 
     // 3. Логика сброса аварий
     if (logic.pumps[0].status == S_ALARM && (globalPumpEnableMask & (1 << enable_bits[0]))) logic.pumps[0].status = S_OK;
@@ -87,6 +102,7 @@ void runPumpLogic(int contourNum) {
                 logic.state = S_NORMAL;
             } else if (currentTime - logic.stateTimer >= PUMP_FEEDBACK_TIMEOUT) {
                 logic.pumps[logic.activePumpIndex].status = S_ALARM;
+                eventLog(EVT_PUMP_ALARM, contourNum, logic.activePumpIndex + 1, 0);
                 setRelay(relays[logic.activePumpIndex], false);
                 logic.state = S_CHANGEOVER_PAUSE;
                 logic.stateTimer = currentTime;
@@ -99,6 +115,7 @@ void runPumpLogic(int contourNum) {
             } else if (feedbacks[logic.activePumpIndex] == 0) {
                 logic.pumps[logic.activePumpIndex].feedbackLossTime = currentTime;
                 logic.pumps[logic.activePumpIndex].status = S_ALARM;
+                eventLog(EVT_PUMP_ALARM, contourNum, logic.activePumpIndex + 1, 1);
                 setRelay(relays[logic.activePumpIndex], false);
                 logic.state = S_CHANGEOVER_PAUSE;
                 logic.stateTimer = currentTime;
@@ -132,10 +149,20 @@ void runPumpLogic(int contourNum) {
             // Фактически останавливаем все, если тревога подтвердилась
             setRelay(p1_relay, false);
             setRelay(p2_relay, false);
+            if (!logic.dryRunAlarmActive) {
+                logic.dryRunAlarmActive = true;
+                eventLog(EVT_DRY_RUN, contourNum, 1, 0);
+            }
         }
     } else { // Сухой ход неактивен
         logic.dryRunAlarmPending = false;
+        if (logic.dryRunAlarmActive) {
+            logic.dryRunAlarmActive = false;
+            eventLog(EVT_DRY_RUN, contourNum, 0, 0);
+        }
     }
+
+    if (logic.state != prevState) eventLog(EVT_PUMP_STATE, contourNum, logic.state, prevState);
 }
 
 
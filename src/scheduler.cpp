@@ -0,0 +1,124 @@
+// =================================================================================
+// File:         src/scheduler.cpp
+// Description:  Реализация планировщика заданий по срокам.
+// =================================================================================
+
+#include "scheduler.h"
+#include "profiler.h"
+
+static int8_t addJob(Scheduler& s, const char* name, SchedJobFn fn, uint32_t periodMs, bool armed, uint32_t phaseMs) {
+    if (s.count >= SCHED_MAX_JOBS || !fn || (armed && periodMs == 0)) {
+        Serial.printf("Scheduler %s: cannot add job %s (%u/%u jobs)\n", s.name ? s.name : "?", name,
+                      (unsigned)s.count, (unsigned)SCHED_MAX_JOBS);
+        Serial.flush();
+        abort();
+    }
+    SchedJob& j = s.jobs[s.count];
+    j = SchedJob();
+    j.name = name;
+    j.fn = fn;
+    j.periodUs = periodMs * 1000UL;
+    j.dueUs = micros() + phaseMs * 1000UL;
+    j.armed = armed;
+    j.perfId = perfRegister(s.name, name);
+    return (int8_t)s.count++;
+}
+
+int8_t schedAddPeriodic(Scheduler& s, const char* name, SchedJobFn fn, uint32_t periodMs, uint32_t phaseMs) {
+    return addJob(s, name, fn, periodMs, true, phaseMs);
+}
+
+int8_t schedAddOneShot(Scheduler& s, const char* name, SchedJobFn fn) {
+    return addJob(s, name, fn, 0, false, 0);
+}
+
+void schedArm(Scheduler& s, int8_t id, uint32_t delayMs) {
+    if (id < 0 || id >= s.count) return;
+    SchedJob& j = s.jobs[id];
+    uint32_t due = micros() + delayMs * 1000UL;
+
+    portENTER_CRITICAL(&s.mux);
+    if (!j.armed || (int32_t)(due - j.dueUs) < 0) {
+        j.dueUs = due;
+        j.armed = true;
+    }
+    portEXIT_CRITICAL(&s.mux);
+
+#if USE_RTOS_TASKS
+    if (s.owner && s.owner != xTaskGetCurrentTaskHandle()) xTaskNotifyGive(s.owner);
+#endif
+}
+
+void IRAM_ATTR schedArmFromIsr(Scheduler& s, int8_t id) {
+    if (id < 0 || id >= s.count) return;
+    portENTER_CRITICAL_ISR(&s.mux);
+    s.isrPending |= (1UL << id);
+    portEXIT_CRITICAL_ISR(&s.mux);
+
+#if USE_RTOS_TASKS
+    BaseType_t woken = pdFALSE;
+    if (s.owner) vTaskNotifyGiveFromISR(s.owner, &woken);
+    if (woken) portYIELD_FROM_ISR();
+#endif
+}
+
+uint32_t schedRunDue(Scheduler& s) {
+    // Задания, взведённые из прерываний, - срок "сейчас"
+    portENTER_CRITICAL(&s.mux);
+    uint32_t pending = s.isrPending;
+    s.isrPending = 0;
+    uint32_t nowUs = micros();
+    for (uint8_t i = 0; pending && i < s.count; i++) {
+        if (!(pending & (1UL << i))) continue;
+        SchedJob& j = s.jobs[i];
+        if (!j.armed || (int32_t)(nowUs - j.dueUs) < 0) {
+            j.dueUs = nowUs;
+            j.armed = true;
+        }
+    }
+    portEXIT_CRITICAL(&s.mux);
+
+    for (uint8_t i = 0; i < s.count; i++) {
+        SchedJob& j = s.jobs[i];
+
+        portENTER_CRITICAL(&s.mux);
+        bool due = j.armed && (int32_t)(micros() - j.dueUs) >= 0;
+        uint32_t dueUs = j.dueUs;
+        if (due && j.periodUs == 0) j.armed = false; // Однократное: задание может взвести себя снова
+        portEXIT_CRITICAL(&s.mux);
+        if (!due) continue;
+
+        uint32_t late = micros() - dueUs;
+        if (late > j.maxLateUs) j.maxLateUs = late;
+        perfRecordUs(s.latePerf, late);
+
+        PerfMark mark = perfStart();
+        j.fn();
+        perfStop(j.perfId, mark);
+        j.runs++;
+
+        if (j.periodUs) {
+            // Следующий срок - по сетке; если опоздали на целый период, сетка сдвигается
+            j.dueUs += j.periodUs;
+            if ((int32_t)(micros() - j.dueUs) >= 0) {
+                j.skipped++;
+                j.dueUs = micros() + j.periodUs;
+            }
+        }
+    }
+
+    uint32_t now = micros();
+    uint32_t waitUs = SCHED_NEVER;
+    portENTER_CRITICAL(&s.mux);
+    for (uint8_t i = 0; i < s.count; i++) {
+        const SchedJob& j = s.jobs[i];
+        if (!j.armed) continue;
+        int32_t left = (int32_t)(j.dueUs - now);
+        if (left <= 0) { waitUs = 0; break; }
+        if ((uint32_t)left < waitUs) waitUs = (uint32_t)left;
+    }
+    portEXIT_CRITICAL(&s.mux);
+
+    if (waitUs == SCHED_NEVER) return SCHED_NEVER;
+    return (waitUs + 999UL) / 1000UL; // Округление вверх: не просыпаться раньше срока
+}
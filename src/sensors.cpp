@@ -7,6 +7,9 @@
 // =================================================================================
 
 #include "sensors.h"
+#include "settings.h"
+#include "tasks.h"
+#include "scheduler.h"
 
 // --- Локальные объекты и переменные для этого модуля ---
 static OneWire oneWire(OW_PIN);
@@ -20,19 +23,350 @@ struct SensorState {
 };
 static SensorState sensorStates[OW_VAR_COUNT];
 
+// Индекс привязок: 64-битный ROM -> слот sensorStates, отсортирован по rom
+// для двоичного поиска. Перестраивается только при изменении привязок.
+struct RomIndexEntry {
+    uint64_t rom;
+    uint8_t slot;
+};
+static RomIndexEntry romIndex[OW_VAR_COUNT];
+static uint8_t romIndexCount = 0;
+
+static uint64_t romToU64(const uint8_t addr[8]) {
+    uint64_t v = 0;
+    for (uint8_t i = 0; i < 8; i++) v = (v << 8) | addr[i];
+    return v;
+}
+
+static void romFromU64(uint64_t rom, uint8_t addr[8]) {
+    for (int8_t b = 7; b >= 0; b--) { addr[b] = (uint8_t)(rom & 0xFF); rom >>= 8; }
+}
+
+static void rebuildRomIndex() {
+    romIndexCount = 0;
+    for (uint8_t slot = 0; slot < OW_VAR_COUNT; slot++) {
+        uint8_t addr[8];
+        if (!appSettings.owRom[slot].length() || !owStringToAddr(appSettings.owRom[slot], addr)) continue;
+        RomIndexEntry e = { romToU64(addr), slot };
+        uint8_t i = romIndexCount++;
+        while (i > 0 && romIndex[i - 1].rom > e.rom) { romIndex[i] = romIndex[i - 1]; i--; }
+        romIndex[i] = e;
+    }
+}
+
+// Слот sensorStates для ROM или -1, если датчик не привязан
+static int findSlotByRom(uint64_t rom) {
+    int lo = 0, hi = (int)romIndexCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) >> 1;
+        if (romIndex[mid].rom == rom) return romIndex[mid].slot;
+        if (romIndex[mid].rom < rom) lo = mid + 1; else hi = mid - 1;
+    }
+    return -1;
+}
+
 
 // --- Реализация функций ---
 
+static void onBindingsChanged();
+
 void initializeSensors() {
     ds18.begin();
     ds18.setWaitForConversion(false); // Неблокирующий режим
+    onBindingsChanged();
+#if !OW_ADDRESSED_POLLING
     ds18.requestTemperatures(); // Первый запрос
+#endif
+}
+
+static void storeReading(int slot, bool ok, float tempC) {
+    if (ok && tempC != DEVICE_DISCONNECTED_C && tempC > -55.0f) {
+        sensorStates[slot].temperature = tempC;
+        sensorStates[slot].is_alarm = false;
+    } else {
+        sensorStates[slot].temperature = DEVICE_DISCONNECTED_C;
+        sensorStates[slot].is_alarm = true;
+    }
+    sensorStates[slot].lastUpdateTime = millis();
+}
+
+// Устройства последнего полного обхода шины: обработчики /api/ow/* берут
+// список отсюда и сами по шине не обмениваются
+struct OwDevice {
+    uint64_t rom;
+    float tempC; // Для непривязанного датчика; DEVICE_DISCONNECTED_C - нет свежего измерения
+};
+static const uint8_t OW_DEVICE_MAX = OW_VAR_COUNT + 1;
+static OwDevice owDevices[OW_DEVICE_MAX];
+static uint8_t owDeviceCount = 0;
+static OwDevice sweepDevices[OW_DEVICE_MAX]; // Набираются текущим обходом
+static uint8_t sweepDeviceCount = 0;
+
+// Индекс в sweepDevices или -1, если список заполнен
+static int sweepAddDevice(const uint8_t addr[8], float tempC) {
+    if (sweepDeviceCount >= OW_DEVICE_MAX) return -1;
+    sweepDevices[sweepDeviceCount].rom = romToU64(addr);
+    sweepDevices[sweepDeviceCount].tempC = tempC;
+    return sweepDeviceCount++;
+}
+
+static void publishSweepDevices() {
+    memcpy(owDevices, sweepDevices, sweepDeviceCount * sizeof(OwDevice));
+    owDeviceCount = sweepDeviceCount;
+    sweepDeviceCount = 0;
+}
+
+#if OW_ADDRESSED_POLLING
+
+// --- Опрос по адресам и фоновый поиск ---
+
+static OwDiscoveryReport discoveryReport;
+static bool sweepActive = false;
+static unsigned long lastSweepStart = 0;
+static unsigned long lastSweepStep = 0;
+static uint16_t sweepSeenMask = 0;
+static uint8_t sweepFound = 0;
+static uint8_t sweepUnbound = 0;
+const unsigned long OW_DISCOVERY_INTERVAL = 60000;  // Полный поиск раз в минуту
+const unsigned long OW_DISCOVERY_STEP_INTERVAL = 2000;
+const uint8_t OW_DISCOVERY_STEPS = 2;               // Устройств за один шаг
+// Обход, запрошенный из веба (owRequestScan), идёт шагами без паузы;
+// завершённый недавно обход повторный запрос не перезапускает
+static bool fastSweep = false;
+const unsigned long OW_SCAN_STEP_INTERVAL = 50;
+const unsigned long OW_SCAN_FRESH_MS = 5000;
+
+static unsigned long sweepStepInterval() {
+    return fastSweep ? OW_SCAN_STEP_INTERVAL : OW_DISCOVERY_STEP_INTERVAL;
+}
+
+// Непривязанный датчик конвейер не опрашивает: при обнаружении ему запускается
+// своё преобразование (Match ROM), результат читается на следующих шагах, и
+// обход завершается, только когда прочитаны все. Без этого в списке было бы
+// 85 °C после включения или давнее значение.
+struct SweepConversion {
+    uint8_t device;              // Индекс в sweepDevices
+    unsigned long readyTime;
+};
+static SweepConversion sweepConversions[OW_DEVICE_MAX];
+static uint8_t sweepConversionCount = 0;
+static bool sweepSearchDone = false;
+
+// Конвейер измерений: у каждого привязанного датчика свой цикл
+// "запуск преобразования -> чтение через время преобразования"
+struct OwPipelineSlot {
+    bool converting = false;
+    bool resolutionOk = false;       // Разрешение в датчике совпадает с OW_VAR_TIMING
+    unsigned long startTime = 0;     // Запуск текущего/последнего преобразования
+    unsigned long readyTime = 0;     // Когда можно читать результат
+    unsigned long nextStartTime = 0;
+};
+static OwPipelineSlot pipeline[OW_VAR_COUNT];
+
+// Все привязанные датчики - в начало цикла (после старта и смены привязок).
+// Старты разнесены по времени, чтобы чтения не собирались в один проход loop().
+const unsigned long OW_SLOT_STAGGER = 37;
+
+static void resetPipeline() {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+        pipeline[i] = OwPipelineSlot();
+        pipeline[i].nextStartTime = now + i * OW_SLOT_STAGGER;
+    }
+}
+
+// Match ROM + Read Scratchpad с проверкой CRC, без поиска по шине
+static bool readSensorByRom(const uint8_t addr[8], float& tempC, uint8_t& resolution) {
+    uint8_t sp[9];
+    if (!ds18.readScratchPad(addr, sp)) return false; // Нет presence-импульса
+    bool allZero = true;
+    for (uint8_t i = 0; i < 9; i++) if (sp[i]) { allZero = false; break; }
+    if (allZero || OneWire::crc8(sp, 8) != sp[8]) return false;
+
+    int16_t raw = (int16_t)((sp[1] << 8) | sp[0]);
+    resolution = 9 + ((sp[4] >> 5) & 0x03);
+    raw &= ~((1 << (12 - resolution)) - 1); // Младшие биты не определены при <12 бит
+    tempC = raw / 16.0f;
+    return true;
+}
+
+// Match ROM + Convert T только для одного датчика
+static bool startConversion(const uint8_t addr[8]) {
+    if (!oneWire.reset()) return false;
+    oneWire.select(addr);
+    oneWire.write(0x44, 0);
+    return true;
+}
+
+static void startSweepConversion(const uint8_t addr[8], int device) {
+    if (device < 0 || !startConversion(addr)) return;
+    // Разрешение датчика неизвестно - ждём как для 12 бит
+    SweepConversion& c = sweepConversions[sweepConversionCount++];
+    c.device = (uint8_t)device;
+    c.readyTime = millis() + ds18.millisToWaitForConversion(12);
+}
+
+static void readSweepConversions() {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < sweepConversionCount; ) {
+        SweepConversion& c = sweepConversions[i];
+        if ((long)(now - c.readyTime) < 0) { i++; continue; }
+        OwDevice& dev = sweepDevices[c.device];
+        uint8_t addr[8];
+        romFromU64(dev.rom, addr);
+        float tempC;
+        uint8_t resolution;
+        if (readSensorByRom(addr, tempC, resolution) && tempC > -55.0f) dev.tempC = tempC;
+        c = sweepConversions[--sweepConversionCount];
+    }
+}
+
+static void finishSweep() {
+    uint16_t boundMask = 0;
+    for (uint8_t i = 0; i < romIndexCount; i++) boundMask |= (uint16_t)(1 << romIndex[i].slot);
+    uint16_t missing = boundMask & ~sweepSeenMask;
+
+    if (missing != discoveryReport.missingMask || sweepUnbound != discoveryReport.unboundFound) {
+        Serial.printf("1-Wire: найдено %u, без привязки %u", sweepFound, sweepUnbound);
+        for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+            if (missing & (1 << i)) Serial.printf(", нет %s", OW_VARS[i]);
+        }
+        Serial.println();
+    }
+
+    discoveryReport.lastSweepTime = millis();
+    discoveryReport.devicesFound = sweepFound;
+    discoveryReport.unboundFound = sweepUnbound;
+    discoveryReport.missingMask = missing;
+    discoveryReport.sweeps++;
+    publishSweepDevices();
+    sweepActive = false;
+    fastSweep = false;
+}
+
+// Несколько шагов поиска за вызов, чтобы не занимать шину надолго
+static void discoveryStep() {
+    if (millis() - lastSweepStep < sweepStepInterval()) return;
+    lastSweepStep = millis();
+
+    if (!sweepActive) {
+        if (discoveryReport.sweeps && !fastSweep && millis() - lastSweepStart < OW_DISCOVERY_INTERVAL) return;
+        sweepActive = true;
+        lastSweepStart = millis();
+        sweepSeenMask = 0;
+        sweepFound = 0;
+        sweepUnbound = 0;
+        sweepDeviceCount = 0;
+        sweepConversionCount = 0;
+        sweepSearchDone = false;
+        oneWire.reset_search();
+    }
+
+    readSweepConversions();
+    uint8_t addr[8];
+    for (uint8_t step = 0; step < OW_DISCOVERY_STEPS && !sweepSearchDone; step++) {
+        if (!oneWire.search(addr)) { sweepSearchDone = true; break; }
+        if (OneWire::crc8(addr, 7) != addr[7]) continue;
+        int device = sweepAddDevice(addr, DEVICE_DISCONNECTED_C);
+        if (addr[0] != 0x28) continue;
+        sweepFound++;
+        int slot = findSlotByRom(romToU64(addr));
+        if (slot >= 0) {
+            sweepSeenMask |= (uint16_t)(1 << slot);
+        } else {
+            sweepUnbound++;
+            startSweepConversion(addr, device);
+        }
+    }
+    if (sweepSearchDone && !sweepConversionCount) finishSweep();
 }
 
-void updateAllSensorReadings() {
+// Шина занята только когда какому-то датчику пора запускать преобразование
+// или отдавать результат; возвращает мс до ближайшего такого события
+uint32_t updateAllSensorReadings() {
+    MutexLock lock(owMutex);
+    unsigned long now = millis();
+
+    for (uint8_t i = 0; i < romIndexCount; i++) {
+        uint8_t slot = romIndex[i].slot;
+        OwPipelineSlot& p = pipeline[slot];
+        const OwVarTiming& timing = OW_VAR_TIMING[slot];
+
+        if (p.converting) {
+            if ((long)(now - p.readyTime) < 0) continue;
+            p.converting = false;
+
+            uint8_t addr[8];
+            romFromU64(romIndex[i].rom, addr);
+            float tempC = DEVICE_DISCONNECTED_C;
+            uint8_t resolution = 0;
+            bool ok = readSensorByRom(addr, tempC, resolution);
+            storeReading(slot, ok, tempC);
+            if (ok && resolution != timing.resolution) p.resolutionOk = false;
+            continue;
+        }
+
+        if ((long)(now - p.nextStartTime) < 0) continue;
+
+        uint8_t addr[8];
+        romFromU64(romIndex[i].rom, addr);
+        if (!p.resolutionOk) {
+            // Запись конфигурации в EEPROM датчика - только при расхождении
+            p.resolutionOk = ds18.setResolution(addr, timing.resolution, true);
+        }
+
+        // Следующий запуск - по сетке периода; после долгой паузы сетка сдвигается
+        p.nextStartTime += timing.periodMs;
+        if ((long)(now - p.nextStartTime) >= 0) p.nextStartTime = now + timing.periodMs;
+
+        if (startConversion(addr)) {
+            p.converting = true;
+            p.startTime = now;
+            p.readyTime = now + ds18.millisToWaitForConversion(timing.resolution);
+        } else {
+            storeReading(slot, false, DEVICE_DISCONNECTED_C);
+        }
+    }
+
+    discoveryStep();
+
+    // Ближайший срок: готовность/запуск любого слота или шаг фонового обхода
+    now = millis();
+    long next = (long)(lastSweepStep + sweepStepInterval() - now);
+    for (uint8_t i = 0; i < romIndexCount; i++) {
+        const OwPipelineSlot& p = pipeline[romIndex[i].slot];
+        long left = (long)((p.converting ? p.readyTime : p.nextStartTime) - now);
+        if (left < next) next = left;
+    }
+    return next > 0 ? (uint32_t)next : 0;
+}
+
+const OwDiscoveryReport& owGetDiscoveryReport() {
+    return discoveryReport;
+}
+
+bool owRequestScan() {
+    {
+        MutexLock lock(owMutex);
+        if (!sweepActive && discoveryReport.sweeps && millis() - discoveryReport.lastSweepTime < OW_SCAN_FRESH_MS) return false;
+        if (!fastSweep) {
+            fastSweep = true;
+            lastSweepStep = millis() - OW_SCAN_STEP_INTERVAL; // Первый шаг - в ближайший проход
+        }
+    }
+    tasksWakeSensors();
+    return true;
+}
+
+#else
+
+// --- Старый режим: полный поиск по шине на каждом цикле ---
+
+uint32_t updateAllSensorReadings() {
     static unsigned long lastRequestTime = 0;
     const unsigned long REQUEST_INTERVAL = 2000;
 
+    MutexLock lock(owMutex);
     if (millis() - lastRequestTime > REQUEST_INTERVAL) {
         lastRequestTime = millis();
 
@@ -45,33 +379,90 @@ void updateAllSensorReadings() {
         }
 
         // Ищем все устройства на шине
+        sweepDeviceCount = 0;
         while (oneWire.search(addr)) {
             if (OneWire::crc8(addr, 7) != addr[7]) continue;
-            if (addr[0] != 0x28) continue; // Только DS18B20
-
-            String romStr = owAddrToString(addr);
-            String varName = nvsFindVarByRom(romStr);
-
-            if (varName.length() > 0) {
-                float tempC = ds18.getTempC(addr);
-                
-                for (size_t i = 0; i < OW_VAR_COUNT; ++i) {
-                    if (varName.equals(OW_VARS[i])) {
-                        if (tempC != DEVICE_DISCONNECTED_C && tempC > -55.0f) {
-                            sensorStates[i].temperature = tempC;
-                            sensorStates[i].is_alarm = false;
-                        } else {
-                            sensorStates[i].temperature = DEVICE_DISCONNECTED_C;
-                            sensorStates[i].is_alarm = true;
-                        }
-                        sensorStates[i].lastUpdateTime = millis();
-                        break;
-                    }
-                }
+            if (addr[0] != 0x28) { // Только DS18B20
+                sweepAddDevice(addr, DEVICE_DISCONNECTED_C);
+                continue;
             }
+
+            // Преобразование запущено всем датчикам сразу - свежее и у непривязанных
+            float tempC = ds18.getTempC(addr);
+            int i = findSlotByRom(romToU64(addr));
+            if (i >= 0) storeReading(i, true, tempC);
+            sweepAddDevice(addr, tempC);
         }
+        publishSweepDevices();
         ds18.requestTemperatures(); // Запрашиваем следующее измерение
     }
+    long left = (long)(lastRequestTime + REQUEST_INTERVAL + 1 - millis());
+    return left > 0 ? (uint32_t)left : 0;
+}
+
+const OwDiscoveryReport& owGetDiscoveryReport() {
+    static OwDiscoveryReport empty;
+    return empty;
+}
+
+// Список обновляется каждым циклом опроса - отдельный обход не нужен
+bool owRequestScan() {
+    return false;
+}
+
+#endif // OW_ADDRESSED_POLLING
+
+// Пересборка индекса после изменения привязок; непривязанные переменные - в аварию
+static void onBindingsChanged() {
+    rebuildRomIndex();
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+        if (appSettings.owRom[i].length()) continue;
+        sensorStates[i].temperature = DEVICE_DISCONNECTED_C;
+        sensorStates[i].is_alarm = true;
+    }
+#if OW_ADDRESSED_POLLING
+    resetPipeline();
+#endif
+}
+
+// Список устройств на шине для веб-интерфейса (/api/ow/scan, /api/ow/status).
+// Привязанные датчики - с показанием конвейера (null в аварии), остальные -
+// с измерением, запущенным для них в последнем обходе (null, если его нет).
+uint16_t owScanToJson(JsonWriter& sensors, bool withBinding, uint16_t maxCount) {
+    // Копия под мьютексом: без USE_ASYNC_HTTP ответ уходит блокирующей отправкой
+    struct Row {
+        uint64_t rom;
+        int8_t slot;
+        float tempC;
+    };
+    Row rows[OW_DEVICE_MAX];
+    uint8_t count = 0;
+    {
+        MutexLock lock(owMutex);
+        for (uint8_t i = 0; i < owDeviceCount && count < maxCount; i++) {
+            Row& r = rows[count++];
+            r.rom = owDevices[i].rom;
+            r.slot = (int8_t)findSlotByRom(r.rom);
+            if (r.slot < 0) r.tempC = owDevices[i].tempC;
+            else r.tempC = sensorStates[r.slot].is_alarm ? DEVICE_DISCONNECTED_C : sensorStates[r.slot].temperature;
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        const Row& r = rows[i];
+        uint8_t addr[8];
+        romFromU64(r.rom, addr);
+        sensors.beginObject();
+        sensors.field("rom", owAddrToString(addr));
+        if (withBinding) sensors.field("var", (r.slot >= 0) ? OW_VARS[r.slot] : "");
+        if (r.tempC == DEVICE_DISCONNECTED_C) {
+            sensors.fieldNull("t");
+        } else {
+            sensors.field("t", r.tempC);
+        }
+        sensors.endObject();
+    }
+    return count;
 }
 
 // Глобальная функция для получения температуры по имени переменной
@@ -88,35 +479,6 @@ float getTempByVar(const char* varName, bool& isAlarm) {
 }
 
 
-void readDigitalInputs() {
-    if (!isInputExpanderAvailable) return;
-
-    Wire.requestFrom(PCF8574_INPUTS_ADDR, (uint8_t)1);
-    if (Wire.available()) {
-        byte inputs = Wire.read();
-        
-        auto filter = [](int& stable, int& last, int& count, bool current) {
-            if (current == last) {
-                if (count < 5) count++;
-            } else {
-                count = 0;
-            }
-            if (count >= 5) stable = current;
-            last = current;
-        };
-
-        filter(contour1_mode_stable, contour1_mode_last, contour1_mode_count, bitRead(inputs, 0));
-        filter(dry_run_state_stable, dry_run_state_last, dry_run_state_count, bitRead(inputs, 1));
-        filter(pump1_state_stable, pump1_state_last, pump1_state_count, bitRead(inputs, 2));
-        filter(pump2_state_stable, pump2_state_last, pump2_state_count, bitRead(inputs, 3));
-        filter(contour2_mode_stable, contour2_mode_last, contour2_mode_count, bitRead(inputs, 4));
-        filter(dry_run_state_2_stable, dry_run_state_2_last, dry_run_state_2_count, bitRead(inputs, 5));
-        filter(pump3_state_stable, pump3_state_last, pump3_state_count, bitRead(inputs, 6));
-        filter(pump4_state_stable, pump4_state_last, pump4_state_count, bitRead(inputs, 7));
-    }
-}
-
-
 // --- Вспомогательные функции для работы с NVS и адресами 1-Wire ---
 
 String owAddrToString(const uint8_t addr[8]) {
@@ -130,25 +492,32 @@ bool owStringToAddr(const String& romStr, uint8_t addr[8]) {
                   &addr[0], &addr[1], &addr[2], &addr[3], &addr[4], &addr[5], &addr[6], &addr[7]) == 8;
 }
 
+// Привязки читаются из appSettings.owRom (копия пространства "owmap")
 String nvsFindVarByRom(const String& rom) {
-  prefs.begin("owmap", true);
   for (size_t i=0; i < OW_VAR_COUNT; i++) {
-    String cur = prefs.getString(OW_VARS[i], String());
+    const String& cur = appSettings.owRom[i];
     if (cur.length() && cur == rom) {
-      prefs.end();
       return String(OW_VARS[i]);
     }
   }
-  prefs.end();
   return String();
 }
 
+static int owVarIndex(const String& v) {
+  for (size_t i=0; i < OW_VAR_COUNT; i++) {
+    if (v == OW_VARS[i]) return (int)i;
+  }
+  return -1;
+}
+
 bool nvsClearVar(const String& varName) {
-  if (!owIsKnownVar(varName)) return false;
-  prefs.begin("owmap", false);
-  bool res = prefs.remove(varName.c_str());
-  prefs.end();
-  return res;
+  int idx = owVarIndex(varName);
+  if (idx < 0) return false;
+  MutexLock lock(owMutex);
+  bool wasBound = appSettings.owRom[idx].length() > 0;
+  settingsSetOwRom((uint8_t)idx, String());
+  onBindingsChanged();
+  return wasBound;
 }
 
 bool nvsBindVarToRom(const String& varName, const String& rom, String* clearedVarOut, String* replacedRomOut, String* errMsg) {
@@ -157,14 +526,17 @@ bool nvsBindVarToRom(const String& varName, const String& rom, String* clearedVa
   if (!owStringToAddr(rom, addr)) { if (errMsg) *errMsg="bad rom format"; return false; }
   if (addr[0] != 0x28) { if (errMsg) *errMsg="not DS18B20 family"; return false; }
 
-  prefs.begin("owmap", false);
-  String occupiedBy = nvsFindVarByRom(rom);
-  if (occupiedBy.length() && occupiedBy != varName) {
-    prefs.remove(occupiedBy.c_str());
-    if (clearedVarOut) *clearedVarOut = occupiedBy;
+  int idx = owVarIndex(varName);
+  MutexLock lock(owMutex);
+  int occupiedBy = findSlotByRom(romToU64(addr));
+  if (occupiedBy >= 0 && occupiedBy != idx) {
+    settingsSetOwRom((uint8_t)occupiedBy, String());
+    if (clearedVarOut) *clearedVarOut = OW_VARS[occupiedBy];
   }
-  prefs.putString(varName.c_str(), rom);
-  prefs.end();
+  String romNorm = owAddrToString(addr);
+  if (replacedRomOut && appSettings.owRom[idx].length() && appSettings.owRom[idx] != romNorm) *replacedRomOut = appSettings.owRom[idx];
+  settingsSetOwRom((uint8_t)idx, romNorm);
+  onBindingsChanged();
   return true;
 }
 
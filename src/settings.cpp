@@ -0,0 +1,214 @@
+// =================================================================================
+// File:         src/settings.cpp
+// Description:  Реализация кэша настроек NVS в оперативной памяти.
+// =================================================================================
+
+#include "settings.h"
+#include "utils.h"
+#include "heating_curve.h"
+#include "comfort.h"
+#include "tasks.h"
+#include <ArduinoJson.h>
+
+static const char* DEFAULT_COMFORT_JSON = "{\"enabled\":false,\"intervals\":[{\"start\":\"00:00\",\"end\":\"05:00\",\"reduct\":-2},{\"start\":\"10:00\",\"end\":\"16:00\",\"reduct\":-2},{\"start\":\"23:00\",\"end\":\"23:59\",\"reduct\":-2}],\"days\":[0,1,2,3,4,5,6]}";
+
+// JSON из NVS - в каноническом виде (как его выдаёт serializeJson); битая,
+// обрезанная или не того вида (массив/объект) строка заменяется fallback.
+// /api/settings/load вставляет эти строки в ответ без разбора.
+static String canonicalJson(const String& json, bool array, const char* fallback) {
+    StaticJsonDocument<1024> doc;
+    if (deserializeJson(doc, json) || !(array ? doc.is<JsonArray>() : doc.is<JsonObject>())) return fallback;
+    String out;
+    serializeJson(doc, out);
+    return out;
+}
+
+// --- Загрузка ---
+
+void settingsLoad() {
+    AppSettings& s = appSettings;
+
+    prefsProfiles.begin("profiles", true);
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        String id = prefsProfiles.getString(CONTOURS[c].profileKey, "CUSTOM_6");
+        int idx = tileIndexById(id);
+        s.profileIdx[c] = (idx >= 0) ? (uint8_t)idx : (uint8_t)TILE_CUSTOM_6;
+    }
+    prefsProfiles.end();
+
+    prefsParams.begin("params", true);
+    for (uint8_t i = 0; i < 6; i++) {
+        const TileDef& td = TILES[i];
+        s.tzad[i] = (td.TZAD && td.TZAD[0]) ? prefsParams.getFloat(td.TZAD, td.defaultValue) : td.defaultValue;
+    }
+    prefsParams.end();
+
+    prefsGeneral.begin("general", true);
+    globalPumpEnableMask = prefsGeneral.getUChar("pumpEnableMask", PUMP_ENABLE_ALL) & PUMP_ENABLE_ALL;
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        const ContourDef& cd = CONTOURS[c];
+        PiParams def;
+        s.pi[c].Kp = prefsGeneral.getFloat(cd.piKeys[0], def.Kp);
+        s.pi[c].Ki = prefsGeneral.getFloat(cd.piKeys[1], def.Ki);
+        s.pi[c].Ti = prefsGeneral.getFloat(cd.piKeys[2], def.Ti);
+        s.comfort[c] = canonicalJson(prefsGeneral.getString(cd.comfortKey, DEFAULT_COMFORT_JSON), false, DEFAULT_COMFORT_JSON);
+    }
+    s.summerCutoff = prefsGeneral.getFloat("summerCutoff", 20.0f);
+    s.gvpPidDz = prefsGeneral.getFloat("gvpPidDz", 2.0f);
+    s.gvpPidKf = prefsGeneral.getFloat("gvpPidKf", 0.5f);
+    s.gvpPidMax = prefsGeneral.getFloat("gvpPidMax", 5.0f);
+    s.timeWasSet = prefsGeneral.getBool("timeWasSet", false);
+    s.ctrlIndex = prefsGeneral.getString("ctrlIndex", "");
+    s.curvePoints = canonicalJson(prefsGeneral.getString("curvePoints", "[]"), true, "[]");
+    prefsGeneral.end();
+    curveCompile(s.curvePoints, s.curve);
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) comfortCompile(s.comfort[c], s.comfortSched[c]);
+
+    prefs.begin("owmap", true);
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+        s.owRom[i] = prefs.getString(OW_VARS[i], String());
+    }
+    prefs.end();
+}
+
+// --- Запись ---
+
+bool settingsSetProfile(uint8_t cont, uint8_t tileIdx) {
+    if (!isContour(cont) || tileIdx >= 6) return false;
+    const char* key = CONTOURS[cont - 1].profileKey;
+    const char* id = TILES[tileIdx].id;
+    prefsProfiles.begin("profiles", false);
+    size_t n = prefsProfiles.putString(key, id);
+    if (n == 0) {
+        // putString возвращает 0 и тогда, когда значение не изменилось
+        String cur = prefsProfiles.getString(key, String());
+        prefsProfiles.end();
+        if (cur != id) return false;
+    } else {
+        prefsProfiles.end();
+    }
+    MutexLock lock(settingsMutex);
+    appSettings.profileIdx[cont - 1] = tileIdx;
+    return true;
+}
+
+bool settingsSetTzad(const char* tzadKey, float value) {
+    if (!tzadKey || !tzadKey[0]) return false;
+    bool known = false;
+    for (uint8_t i = 0; i < 6; i++) {
+        if (strcmp(TILES[i].TZAD, tzadKey) == 0) known = true;
+    }
+    if (!known) return false;
+
+    prefsParams.begin("params", false);
+    prefsParams.putFloat(tzadKey, value);
+    prefsParams.end();
+    MutexLock lock(settingsMutex);
+    for (uint8_t i = 0; i < 6; i++) {
+        if (strcmp(TILES[i].TZAD, tzadKey) == 0) appSettings.tzad[i] = value;
+    }
+    return true;
+}
+
+void settingsSetPi(uint8_t cont, const PiParams& pi) {
+    if (!isContour(cont)) return;
+    const ContourDef& cd = CONTOURS[cont - 1];
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putFloat(cd.piKeys[0], pi.Kp);
+    prefsGeneral.putFloat(cd.piKeys[1], pi.Ki);
+    prefsGeneral.putFloat(cd.piKeys[2], pi.Ti);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    appSettings.pi[cont - 1] = pi;
+}
+
+void settingsSetPumpEnableMask(uint8_t mask) {
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putUChar("pumpEnableMask", mask);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    globalPumpEnableMask = mask;
+}
+
+void settingsSetSummerCutoff(float value) {
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putFloat("summerCutoff", value);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    appSettings.summerCutoff = value;
+}
+
+void settingsSetGvpPid(float dz, float kf, float max) {
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putFloat("gvpPidDz", dz);
+    prefsGeneral.putFloat("gvpPidKf", kf);
+    prefsGeneral.putFloat("gvpPidMax", max);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    appSettings.gvpPidDz = dz;
+    appSettings.gvpPidKf = kf;
+    appSettings.gvpPidMax = max;
+}
+
+bool settingsSetCurvePoints(const String& raw) {
+    String json = canonicalJson(raw, true, "");
+    HeatingCurve curve;
+    if (!json.length() || !curveCompile(json, curve)) return false;
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putString("curvePoints", json);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    appSettings.curvePoints = json;
+    appSettings.curve = curve;
+    return true;
+}
+
+bool settingsSetComfort(uint8_t cont, const String& raw) {
+    if (!isContour(cont)) return false;
+    String json = canonicalJson(raw, false, "");
+    if (!json.length()) return false;
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putString(CONTOURS[cont - 1].comfortKey, json);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    appSettings.comfort[cont - 1] = json;
+    comfortCompile(json, appSettings.comfortSched[cont - 1]);
+    comfortInvalidate();
+    return true;
+}
+
+void settingsSetCtrlIndex(const String& value) {
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putString("ctrlIndex", value);
+    prefsGeneral.end();
+    MutexLock lock(settingsMutex);
+    appSettings.ctrlIndex = value;
+}
+
+void settingsSetTimeWasSet(bool value) {
+    {
+        MutexLock lock(settingsMutex);
+        if (appSettings.timeWasSet == value) return;
+        appSettings.timeWasSet = value;
+    }
+    prefsGeneral.begin("general", false);
+    prefsGeneral.putBool("timeWasSet", value);
+    prefsGeneral.end();
+    comfortInvalidate();
+}
+
+void settingsSetOwRom(uint8_t varIdx, const String& rom) {
+    if (varIdx >= OW_VAR_COUNT) return;
+    prefs.begin("owmap", false);
+    if (rom.length()) prefs.putString(OW_VARS[varIdx], rom);
+    else prefs.remove(OW_VARS[varIdx]);
+    prefs.end();
+    MutexLock lock(settingsMutex);
+    appSettings.owRom[varIdx] = rom;
+}
+
+// --- Чтение ---
+
+float settingsTzadForTile(uint8_t tileIdx) {
+    return (tileIdx < 6) ? appSettings.tzad[tileIdx] : 0.0f;
+}
@@ -0,0 +1,98 @@
+// =================================================================================
+// File:         src/stream_export.cpp
+// Description:  Реализация потоковой выгрузки: одна порция ждёт места в окне
+//               TCP, следующая наполняется после её отправки.
+// =================================================================================
+
+#include "stream_export.h"
+#include "scheduler.h"
+#include "tasks.h"
+#include <stdarg.h>
+
+static const uint32_t EXPORT_BUDGET_US = 10000;   // Работа выгрузки за один вызов
+static const uint32_t EXPORT_RETRY_MS = 20;       // Окно TCP занято - повтор
+static const uint32_t EXPORT_STALL_MS = 10000;    // Клиент не читает - выгрузка прерывается
+
+#if USE_ASYNC_HTTP
+typedef HttpStream ExportClient;
+#else
+typedef WiFiClient ExportClient;
+#endif
+
+static ExportClient client;
+static ExportFill fillFn = nullptr;
+static bool done = false;
+static char out[EXPORT_CHUNK_BYTES];
+static size_t outLen = 0;
+static unsigned long lastProgress = 0;
+
+bool exportAppend(char* buf, size_t cap, size_t& len, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + len, cap - len, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= cap - len) {
+        buf[len] = '\0';
+        return false;
+    }
+    len += n;
+    return true;
+}
+
+static void finish() {
+    if (client.connected()) client.stop();
+    client = ExportClient();
+    fillFn = nullptr;
+}
+
+bool exportAvailable() {
+    if (fillFn && client.connected()) {
+        server.send(503, "application/json", "{\"ok\":false,\"err\":\"export_busy\"}");
+        return false;
+    }
+    return true;
+}
+
+void exportBegin(const char* head, ExportFill fill) {
+    outLen = 0;
+    exportAppend(out, sizeof(out), outLen, "%sConnection: close\r\n\r\n", head);
+    client = server.client();
+    fillFn = fill;
+    done = false;
+    lastProgress = millis();
+    tasksWakeExport();
+}
+
+uint32_t exportPump() {
+    if (!fillFn) return SCHED_NEVER;
+    if (!client.connected()) {
+        finish();
+        return SCHED_NEVER;
+    }
+    uint32_t startUs = micros();
+    while ((uint32_t)(micros() - startUs) < EXPORT_BUDGET_US) {
+        if (outLen) {
+            // Запись целиком или ничего (HttpStream): порция ждёт места в окне
+            size_t n = client.write((const uint8_t*)out, outLen);
+            if (!n) {
+                if (millis() - lastProgress > EXPORT_STALL_MS) {
+                    finish();
+                    return SCHED_NEVER;
+                }
+                return EXPORT_RETRY_MS;
+            }
+            if (n != outLen) {
+                finish();
+                return SCHED_NEVER;
+            }
+            outLen = 0;
+            lastProgress = millis();
+        }
+        if (done) {
+            finish();
+            return SCHED_NEVER;
+        }
+        done = fillFn(out, sizeof(out), outLen);
+    }
+    return 0;
+}
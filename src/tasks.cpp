@@ -0,0 +1,321 @@
+// =================================================================================
+// File:         src/tasks.cpp
+// Description:  Таблица задач, их задания в планировщике и цикл задачи со
+//               сторожевым таймером и статистикой.
+// =================================================================================
+
+#include "tasks.h"
+#include "scheduler.h"
+#include "hardware.h"
+#include "sensors.h"
+#include "pid_control.h"
+#include "pump_control.h"
+#include "comfort.h"
+#include "inputs.h"
+#include "display.h"
+#include "live_status.h"
+#include "historian.h"
+#include "stream_export.h"
+#include "flash_log.h"
+#include "event_log.h"
+#include "profiler.h"
+
+// Задача просыпается не реже, чем раз в TASK_MAX_SLEEP_MS (сторожевой таймер)
+static const uint32_t TASK_MAX_SLEEP_MS = 1000;
+
+enum TaskIndex : uint8_t { TASK_CONTROL = 0, TASK_SENSORS, TASK_UI, TASK_WEB, TASK_COUNT };
+
+static Scheduler schedulers[TASK_COUNT];
+static int8_t relayJob = -1;
+static int8_t inputJob = -1;
+static int8_t pumpJob = -1;
+static int8_t owJob = -1;
+static int8_t comfortJob = -1;
+static int8_t httpJob = -1;
+static int8_t liveJob = -1;
+static int8_t exportJob = -1;
+
+static uint32_t capDelay(uint32_t ms, uint32_t cap) {
+    return ms < cap ? ms : cap;
+}
+
+// --- Задания ---
+
+// control: запись реле - однократное задание, зарегистрировано последним,
+// поэтому изменения всех заданий такта уходят на каждую плату одной записью.
+// Взводится из setRelay()/triggerRelayPulse() и само перевзводится
+// до конца последнего импульса (и для повтора неподтверждённой записи).
+static void relayJobFn() {
+    uint32_t next = checkRelayPulses();
+    if (!commitRelays()) next = capDelay(next, 200);
+    if (next != SCHED_NEVER) schedArm(schedulers[TASK_CONTROL], relayJob, next);
+}
+
+// Входы читаются по спаду общей линии INT плат входов; медленный опрос - на случай,
+// если линия INT не подключена или фронт потерян. Смена стабильного входа
+// сразу запускает логику насосов (сухой ход, потеря обратной связи).
+static const uint32_t INPUT_POLL_FALLBACK_MS = 5000;
+
+static void IRAM_ATTR inputIntIsr() {
+    schedArmFromIsr(schedulers[TASK_CONTROL], inputJob);
+}
+
+static void inputJobFn() {
+    uint32_t recheckMs;
+    if (inputsSample(recheckMs)) schedArm(schedulers[TASK_CONTROL], pumpJob, 0);
+    schedArm(schedulers[TASK_CONTROL], inputJob, capDelay(recheckMs, INPUT_POLL_FALLBACK_MS));
+}
+
+static void pidJobFn() {
+    for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) runPIDLogic(c);
+}
+
+// Такт насосов - и такт живого канала: изменения уходят подписчикам сразу
+static void pumpJobFn() {
+    for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) runPumpLogic(c);
+    histRecordPumps();
+    if (liveClientCount()) tasksWakeLive();
+}
+
+static void histJobFn() {
+    histRecordSample();
+}
+
+// sensors: конвейер 1-Wire сам сообщает срок следующего события.
+// Ограничение 500 мс - чтобы смена привязок из веба подхватывалась быстро.
+static void owJobFn() {
+    schedArm(schedulers[TASK_SENSORS], owJob, capDelay(updateAllSensorReadings(), 500));
+}
+
+static void comfortJobFn() {
+    schedArm(schedulers[TASK_SENSORS], comfortJob, capDelay(comfortTick(), 1000));
+}
+
+// ui
+static void buttonJobFn() {
+    handleButton();
+}
+
+static void displayJobFn() {
+    updateDisplay();
+}
+
+static void flogJobFn() {
+    flashLogTick();
+}
+
+static void evlogJobFn() {
+    eventLogDrain();
+}
+
+static void consoleJobFn() {
+    perfSerialPoll();
+}
+
+static void i2cJobFn() {
+    manageI2CDevices();
+    checkDisplayTimeout();
+}
+
+#if USE_ASYNC_HTTP
+// web: сервер будят события TCP (tasksWakeHttp), период - для таймаутов
+// соединений и точки доступа
+static void httpJobFn() {
+    handleWifiAndServer();
+    schedArm(schedulers[TASK_WEB], httpJob, 100);
+}
+#else
+// web: частый опрос сервера только пока включена точка доступа
+static void httpJobFn() {
+    handleWifiAndServer();
+    schedArm(schedulers[TASK_WEB], httpJob, apModeActive ? 5 : 100);
+}
+#endif
+
+// Дельта подписчикам /api/live; взводится тактом control, сама - только для пинга
+static void liveJobFn() {
+    uint32_t next = livePublish();
+    if (next != SCHED_NEVER) schedArm(schedulers[TASK_WEB], liveJob, next);
+}
+
+// Потоковая выгрузка (история, журнал) порциями по свободному окну TCP
+static void exportJobFn() {
+    uint32_t next = exportPump();
+    if (next != SCHED_NEVER) schedArm(schedulers[TASK_WEB], exportJob, next);
+}
+
+static void registerJobs() {
+    Scheduler& control = schedulers[TASK_CONTROL];
+    inputJob = schedAddOneShot(control, "inputs", inputJobFn);
+    schedAddPeriodic(control, "pid", pidJobFn, 1000);
+    pumpJob = schedAddPeriodic(control, "pumps", pumpJobFn, 1000);
+    schedAddPeriodic(control, "hist", histJobFn, HIST_SAMPLE_MS);
+    schedArm(control, inputJob, 0);
+    relayJob = schedAddOneShot(control, "relays", relayJobFn);
+
+    Scheduler& sensors = schedulers[TASK_SENSORS];
+    owJob = schedAddOneShot(sensors, "ow", owJobFn);
+    comfortJob = schedAddOneShot(sensors, "comfort", comfortJobFn);
+    schedArm(sensors, owJob, 0);
+    schedArm(sensors, comfortJob, 0);
+
+    Scheduler& ui = schedulers[TASK_UI];
+    schedAddPeriodic(ui, "button", buttonJobFn, 20);
+    schedAddPeriodic(ui, "display", displayJobFn, 500);
+    schedAddPeriodic(ui, "i2c", i2cJobFn, 1000);
+    schedAddPeriodic(ui, "flog", flogJobFn, FLOG_PERIOD_S * 1000UL);
+    schedAddPeriodic(ui, "evlog", evlogJobFn, 1000);
+    schedAddPeriodic(ui, "console", consoleJobFn, 100);
+
+    Scheduler& web = schedulers[TASK_WEB];
+    httpJob = schedAddOneShot(web, "http", httpJobFn);
+    liveJob = schedAddOneShot(web, "live", liveJobFn);
+    exportJob = schedAddOneShot(web, "export", exportJobFn);
+    schedArm(web, httpJob, 0);
+}
+
+void tasksWakeRelays() {
+    schedArm(schedulers[TASK_CONTROL], relayJob, 0);
+}
+
+void tasksWakeSensors() {
+    schedArm(schedulers[TASK_SENSORS], owJob, 0);
+}
+
+void tasksWakeHttp() {
+    schedArm(schedulers[TASK_WEB], httpJob, 0);
+}
+
+void tasksWakeLive() {
+    schedArm(schedulers[TASK_WEB], liveJob, 0);
+}
+
+void tasksWakeExport() {
+    schedArm(schedulers[TASK_WEB], exportJob, 0);
+}
+
+// --- Таблица задач ---
+
+struct TaskDef {
+    const char* name;
+    uint8_t priority;     // Больше - важнее (loopTask Arduino = 1)
+    uint8_t core;
+    uint16_t stackBytes;
+};
+
+// Порядок - по убыванию приоритета (так же их обходит tasksRunCooperative)
+static const TaskDef TASK_DEFS[TASK_COUNT] = {
+    { "control", 5, 1, 4096 },
+    { "sensors", 4, 1, 3072 },
+    { "ui",      2, 0, 4096 },
+    { "web",     1, 0, 6144 },
+};
+
+static TaskStats taskStats[TASK_COUNT];
+static int8_t passPerf[TASK_COUNT];
+
+// Группы этапов профилировщика: опоздание заданий и проход задачи, затем
+// задания (registerJobs)
+static void registerStages() {
+    for (uint8_t i = 0; i < TASK_COUNT; i++) {
+        const char* name = TASK_DEFS[i].name;
+        taskStats[i].name = name;
+        schedulers[i].name = name;
+        schedulers[i].latePerf = perfRegister(name, "late");
+        passPerf[i] = perfRegister(name, "pass");
+    }
+}
+
+// Один проход планировщика задачи; возвращает мс до ближайшего срока
+static uint32_t runPass(uint8_t i) {
+    TaskStats& st = taskStats[i];
+    Scheduler& s = schedulers[i];
+    uint32_t startUs = micros();
+    PerfMark mark = perfStart();
+
+    uint32_t waitMs = schedRunDue(s);
+
+    uint32_t execUs = micros() - startUs;
+    uint32_t runs = 0, late = 0;
+    for (uint8_t j = 0; j < s.count; j++) {
+        runs += s.jobs[j].runs;
+        if (s.jobs[j].maxLateUs > late) late = s.jobs[j].maxLateUs;
+    }
+    if (runs != st.runs) {
+        perfStop(passPerf[i], mark);
+        st.lastExecUs = execUs;
+        if (execUs > st.maxExecUs) st.maxExecUs = execUs;
+    }
+    st.runs = runs;
+    st.maxLatencyUs = late;
+    return waitMs;
+}
+
+uint8_t tasksCount() {
+    return TASK_COUNT;
+}
+
+const TaskStats& tasksStats(uint8_t i) {
+    return taskStats[i < TASK_COUNT ? i : 0];
+}
+
+#if USE_RTOS_TASKS
+
+static void taskEntry(void* arg) {
+    uint8_t i = (uint8_t)(uintptr_t)arg;
+    esp_task_wdt_add(NULL);
+    for (;;) {
+        uint32_t waitMs = capDelay(runPass(i), TASK_MAX_SLEEP_MS);
+        esp_task_wdt_reset();
+        // uxTaskGetStackHighWaterMark на ESP32 возвращает байты
+        taskStats[i].stackFreeMin = uxTaskGetStackHighWaterMark(NULL);
+        // Сон до ближайшего срока; schedArm из другой задачи будит раньше
+        if (waitMs) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    }
+}
+
+void startTasks() {
+    registerStages();
+    registerJobs();
+    for (uint8_t i = 0; i < TASK_COUNT; i++) {
+        const TaskDef& def = TASK_DEFS[i];
+        TaskHandle_t handle = nullptr;
+        if (xTaskCreatePinnedToCore(taskEntry, def.name, def.stackBytes, (void*)(uintptr_t)i,
+                                    def.priority, &handle, def.core) != pdPASS) {
+            // Без задачи (например, control) реле остались бы без управления - лучше перезагрузка
+            Serial.printf("Task %s: create failed\n", def.name);
+            Serial.flush();
+            abort();
+        }
+        schedulers[i].owner = handle;
+    }
+    pinMode(IO_INT_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(IO_INT_PIN), inputIntIsr, FALLING);
+}
+
+void tasksRunCooperative() {
+}
+
+#else
+
+// --- Кооперативный режим (native): все планировщики из loop() ---
+
+static int8_t loopPerf = -1;
+
+void startTasks() {
+    registerStages();
+    loopPerf = perfRegister("loop", "loop");
+    registerJobs();
+    pinMode(IO_INT_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(IO_INT_PIN), inputIntIsr, FALLING);
+}
+
+// Полный проход loop(): гистограмма - джиттер цикла
+void tasksRunCooperative() {
+    PerfMark mark = perfStart();
+    for (uint8_t i = 0; i < TASK_COUNT; i++) runPass(i);
+    perfStop(loopPerf, mark);
+    esp_task_wdt_reset();
+}
+
+#endif // USE_RTOS_TASKS
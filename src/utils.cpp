@@ -0,0 +1,28 @@
+// =================================================================================
+// File:         src/utils.cpp
+// Description:  Общие часы и квантование температур для журналов. Часы
+//               зовут задачи control, ui и web - счётчик под спинлоком.
+// =================================================================================
+
+#include "utils.h"
+
+static uint32_t clockS = 0;
+static uint32_t clockMs = 0;
+static portMUX_TYPE clockMux = portMUX_INITIALIZER_UNLOCKED;
+
+uint32_t uptimeSeconds() {
+    portENTER_CRITICAL(&clockMux);
+    uint32_t elapsed = ((uint32_t)millis() - clockMs) / 1000;
+    clockS += elapsed;
+    clockMs += elapsed * 1000;
+    uint32_t s = clockS;
+    portEXIT_CRITICAL(&clockMux);
+    return s;
+}
+
+int16_t quantizeTemp(float v) {
+    if (isnan(v)) return TEMP_NONE;
+    float q = roundf(v * 16.0f);
+    if (q <= -32767.0f || q > 32767.0f) return TEMP_NONE;
+    return (int16_t)q;
+}
@@ -9,12 +9,26 @@
 #include "hardware.h" 
 #include "web_server.h"
 #include "utils.h"
+#include "pid_control.h"
+#include "pump_control.h"
+#include "settings.h"
+#include "comfort.h"
+#include "tasks.h"
+#include "inputs.h"
+#include "live_status.h"
+#include "json_writer.h"
+#include "historian.h"
+#include "flash_log.h"
+#include "event_log.h"
+#include "profiler.h"
+#include "i2c_bus.h"
+
+static const char* WEB_COLLECT_HEADERS[] = { "If-None-Match" };
 
 // --- Секция 12: HTML, CSS, JavaScript для веб-интерфейса ---
-// Здесь находится полный код вашей оригинальной веб-страницы.
-const char index_html[] PROGMEM = R"====(
-// ... HTML код ...
-)====";
+// Исходник страницы - web/index.html. При сборке scripts/build_web.py
+// минифицирует и сжимает его в WEB_UI_GZ (gzip) с ETag по содержимому.
+#include "web_ui_gz.h"
 
 // --- Прототипы всех обработчиков ---
 void handleRoot();
@@ -35,15 +49,455 @@ void handleTimeSet();
 
 // --- Реализация обработчиков ---
 
+// Страница отдаётся сжатой; браузер перепроверяет её при каждой загрузке
+// (no-cache) и при совпадении ETag получает пустой 304 вместо ~14 КБ.
 void handleRoot() {
-  server.send_P(200, "text/html", index_html);
+  server.sendHeader("ETag", WEB_UI_ETAG);
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == WEB_UI_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html; charset=utf-8", (PGM_P)WEB_UI_GZ, WEB_UI_GZ_LEN);
 }
 
 void handleNotFound(){
   server.send(404, "text/plain", "Not found");
 }
 
-// ... (остальные обработчики handleOwScan, handleOwStatus и т.д.)
+// --- Шина 1-Wire ---
+
+// Обход шины ведёт задача sensors; ответ - список предыдущего обхода
+// и признак pending, пока запрошенный обход не завершён
+void handleOwScan() {
+    bool pending = owRequestScan();
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.field("pin", OW_PIN);
+    w.beginArray("sensors");
+    uint16_t found = owScanToJson(w, true, OW_VAR_COUNT + 1);
+    w.endArray();
+    w.field("found", found);
+    w.field("pending", pending);
+    w.endObject();
+}
+
+void handleOwStatus() {
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.beginArray("sensors");
+    owScanToJson(w, false, OW_VAR_COUNT + 1);
+    w.endArray();
+
+    const OwDiscoveryReport& rep = owGetDiscoveryReport();
+    w.beginObject("discovery");
+    w.field("sweeps", rep.sweeps);
+    w.field("age_s", rep.sweeps ? (millis() - rep.lastSweepTime) / 1000 : 0UL);
+    w.field("found", rep.devicesFound);
+    w.field("unbound", rep.unboundFound);
+    w.beginArray("missing");
+    for (uint8_t i = 0; i < OW_VAR_COUNT; i++) {
+        if (rep.missingMask & (1 << i)) w.field(nullptr, OW_VARS[i]);
+    }
+    w.endArray();
+    w.endObject();
+    w.endObject();
+}
+
+void handleOwBind() {
+    StaticJsonDocument<128> doc;
+    deserializeJson(doc, server.arg("plain"));
+    String var = doc["var"];
+    String rom = doc["rom"];
+    if (var.length() == 0 || rom.length() == 0) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"missing var/rom\"}"); return; }
+    String cleared, replaced, err;
+    bool ok = nvsBindVarToRom(var, rom, &cleared, &replaced, &err);
+    if (!ok) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"" + err + "\"}"); return; }
+
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.field("var", var);
+    w.field("rom", rom);
+    if (cleared.length()) w.field("cleared", cleared);
+    w.endObject();
+}
+
+void handleVarsStatus() {
+    const size_t MAX_REQ = 16;
+    String req[MAX_REQ]; size_t cnt = 0;
+    String csvNames = server.arg("names");
+    if (csvNames.length()) {
+        int s = 0;
+        while (s >= 0 && cnt < MAX_REQ) {
+            int c = csvNames.indexOf(',', s);
+            String tok = (c < 0) ? csvNames.substring(s) : csvNames.substring(s, c);
+            tok.trim();
+            if (tok.length() > 0 && owIsKnownVar(tok)) req[cnt++] = tok;
+            if (c < 0) break;
+            s = c + 1;
+        }
+    } else {
+        for (size_t i = 0; i < OW_VAR_COUNT && cnt < MAX_REQ; i++) req[cnt++] = String(OW_VARS[i]);
+    }
+
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.beginArray("vars");
+    for (size_t i = 0; i < cnt; i++) {
+        w.beginObject();
+        w.field("name", req[i]);
+        bool is_alarm;
+        float tC = getTempByVar(req[i].c_str(), is_alarm);
+        if (is_alarm) w.fieldNull("t"); else w.field("t", tC);
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+}
+
+void handleSystemStatus() {
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.field("display", isDisplayAvailable ? "ONLINE" : "OFFLINE");
+    w.field("relay", isRelayExpanderAvailable ? "ONLINE" : "OFFLINE");
+    w.field("input", isInputExpanderAvailable ? "ONLINE" : "OFFLINE");
+
+    // Логические образы: бит i - реле i включено / вход i (InputId) в 1
+    w.beginObject("io");
+    w.field("relays", (unsigned long)relayStates);
+    w.field("inputs", (unsigned long)inputsImage());
+    w.endObject();
+
+    w.beginObject("rtc");
+    uint8_t hh, mm, dow;
+    if (isRtcAvailable && comfortClock(hh, mm, dow)) {
+        char buf[20];
+        const char* days[] = {"(Нд)", "(Пн)", "(Вт)", "(Ср)", "(Чт)", "(Пт)", "(Сб)"};
+        sprintf(buf, "%02d:%02d %s", hh, mm, days[dow]);
+        w.field("status", "ONLINE");
+        w.field("time", buf);
+    } else {
+        w.field("status", "OFFLINE");
+        w.field("time", "N/A");
+    }
+    w.endObject();
+
+    w.beginArray("tasks");
+    for (uint8_t i = 0; i < tasksCount(); i++) {
+        const TaskStats& st = tasksStats(i);
+        w.beginObject();
+        w.field("name", st.name);
+        w.field("runs", st.runs);
+        w.field("exec_us", st.lastExecUs);
+        w.field("exec_max_us", st.maxExecUs);
+        w.field("late_max_us", st.maxLatencyUs);
+        w.field("stack_free", st.stackFreeMin);
+        w.endObject();
+    }
+    w.endArray();
+
+    HistInfo hi = histInfo();
+    w.beginObject("history");
+    w.field("now", hi.now);
+    w.field("from", hi.from);
+    w.field("samples", hi.samples);
+    w.field("events", hi.events);
+    w.field("used", hi.usedBytes);
+    w.field("capacity", hi.capacityBytes);
+    w.endObject();
+
+    FlashLogInfo fi = flashLogInfo();
+    w.beginObject("flashlog");
+    w.field("available", fi.available);
+    w.field("boot", fi.bootId);
+    w.field("segments", fi.segments);
+    w.field("head", fi.headSeq);
+    w.field("records", fi.records);
+    w.field("pages", fi.pagesWritten);
+    w.field("erases", fi.erases);
+    w.field("errors", fi.errors);
+    w.field("crc_errors", fi.crcErrors);
+    w.endObject();
+
+    EventLogInfo ei = eventLogInfo();
+    w.beginObject("events");
+    w.field("logged", ei.logged);
+    w.field("dropped", ei.dropped);
+    w.field("stored", ei.stored);
+    w.field("suppressed", ei.suppressed);
+    w.endObject();
+
+    I2CBusInfo bi = i2cBusInfo();
+    w.beginObject("i2c");
+    w.field("clock_hz", bi.clockHz);
+    w.field("recoveries", bi.recoveries);
+    w.field("busy", bi.busy);
+    w.beginArray("devices");
+    for (uint8_t i = 0; i < i2cDeviceCount(); i++) {
+        I2CDeviceInfo di = i2cDeviceInfo(i);
+        w.beginObject();
+        w.field("name", di.name);
+        w.field("addr", (unsigned)di.addr);
+        w.field("online", di.online);
+        w.field("transactions", di.transactions);
+        w.field("errors", di.errors);
+        w.field("nacks", di.nacks);
+        w.field("timeouts", di.timeouts);
+        w.field("skipped", di.skipped);
+        w.field("error_rate_pm", (unsigned)di.errorRatePm);
+        w.field("backoff_ms", di.backoffMs);
+        w.field("max_us", di.maxUs);
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+
+#if USE_ASYNC_HTTP
+    const HttpServerStats& hs = server.stats();
+    w.beginObject("http");
+    w.field("conns", server.activeConnections());
+    w.field("accepted", hs.accepted);
+    w.field("rejected", hs.rejected);
+    w.field("requests", hs.requests);
+    w.field("timeouts", hs.timeouts);
+    w.field("spilled", hs.spilled);
+    w.field("pass_max_us", hs.maxPassUs);
+    w.endObject();
+#endif
+    w.endObject();
+}
+
+// --- Профили контуров ---
+
+void handleContourProfileGET() {
+    server.sendHeader("Cache-Control", "no-cache");
+    int cont = server.arg("cont").toInt();
+    if (!isContour(cont)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad cont\"}"); return; }
+    uint8_t idx = getProfileIndex((uint8_t)cont);
+    const TileDef& td = getTile(idx);
+    float pval = settingsTzadForTile(idx);
+
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    w.field("cont", cont);
+    w.field("id", td.id);
+    w.field("display", td.displayName);
+    w.field("TPOD", td.TPOD);
+    w.field("TINV", td.TINV);
+    w.field("TZAD", td.TZAD);
+    w.field("settingsLabel", td.settingsLabel);
+    w.field("defaultValue", td.defaultValue);
+    w.field("paramValue", pval);
+    w.endObject();
+}
+
+void handleContourProfilePOST() {
+    StaticJsonDocument<128> doc;
+    deserializeJson(doc, server.arg("plain"));
+    int cont = doc["cont"];
+    String id = doc["id"];
+    if (!isContour(cont)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad cont\"}"); return; }
+    if (!tileIdExists(id)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"bad id\"}"); return; }
+    if (!setProfileId((uint8_t)cont, id)) { server.send(500, "application/json", "{\"ok\":false,\"err\":\"save failed\"}"); return; }
+    server.send(200, "application/json", "{\"ok\":true}");
+}
+
+// --- Главный экран ---
+
+// Поля контура cont для /api/main/status (блок "c<cont>")
+static void writeContourStatus(JsonWriter& w, uint8_t cont) {
+    const ContourDef& def = CONTOURS[cont - 1];
+    const ContourPumpLogic& logic = pumpLogic[cont - 1];
+    unsigned long now = millis();
+    bool closing = pulseEndTimes[def.valveCloseRelay] > 0 && (long)(now - pulseEndTimes[def.valveCloseRelay]) < 0;
+    bool opening = pulseEndTimes[def.valveOpenRelay] > 0 && (long)(now - pulseEndTimes[def.valveOpenRelay]) < 0;
+    bool isComfort = false;
+    float comfortReduction = 0.0f;
+    float tzavd = calculateSetpoint(cont, isComfort, comfortReduction);
+
+    char key[8];
+    snprintf(key, sizeof(key), "c%u", (unsigned)cont);
+    w.beginObject(key);
+    w.field("mode", (int)inputGet(def.modeInput));
+    w.field("dry_run", (int)inputGet(def.dryRunInput));
+    w.field("p1_status", getPumpStatusString(logic.pumps[0].status));
+    w.field("p2_status", getPumpStatusString(logic.pumps[1].status));
+    w.field("logic_state", (int)logic.state);
+    w.field("active_pump", logic.activePumpIndex);
+    w.field("summer_mode", logic.summer_mode_active);
+    w.field("valve", closing ? -1 : (opening ? 1 : 0));
+    w.field("isComfort", isComfort);
+    w.field("comfortReduction", comfortReduction);
+    w.field("tzavd", tzavd); // NaN -> null
+    w.endObject();
+}
+
+void handleMainStatus() {
+    JsonResponse w;
+    w.beginObject();
+    w.field("ok", true);
+    for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) writeContourStatus(w, c);
+    w.endObject();
+}
+
+// --- Реле и параметры ---
+
+void handleRelayPulse() {
+    StaticJsonDocument<64> doc;
+    deserializeJson(doc, server.arg("plain"));
+    int relayNumber = doc["relay"] | 0;
+    if (relayNumber < 1 || relayNumber > RELAY_COUNT) { server.send(400, "application/json", "{\"ok\":false, \"err\":\"invalid_relay_number\"}"); return; }
+    triggerRelayPulse(relayNumber - 1, 2000);
+    server.send(200, "application/json", "{\"ok\":true}");
+}
+
+void handleParamSave() {
+    StaticJsonDocument<128> doc;
+    deserializeJson(doc, server.arg("plain"));
+    const char* tzad = doc["tzad"];
+    float value = doc["value"];
+    if (!tzad || isnan(value)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"invalid_payload\"}"); return; }
+    if (!settingsSetTzad(tzad, value)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"unknown_tzad\"}"); return; }
+    server.send(200, "application/json", "{\"ok\":true}");
+}
+
+// --- Общие настройки ---
+
+void handleSettingsLoad() {
+    // Копия под мьютексом: без USE_ASYNC_HTTP ответ уходит блокирующей отправкой,
+    // и медленный клиент держал бы settingsMutex (расчёт уставки в задаче control)
+    String ctrlIndex, curvePoints, comfort[CONTOUR_COUNT];
+    PiParams pi[CONTOUR_COUNT];
+    float summerCutoff, gvpPidDz, gvpPidKf, gvpPidMax;
+    uint8_t pumpEnableMask;
+    {
+        MutexLock lock(settingsMutex);
+        const AppSettings& s = appSettings;
+        ctrlIndex = s.ctrlIndex;
+        curvePoints = s.curvePoints;
+        for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+            comfort[c] = s.comfort[c];
+            pi[c] = s.pi[c];
+        }
+        summerCutoff = s.summerCutoff;
+        gvpPidDz = s.gvpPidDz;
+        gvpPidKf = s.gvpPidKf;
+        gvpPidMax = s.gvpPidMax;
+        pumpEnableMask = globalPumpEnableMask;
+    }
+
+    JsonResponse w;
+    w.beginObject();
+    w.field("ctrlIndex", ctrlIndex);
+    w.field("pumpEnableMask", pumpEnableMask);
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+        w.field(CONTOURS[c].piKeys[0], pi[c].Kp);
+        w.field(CONTOURS[c].piKeys[1], pi[c].Ki);
+        w.field(CONTOURS[c].piKeys[2], pi[c].Ti);
+    }
+    // Строки JSON канонизированы в settingsLoad и сеттерах - вставляются как есть
+    w.fieldRaw("curvePoints", curvePoints.c_str());
+    w.field("summerCutoff", summerCutoff);
+    w.field("gvpPidDz", gvpPidDz);
+    w.field("gvpPidKf", gvpPidKf);
+    w.field("gvpPidMax", gvpPidMax);
+    for (uint8_t c = 0; c < CONTOUR_COUNT; c++) w.fieldRaw(CONTOURS[c].comfortKey, comfort[c].c_str());
+    w.endObject();
+}
+
+// Контур блока "pi<N>" / "comfort<N>" (ключ comfortKey); 0 - не блок контура
+static uint8_t piBlockContour(const char* block) {
+    char name[8];
+    for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) {
+        snprintf(name, sizeof(name), "pi%u", (unsigned)c);
+        if (strcmp(block, name) == 0) return c;
+    }
+    return 0;
+}
+
+static uint8_t comfortBlockContour(const char* block) {
+    for (uint8_t c = 1; c <= CONTOUR_COUNT; c++) {
+        if (strcmp(block, CONTOURS[c - 1].comfortKey) == 0) return c;
+    }
+    return 0;
+}
+
+void handleSettingsSave() {
+    StaticJsonDocument<1024> doc;
+    deserializeJson(doc, server.arg("plain"));
+    const char* block = doc["block"];
+    if (!block) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"no_block\"}"); return; }
+
+    if (strcmp(block, "ctrl") == 0) {
+        settingsSetCtrlIndex(doc["value"].as<String>());
+    } else if (strcmp(block, "pumps") == 0) {
+        uint8_t oldMask = globalPumpEnableMask;
+        uint8_t newMask = (doc["mask"] | PUMP_ENABLE_ALL) & PUMP_ENABLE_ALL;
+        settingsSetPumpEnableMask(newMask);
+
+        // Снятый бит маски - насос выключается, автомат контура - в ожидание
+        for (uint8_t c = 0; c < CONTOUR_COUNT; c++) {
+            for (uint8_t p = 0; p < 2; p++) {
+                uint8_t bit = 1 << CONTOURS[c].pumpEnableBit[p];
+                if (!(oldMask & bit) || (newMask & bit)) continue;
+                setRelay(CONTOURS[c].pumpRelay[p], false);
+                pumpLogicRequestIdle(c + 1);
+            }
+        }
+    } else if (strcmp(block, "curve") == 0) {
+        String pointsJson;
+        serializeJson(doc["points"], pointsJson);
+        if (!settingsSetCurvePoints(pointsJson)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"invalid_curve\"}"); return; }
+    } else if (strcmp(block, "summer_cutoff") == 0) {
+        settingsSetSummerCutoff(doc["value"]);
+    } else if (strcmp(block, "gvp_pid") == 0) {
+        settingsSetGvpPid(doc["dz"], doc["kf"], doc["max"]);
+    } else if (uint8_t cont = piBlockContour(block)) {
+        PiParams pi;
+        pi.Ki = doc["ki"];
+        pi.Kp = doc["kp"];
+        pi.Ti = doc["ti"];
+        settingsSetPi(cont, pi);
+    } else if (uint8_t cont = comfortBlockContour(block)) {
+        String comfortJson;
+        serializeJson(doc["config"], comfortJson);
+        if (!settingsSetComfort(cont, comfortJson)) { server.send(400, "application/json", "{\"ok\":false,\"err\":\"invalid_comfort\"}"); return; }
+    } else {
+        server.send(400, "application/json", "{\"ok\":false,\"err\":\"unknown_block\"}");
+        return;
+    }
+
+    server.send(200, "application/json", "{\"ok\":true}");
+}
+
+void handleTimeSet() {
+    if (!isRtcAvailable) {
+        server.send(503, "application/json", "{\"ok\":false,\"err\":\"RTC offline\"}");
+        return;
+    }
+    StaticJsonDocument<128> doc;
+    deserializeJson(doc, server.arg("plain"));
+    int h = doc["h"];
+    int m = doc["m"];
+
+    DateTime now;
+    if (!rtcRead(now) || !rtcAdjust(DateTime(now.year(), now.month(), now.day(), h, m, 0))) {
+        server.send(503, "application/json", "{\"ok\":false,\"err\":\"RTC I/O error\"}");
+        return;
+    }
+
+    settingsSetTimeWasSet(true);
+    comfortInvalidate();
+
+    server.send(200, "application/json", "{\"ok\":true}");
+}
 
 // --- Инициализация Веб-интерфейса ---
 
@@ -63,6 +517,13 @@ void initializeWebInterface() {
     server.on("/api/system/status", HTTP_GET, handleSystemStatus);
     server.on("/api/contour/profile", HTTP_GET, handleContourProfileGET);
     server.on("/api/contour/profile", HTTP_POST, handleContourProfilePOST);
+    server.on("/api/live", HTTP_GET, handleLiveSubscribe);
+    server.on("/api/history", HTTP_GET, handleHistory);
+    server.on("/api/flashlog", HTTP_GET, handleFlashLog);
+    server.on("/api/events", HTTP_GET, handleEvents);
+    server.on("/api/perf", HTTP_GET, handlePerf);
+    server.on("/api/perf/reset", HTTP_POST, handlePerfReset);
 
     server.onNotFound(handleNotFound);
+    server.collectHeaders(WEB_COLLECT_HEADERS, sizeof(WEB_COLLECT_HEADERS) / sizeof(WEB_COLLECT_HEADERS[0]));
 }
@@ -2,6 +2,7 @@
 
 #include "web_server.h"
 #include "utils.h"
+#include "settings.h"
 
 // --- Вспомогательные функции (реализация тех, что объявлены в utils.h) ---
 
@@ -16,22 +17,27 @@ const TileDef& getTile(uint8_t idx){
   return TILES[(idx < 6) ? idx : 0];
 }
 
-static bool tileIdExists(const String& id) {
+bool tileIdExists(const String& id) {
   for (uint8_t i=0; i < 6; i++) {
     if (id == TILES[i].id) return true;
   }
   return false;
 }
 
+// Профиль контура берётся из appSettings (см. settings.h), без обращения к NVS
+uint8_t getProfileIndex(uint8_t cont) {
+  if (!isContour(cont)) return TILE_CUSTOM_6;
+  return appSettings.profileIdx[cont - 1];
+}
+
 String getProfileId(uint8_t cont) {
-  prefsProfiles.begin("profiles", true);
-  String key = "c" + String(cont) + ".profile";
-  String id = prefsProfiles.getString(key.c_str(), "CUSTOM_6");
-  prefsProfiles.end();
-  if (!tileIdExists(id)) {
-    id = "CUSTOM_6";
-  }
-  return id;
+  return String(TILES[getProfileIndex(cont)].id);
+}
+
+bool setProfileId(uint8_t cont, const String& id) {
+  int idx = tileIndexById(id);
+  if (idx < 0) return false;
+  return settingsSetProfile(cont, (uint8_t)idx);
 }
 
 // --- Функция настройки сервера ---
@@ -43,12 +49,12 @@ void setupWebServer() {
 void dumpNvsToSerial(){
   Serial.println(F("\n========== NVS DUMP =========="));
   Serial.println(F("[NVS/Profiles]"));
-  for (uint8_t c=1; c<=2; c++){
+  for (uint8_t c=1; c<=CONTOUR_COUNT; c++){
     String id = getProfileId(c);
     int idx = tileIndexById(id);
     const TileDef& td = getTile((idx>=0) ? (uint8_t)idx : 0);
-    Serial.print(F("  c")); Serial.print(c);
-    Serial.print(F(".profile = \""));
+    Serial.print(F("  ")); Serial.print(CONTOURS[c - 1].profileKey);
+    Serial.print(F(" = \""));
     Serial.print(id); Serial.print(F("\"  ("));
     Serial.print(td.displayName); Serial.println(F(")"));
   }
@@ -79,7 +85,7 @@ void dumpNvsToSerial(){
   
   Serial.println(F("[NVS/General]"));
   prefsGeneral.begin("general", true);
-  Serial.print(F("  pumpEnableMask = ")); Serial.println(prefsGeneral.getUChar("pumpEnableMask", 0b1111), BIN);
+  Serial.print(F("  pumpEnableMask = ")); Serial.println(prefsGeneral.getUChar("pumpEnableMask", PUMP_ENABLE_ALL), BIN);
   // ... (добавьте сюда вывод остальных параметров из prefsGeneral по аналогии, если нужно)
   prefsGeneral.end();
 